@@ -0,0 +1,172 @@
+#include "board.h"
+
+/**********************************************************************************/
+/*                                 Static Variables                               */
+/**********************************************************************************/
+
+static GPIO_t * const   board_ports[BOARD_PORT_COUNT]       = {GPIOA, GPIOB, GPIOC, GPIOD, GPIOE, GPIOH};
+static const uint32_t   board_port_clocks[BOARD_PORT_COUNT] = {
+    RCC_AHB1ENR_GPIOAEN, RCC_AHB1ENR_GPIOBEN, RCC_AHB1ENR_GPIOCEN,
+    RCC_AHB1ENR_GPIODEN, RCC_AHB1ENR_GPIOEEN, RCC_AHB1ENR_GPIOHEN
+};
+
+
+/**********************************************************************************/
+/*                                Static Functions                                */
+/**********************************************************************************/
+
+/**
+ * @brief  Maps a GPIO port to its position in the board port tables
+ * @param  port: Pointer to GPIO_t structure containing the GPIO port
+ * @retval Position of the port, or BOARD_PORT_COUNT if the port is invalid
+ */
+static uint8_t Board_Get_Port_Index(GPIO_t *port) {
+    for (uint8_t i = 0; i < BOARD_PORT_COUNT; i++) {
+        if (board_ports[i] == port) {
+            return i;
+        }
+    }
+
+    return BOARD_PORT_COUNT;
+}
+
+
+/**********************************************************************************/
+/*                              Board Core Functions                              */
+/**********************************************************************************/
+
+/**
+ * @brief  Brings up every pin, timer channel and USART listed in a board description
+ * @note   The whole table is validated before any register is written. Clock enables are
+ *         merged into one write per bus, and each GPIO port's registers are built up for all
+ *         of its pins and written once, rather than once per pin
+ * @note   TIM1 and the USARTs are then initialised through their drivers with their clocks
+ *         already running. Servo channels use @ref TIM1_Servo_Init after the counter
+ * @note   Listing a pin twice is rejected. A driver's status is passed on as it is, so an
+ *         interrupt already claimed elsewhere shows as an error rather than invalid parameters
+ * @param  board: Pointer to Board_Config structure describing the board
+ * @retval Status indicating success, invalid parameters, or error if a driver could not claim
+ *         its interrupts
+ */
+Status Board_Init(const Board_Config_t *board) {
+    //validate config struct pointer and tables
+    if (!board || (board->pin_count && !(board->pins))
+        || (board->servo_channel_count && !(board->servo_channels))
+        || (board->usart_count && !(board->usarts))) {
+        return INVALID_PARAM;
+    }
+
+    Board_Port_Image_t images[BOARD_PORT_COUNT] = {0};
+    uint32_t ahb1_clocks = 0, apb1_clocks = 0, apb2_clocks = 0;
+
+    //validate pins and build port register images
+    for (uint8_t i = 0; i < board->pin_count; i++) {
+        const GPIO_Config_t *pin = &board->pins[i];
+        uint8_t port_index = Board_Get_Port_Index(pin->port);
+        if (port_index == BOARD_PORT_COUNT || pin->pin < GPIO_PIN_0 || pin->pin > GPIO_PIN_15
+            || pin->mode < GPIO_MODE_INPUT || pin->mode > GPIO_MODE_ANALOG
+            || pin->output_type < GPIO_OUTPUT_PUSH_PULL || pin->output_type > GPIO_OUTPUT_OPEN_DRAIN
+            || pin->output_speed < GPIO_OUTPUT_SPEED_LOW || pin->output_speed > GPIO_OUTPUT_SPEED_HIGH
+            || pin->alt_function < GPIO_AF_0 || pin->alt_function > GPIO_AF_15
+            || pin->pupd < GPIO_PUPD_NO || pin->pupd > GPIO_PUPD_PULLDOWN) {
+            return INVALID_PARAM;
+        }
+
+        //a pin listed twice would have its fields merged into one register value
+        Board_Port_Image_t *image = &images[port_index];
+        uint8_t shift_1 = pin->pin;
+        uint8_t shift_2 = (pin->pin * 2U);
+        if (image->moder_mask & (SET_TWO << shift_2)) {
+            return INVALID_PARAM;
+        }
+        ahb1_clocks |= board_port_clocks[port_index];
+
+        image->moder_mask |= (SET_TWO << shift_2);
+        image->moder      |= (((uint32_t) pin->mode) << shift_2);
+        image->pupdr_mask |= (SET_TWO << shift_2);
+        image->pupdr      |= (((uint32_t) pin->pupd) << shift_2);
+
+        if (pin->mode == GPIO_MODE_OUTPUT || pin->mode == GPIO_MODE_AF) {
+            image->otyper_mask  |= (SET_ONE << shift_1);
+            image->otyper       |= (((uint32_t) pin->output_type) << shift_1);
+            image->ospeedr_mask |= (SET_TWO << shift_2);
+            image->ospeedr      |= (((uint32_t) pin->output_speed) << shift_2);
+        }
+
+        if (pin->mode == GPIO_MODE_AF) {
+            uint8_t afr   = (pin->pin <= 7) ? 0 : 1;
+            uint8_t shift = ((pin->pin % 8U) * 4U);
+            image->afr_mask[afr] |= (SET_FOUR << shift);
+            image->afr[afr]      |= (((uint32_t) pin->alt_function) << shift);
+        }
+    }
+
+    //validate servo channels and USART instances
+    if (board->timer || board->servo_channel_count) {
+        apb2_clocks |= RCC_APB2ENR_TIM1EN;
+    }
+    for (uint8_t i = 0; i < board->servo_channel_count; i++) {
+        if (Validate_TIM1_Channel(board->servo_channels[i]) == INVALID_PARAM) {
+            return INVALID_PARAM;
+        }
+    }
+    for (uint8_t i = 0; i < board->usart_count; i++) {
+        USART_t *instance = board->usarts[i].instance;
+        if (instance == USART1) {
+            apb2_clocks |= RCC_APB2ENR_USART1EN;
+        } else if (instance == USART2) {
+            apb1_clocks |= RCC_APB1ENR_USART2EN;
+        } else if (instance == USART6) {
+            apb2_clocks |= RCC_APB2ENR_USART6EN;
+        } else {
+            return INVALID_PARAM;
+        }
+    }
+
+    //enable all clocks with one write per bus
+    if (ahb1_clocks) {
+        RCC->AHB1ENR |= ahb1_clocks;
+    }
+    if (apb1_clocks) {
+        RCC->APB1ENR |= apb1_clocks;
+    }
+    if (apb2_clocks) {
+        RCC->APB2ENR |= apb2_clocks;
+    }
+    DSB();
+
+    //write each used port's registers once
+    for (uint8_t i = 0; i < BOARD_PORT_COUNT; i++) {
+        Board_Port_Image_t *image = &images[i];
+        if (!(image->moder_mask)) {
+            continue;
+        }
+        GPIO_t *port = board_ports[i];
+
+        //set alternate functions before switching pins into AF mode
+        if (image->afr_mask[0]) {
+            port->AFR[0] = ((port->AFR[0] & ~(image->afr_mask[0])) | image->afr[0]);
+        }
+        if (image->afr_mask[1]) {
+            port->AFR[1] = ((port->AFR[1] & ~(image->afr_mask[1])) | image->afr[1]);
+        }
+        port->OTYPER  = ((port->OTYPER & ~(image->otyper_mask)) | image->otyper);
+        port->OSPEEDR = ((port->OSPEEDR & ~(image->ospeedr_mask)) | image->ospeedr);
+        port->PUPDR   = ((port->PUPDR & ~(image->pupdr_mask)) | image->pupdr);
+        port->MODER   = ((port->MODER & ~(image->moder_mask)) | image->moder);
+    }
+
+    //initialise timer, servo channels and USARTs, passing on the driver's status
+    Status status = SUCCESS;
+    if (board->timer) {
+        status = TIM1_CNT_Init(board->timer);
+    }
+    for (uint8_t i = 0; status == SUCCESS && i < board->servo_channel_count; i++) {
+        status = TIM1_Servo_Init(board->servo_channels[i]);
+    }
+    for (uint8_t i = 0; status == SUCCESS && i < board->usart_count; i++) {
+        status = USART_Init(&board->usarts[i]);
+    }
+
+    return status;
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+#ifndef __BOARD_H
+#define __BOARD_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../utils/utils.h"
+#include "../drivers/gpio/gpio.h"
+#include "../drivers/tim1/tim1.h"
+#include "../drivers/usart/usart.h"
+
+
+/**********************************************************************************/
+/*                                     Defines                                    */
+/**********************************************************************************/
+
+#define BOARD_PORT_COUNT        6U
+
+
+/**********************************************************************************/
+/*                              Configuration Structs                             */
+/**********************************************************************************/
+
+typedef struct {
+/************************************ Required ************************************/
+    const GPIO_Config_t *pins;
+    uint8_t             pin_count;
+/************************************ Optional ************************************/
+    TIM1_CNT_Config_t   *timer;
+    const TIM1_Channel  *servo_channels;
+    uint8_t             servo_channel_count;
+    USART_Init_Config_t *usarts;
+    uint8_t             usart_count;
+} Board_Config_t;
+
+typedef struct {
+    uint32_t moder_mask;
+    uint32_t moder;
+    uint32_t otyper_mask;
+    uint32_t otyper;
+    uint32_t ospeedr_mask;
+    uint32_t ospeedr;
+    uint32_t pupdr_mask;
+    uint32_t pupdr;
+    uint32_t afr_mask[2];
+    uint32_t afr[2];
+} Board_Port_Image_t;
+
+
+/**********************************************************************************/
+/*                               Function Prototypes                              */
+/**********************************************************************************/
+
+Status Board_Init                (const Board_Config_t *board_config);
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
\ No newline at end of file
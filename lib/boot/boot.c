@@ -0,0 +1,259 @@
+#include "boot.h"
+
+/**********************************************************************************/
+/*                                 Static Variables                               */
+/**********************************************************************************/
+
+static const Board_Config_t *boot_board         = 0;
+static Boot_State            boot_state         = BOOT_STATE_IDLE;
+static uint64_t              boot_elapsed_ns    = 0;
+static uint32_t              boot_last_cycles   = 0;
+static Status                boot_switch_status = SUCCESS;
+static uint64_t              boot_phase_ns[BOOT_PHASE_COUNT] = {0};
+
+
+/**********************************************************************************/
+/*                                Static Functions                                */
+/**********************************************************************************/
+
+/**
+ * @brief  Records the time from boot entry to the end of a phase
+ * @note   The core clock changes during boot, so the cycles since the previous mark are
+ *         converted at the frequency that was running over them
+ * @param  phase:      Boot phase that has just ended
+ * @param  cycles:     Cycle counter value at the end of the phase
+ * @param  clock_freq: Core clock frequency since the previous mark in Hz
+ */
+static void Boot_Mark(Boot_Phase phase, uint32_t cycles, uint32_t clock_freq) {
+    boot_elapsed_ns += ((((uint64_t) (cycles - boot_last_cycles)) * SEC_TO_NANO) / clock_freq);
+    boot_last_cycles = cycles;
+    boot_phase_ns[phase] = boot_elapsed_ns;
+}
+
+/* reads whether more than timeout cycles have passed since start */
+static uint8_t Boot_Expired(uint32_t start, uint32_t timeout) {
+    return ((Cycle_Counter_Get() - start) > timeout);
+}
+
+/**
+ * @brief  Moves the core onto the locked PLL without disturbing the servo frame in progress
+ * @note   The TIM1 prescaler is rescaled so a tick keeps its length, and is written in the
+ *         last BOOT_SWITCH_WINDOW_TICKS of a frame, after the pulse has ended. It loads at the
+ *         next update event, so the only effect is that frame's gap ending a few tens of
+ *         microseconds early
+ * @note   The rescaled divider is rounded to the nearest whole value. When the clock ratio
+ *         does not divide it exactly, a tick is off by up to half a PLL cycle, e.g. 16 MHz to
+ *         100 MHz turns PSC 16 into 105 rather than 105.25
+ * @note   Gives up after BOOT_SWITCH_TIMEOUT_FRAMES frames without a usable window, e.g. if
+ *         TIM1 has been stopped, leaving the core on its current clock
+ * @retval Status indicating success, or error if no window was found or the switch timed out
+ */
+static Status Boot_Switch_Clock(void) {
+    uint32_t old_freq = g_sys_clk_freq;
+    Status   status;
+
+    //without a running servo frame there is nothing to keep in step
+    if (!(TIM1->CR1 & TIM_CR1_CEN) || TIM1->ARR <= (BOOT_SWITCH_WINDOW_TICKS + BOOT_SWITCH_GUARD_TICKS)) {
+        Boot_Mark(BOOT_PHASE_SWITCH, Cycle_Counter_Get(), old_freq);
+        return System_Clock_Switch(PLL_CLOCK);
+    }
+
+    uint32_t prescaler = TIM1->PSC;
+    uint32_t old_mhz   = (old_freq / SEC_TO_MICRO);
+    uint32_t rescaled  = (((((prescaler + 1UL) * (PLL_FREQ_HZ / SEC_TO_MICRO)) + (old_mhz / 2UL)) / old_mhz) - 1UL);
+    uint32_t window    = (TIM1->ARR - BOOT_SWITCH_WINDOW_TICKS);
+
+    //TIM1 runs from the core clock, so a frame lasts (ARR + 1) * (PSC + 1) cycles
+    uint64_t frame_cycles = ((uint64_t) (TIM1->ARR + 1UL) * (prescaler + 1UL));
+    uint64_t wait_cycles  = (frame_cycles * BOOT_SWITCH_TIMEOUT_FRAMES);
+    uint32_t timeout      = (wait_cycles > 0x7FFFFFFFULL) ? 0x7FFFFFFFUL : (uint32_t) wait_cycles;
+    uint32_t start        = Cycle_Counter_Get();
+
+    while (1) {
+        //wait for the end of the frame with interrupts enabled
+        while (TIM1->CNT < window) {
+            if (Boot_Expired(start, timeout)) {
+                Boot_Mark(BOOT_PHASE_SWITCH, Cycle_Counter_Get(), old_freq);
+                return ERROR;
+            }
+        }
+
+        //switch only if enough of the window is left to finish before the update event
+        uint32_t primask = ENTER_CRITICAL();
+        uint32_t count   = TIM1->CNT;
+        if (count >= window && (count + BOOT_SWITCH_GUARD_TICKS) < TIM1->ARR) {
+            uint32_t cycles = Cycle_Counter_Get();
+            TIM1->PSC = rescaled;
+            status = System_Clock_Switch(PLL_CLOCK);
+            if (status != SUCCESS) {
+                TIM1->PSC = prescaler;
+            }
+            EXIT_CRITICAL(primask);
+            Boot_Mark(BOOT_PHASE_SWITCH, cycles, old_freq);
+            return status;
+        }
+        EXIT_CRITICAL(primask);
+
+        //missed the window, try again next frame
+        while (TIM1->CNT >= window) {
+            if (Boot_Expired(start, timeout)) {
+                Boot_Mark(BOOT_PHASE_SWITCH, Cycle_Counter_Get(), old_freq);
+                return ERROR;
+            }
+        }
+    }
+}
+
+
+/**********************************************************************************/
+/*                               Boot Core Functions                              */
+/**********************************************************************************/
+
+/**
+ * @brief  Takes the board from reset to its first servo pulse, timing each phase
+ * @note   Should be the first call in main. Phase timestamps come from the DWT cycle counter,
+ *         starting at boot entry, and are read with @ref Boot_Get_Profile
+ * @note   In blocking mode the clock is brought up first, with HSI as the fallback if HSE or
+ *         the PLL fail to start, then the whole board is initialised
+ * @note   In fast start mode the board's pins, timer and servos are initialised on HSI so the
+ *         first pulse goes out immediately, while HSE and the PLL start in the background.
+ *         @ref Boot_Poll then switches over to the PLL and initialises the USARTs at the final
+ *         clock. Fast start only supports a PLL target
+ * @param  boot_config: Pointer to Boot_Config structure containing boot settings
+ * @retval Status indicating success or invalid parameters
+ */
+Status Boot_Start(const Boot_Config_t *boot_config) {
+    //validate config struct pointer, board, mode and clock source
+    if (!boot_config || !(boot_config->board) || boot_config->mode < BOOT_MODE_BLOCKING
+        || boot_config->mode > BOOT_MODE_FAST_START
+        || (boot_config->clock_source && boot_config->clock_source != HSI_CLOCK
+            && boot_config->clock_source != HSE_CLOCK && boot_config->clock_source != PLL_CLOCK)
+        || (boot_config->mode == BOOT_MODE_FAST_START && boot_config->clock_source == HSE_CLOCK)) {
+        return INVALID_PARAM;
+    }
+    System_Clock_Source target = boot_config->clock_source ? boot_config->clock_source : PLL_CLOCK;
+
+    //the core always leaves reset running from HSI
+    g_sys_clk_source = HSI_CLOCK;
+    g_sys_clk_freq   = HSI_FREQ_HZ;
+    g_apb1_clk_freq  = HSI_FREQ_HZ;
+
+    //start timing from boot entry
+    boot_board         = boot_config->board;
+    boot_state         = BOOT_STATE_IDLE;
+    boot_elapsed_ns    = 0;
+    boot_last_cycles   = 0;
+    boot_switch_status = SUCCESS;
+    for (uint8_t i = 0; i < BOOT_PHASE_COUNT; i++) {
+        boot_phase_ns[i] = 0;
+    }
+    Cycle_Counter_Init();
+
+    Peripheral_Reset();
+    Boot_Mark(BOOT_PHASE_RESET, Cycle_Counter_Get(), HSI_FREQ_HZ);
+
+    //blocking mode brings the clock up before anything else
+    if (boot_config->mode == BOOT_MODE_BLOCKING || target == HSI_CLOCK) {
+        Status clock_status = System_Clock_Init(target);
+        Boot_Mark(BOOT_PHASE_CLOCK, Cycle_Counter_Get(), HSI_FREQ_HZ);
+        if (Board_Init(boot_board) != SUCCESS) {
+            boot_state = BOOT_STATE_FAILED;
+            return INVALID_PARAM;
+        }
+        Boot_Mark(BOOT_PHASE_FIRST_PULSE, Cycle_Counter_Get(), g_sys_clk_freq);
+
+        //the clock was already switched during the clock phase, so the switch phase is empty
+        Boot_Mark(BOOT_PHASE_SWITCH, Cycle_Counter_Get(), g_sys_clk_freq);
+        Boot_Mark(BOOT_PHASE_COMPLETE, Cycle_Counter_Get(), g_sys_clk_freq);
+        boot_switch_status = clock_status;
+        boot_state = (clock_status == SUCCESS) ? BOOT_STATE_COMPLETE : BOOT_STATE_FALLBACK;
+        return SUCCESS;
+    }
+
+    //fast start drives the servos from HSI and holds back the baud rate dependent USARTs
+    System_Clock_Init(HSI_CLOCK);
+    Boot_Mark(BOOT_PHASE_CLOCK, Cycle_Counter_Get(), HSI_FREQ_HZ);
+
+    Board_Config_t pulse_board = *boot_board;
+    pulse_board.usarts      = 0;
+    pulse_board.usart_count = 0;
+    if (Board_Init(&pulse_board) != SUCCESS) {
+        boot_state = BOOT_STATE_FAILED;
+        return INVALID_PARAM;
+    }
+    Boot_Mark(BOOT_PHASE_FIRST_PULSE, Cycle_Counter_Get(), HSI_FREQ_HZ);
+
+    //lock the PLL in the background
+    System_Clock_PLL_Start();
+    boot_state = BOOT_STATE_PENDING;
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Completes a fast start once the PLL has locked
+ * @note   Call repeatedly from the main loop until it stops returning BOOT_STATE_PENDING.
+ *         Once the PLL locks this waits for the end of the current servo frame, up to one
+ *         frame, to switch clocks. If the PLL fails to lock the board stays on HSI
+ * @retval Boot state, BOOT_STATE_FALLBACK if the board did not reach the PLL, or
+ *         BOOT_STATE_FAILED if the held back USARTs could not be initialised
+ */
+Boot_State Boot_Poll(void) {
+    if (boot_state != BOOT_STATE_PENDING) {
+        return boot_state;
+    }
+
+    //switch over, or give up and stay on HSI
+    System_Clock_PLL_State pll_state = System_Clock_PLL_Poll();
+    if (pll_state == PLL_STATE_LOCKED) {
+        boot_switch_status = Boot_Switch_Clock();
+    } else if (pll_state == PLL_STATE_FAILED) {
+        boot_switch_status = ERROR;
+        Boot_Mark(BOOT_PHASE_SWITCH, Cycle_Counter_Get(), g_sys_clk_freq);
+    } else {
+        return BOOT_STATE_PENDING;
+    }
+
+    //bring up the held back USARTs at the final clock
+    Board_Config_t deferred_board = {
+        .usarts      = boot_board->usarts,
+        .usart_count = boot_board->usart_count
+    };
+    Status board_status = Board_Init(&deferred_board);
+    Boot_Mark(BOOT_PHASE_COMPLETE, Cycle_Counter_Get(), g_sys_clk_freq);
+
+    if (board_status != SUCCESS) {
+        boot_state = BOOT_STATE_FAILED;
+    } else {
+        boot_state = (g_sys_clk_source == PLL_CLOCK) ? BOOT_STATE_COMPLETE : BOOT_STATE_FALLBACK;
+    }
+
+    return boot_state;
+}
+
+/**
+ * @brief  Reads the boot phase timestamps
+ * @note   Phases that have not been reached yet read as 0. The switch status is ERROR if the
+ *         PLL failed to lock or no servo frame window was found to switch in, and SUCCESS
+ *         until the switch has been attempted
+ * @param  profile: Pointer to store the time from boot entry to the end of each phase in
+ *                  microseconds, the clock the board ended up on, the clock switch status
+ *                  and the boot state
+ * @retval Status indicating success or invalid parameters
+ */
+Status Boot_Get_Profile(Boot_Profile_t *profile) {
+    //validate profile pointer
+    if (!profile) {
+        return INVALID_PARAM;
+    }
+
+    for (uint8_t i = 0; i < BOOT_PHASE_COUNT; i++) {
+        profile->phase_us[i] = (uint32_t) (boot_phase_ns[i] / SEC_TO_MILLI);
+    }
+    profile->clock_source  = g_sys_clk_source;
+    profile->hse_failed    = System_Clock_HSE_Failed();
+    profile->switch_status = boot_switch_status;
+    profile->state         = boot_state;
+
+    return SUCCESS;
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+#ifndef __BOOT_H
+#define __BOOT_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../utils/utils.h"
+#include "../board/board.h"
+
+
+/**********************************************************************************/
+/*                                     Defines                                    */
+/**********************************************************************************/
+
+#define BOOT_SWITCH_WINDOW_TICKS    50U
+#define BOOT_SWITCH_GUARD_TICKS     20U
+#define BOOT_SWITCH_TIMEOUT_FRAMES  3U
+
+
+/**********************************************************************************/
+/*                                      Enums                                     */
+/**********************************************************************************/
+
+typedef enum {
+    BOOT_PHASE_ENTRY = 0,
+    BOOT_PHASE_RESET,
+    BOOT_PHASE_CLOCK,
+    BOOT_PHASE_FIRST_PULSE,
+    BOOT_PHASE_SWITCH,
+    BOOT_PHASE_COMPLETE,
+    BOOT_PHASE_COUNT
+} Boot_Phase;
+
+typedef enum {
+    BOOT_MODE_BLOCKING = 0,
+    BOOT_MODE_FAST_START
+} Boot_Mode;
+
+typedef enum {
+    BOOT_STATE_IDLE = 0,
+    BOOT_STATE_PENDING,
+    BOOT_STATE_COMPLETE,
+    BOOT_STATE_FALLBACK,
+    BOOT_STATE_FAILED
+} Boot_State;
+
+
+/**********************************************************************************/
+/*                              Configuration Structs                             */
+/**********************************************************************************/
+
+typedef struct {
+/************************************ Required ************************************/
+    const Board_Config_t *board;
+/************************************ Optional ************************************/
+    Boot_Mode            mode;
+    System_Clock_Source  clock_source;
+} Boot_Config_t;
+
+typedef struct {
+    uint32_t            phase_us[BOOT_PHASE_COUNT];
+    System_Clock_Source clock_source;
+    uint8_t             hse_failed;
+    Status              switch_status;
+    Boot_State          state;
+} Boot_Profile_t;
+
+
+/**********************************************************************************/
+/*                               Function Prototypes                              */
+/**********************************************************************************/
+
+Status     Boot_Start                (const Boot_Config_t *boot_config);
+Boot_State Boot_Poll                 (void);
+Status     Boot_Get_Profile          (Boot_Profile_t *profile);
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
\ No newline at end of file
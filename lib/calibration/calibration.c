@@ -0,0 +1,227 @@
+#include "calibration.h"
+
+/**********************************************************************************/
+/*                                Static Functions                                */
+/**********************************************************************************/
+
+/**
+ * @brief  Moves a servo to a pulse width and samples its position feedback once settled
+ * @note   Settling is counted in ADC frames, which arrive once per PWM frame. Gives up after
+ *         twice the expected time if the ADC is not running
+ * @param  config:   Pointer to Calibration_Config structure containing the sweep settings
+ * @param  pulse_us: Pulse width in microseconds
+ * @param  feedback: Pointer to store the averaged feedback sample
+ * @retval Status indicating success, or error if no ADC frames arrived
+ */
+static Status Calibration_Sample(Calibration_Config_t *config, uint16_t pulse_us, uint16_t *feedback) {
+    if (TIM1_Servo_Set_Pulse(config->channel, pulse_us) != SUCCESS) {
+        return ERROR;
+    }
+
+    //wait for the servo to settle, bounded by the system clock in case the ADC is stopped
+    uint32_t frames  = config->settle_frames ? config->settle_frames : 5U;
+    uint32_t timeout = ((g_sys_clk_freq / 1000000U) * TIM1_SERVO_FRAME_US * frames * 2U);
+    uint32_t start_frame  = ADC_Get_Frame_Count();
+    uint32_t start_cycles = Cycle_Counter_Get();
+    while ((ADC_Get_Frame_Count() - start_frame) < frames) {
+        if ((Cycle_Counter_Get() - start_cycles) > timeout) {
+            return ERROR;
+        }
+    }
+
+    return ADC_Read(config->feedback_index, feedback);
+}
+
+/**
+ * @brief  Limits a pulse width to the 500 - 2500us range the servo and PID paths drive
+ * @param  pulse_us: Pulse width in microseconds
+ * @retval Pulse width within TIM1_SERVO_DEFAULT_MIN_US and TIM1_SERVO_DEFAULT_MAX_US
+ */
+static int32_t Calibration_Clamp_Pulse(int32_t pulse_us) {
+    if (pulse_us < (int32_t) TIM1_SERVO_DEFAULT_MIN_US) {
+        return (int32_t) TIM1_SERVO_DEFAULT_MIN_US;
+    } else if (pulse_us > (int32_t) TIM1_SERVO_DEFAULT_MAX_US) {
+        return (int32_t) TIM1_SERVO_DEFAULT_MAX_US;
+    }
+
+    return pulse_us;
+}
+
+/**
+ * @brief  Steps outward from centre until position feedback stops changing
+ * @param  config:   Pointer to Calibration_Config structure containing the sweep settings
+ * @param  start:    Pulse width to start from in microseconds
+ * @param  step:     Signed step in microseconds, negative to sweep towards sweep_min
+ * @param  limit:    Pulse width at which the sweep gives up in microseconds
+ * @param  endpoint: Pointer to store the last pulse width that produced motion
+ * @retval Status indicating success, or error if feedback could not be sampled
+ */
+static Status Calibration_Sweep(Calibration_Config_t *config, int32_t start, int32_t step, int32_t limit,
+                                uint16_t *endpoint) {
+    uint16_t threshold = config->motion_threshold ? config->motion_threshold : 8U;
+    uint16_t previous, feedback;
+    uint8_t  stalled = 0;
+
+    if (Calibration_Sample(config, (uint16_t) start, &previous) != SUCCESS) {
+        return ERROR;
+    }
+
+    //three consecutive steps without motion mark the mechanical end stop
+    *endpoint = (uint16_t) limit;
+    for (int32_t pulse = (start + step); (step < 0) ? (pulse >= limit) : (pulse <= limit); pulse += step) {
+        if (Calibration_Sample(config, (uint16_t) pulse, &feedback) != SUCCESS) {
+            return ERROR;
+        }
+        int32_t motion = ((int32_t) feedback - (int32_t) previous);
+        if (motion <= (int32_t) threshold && motion >= -((int32_t) threshold)) {
+            if (++stalled >= 3U) {
+                *endpoint = (uint16_t) (pulse - (3 * step));
+                break;
+            }
+        } else {
+            stalled = 0;
+        }
+        previous = feedback;
+    }
+
+    return SUCCESS;
+}
+
+
+/**********************************************************************************/
+/*                           Calibration Core Functions                           */
+/**********************************************************************************/
+
+/**
+ * @brief  Learns the pulse endpoints of a servo and applies them to its calibration table
+ * @note   With feedback enabled the servo is swept out from the nominal centre in step
+ *         increments until its feedback stops changing, giving the min and max pulse, and
+ *         the centre is found by bisection for the feedback midpoint. Assumes the ADC has
+ *         been initialised via @ref ADC_Init and started. Servos are briefly driven into
+ *         their end stops, so a current supervisor may record stall events
+ * @note   With feedback disabled the manual min and max pulses are applied, with the centre
+ *         defaulting to their midpoint
+ * @note   Endpoints are limited to TIM1_SERVO_DEFAULT_MIN_US - TIM1_SERVO_DEFAULT_MAX_US, the
+ *         range the servo and PID paths clamp to, so a stored table is never clipped later
+ * @note   The result is applied immediately but only persists once @ref Calibration_Save
+ *         is called
+ * @param  config: Pointer to Calibration_Config structure containing calibration settings
+ * @param  result: Pointer to store the learned pulses and feedback range, may be NULL
+ * @retval Status indicating success, invalid parameters, or error if the sweep failed
+ */
+Status Calibration_Run(Calibration_Config_t *config, Calibration_Result_t *result) {
+    //validate config struct pointer and channel
+    if (!config || Validate_TIM1_Channel(config->channel) == INVALID_PARAM
+        || config->feedback < CALIBRATION_FEEDBACK_DISABLED || config->feedback > CALIBRATION_FEEDBACK_ENABLED) {
+        return INVALID_PARAM;
+    }
+
+    Calibration_Result_t learned = {0};
+
+    if (config->feedback == CALIBRATION_FEEDBACK_DISABLED) {
+        learned.pulses = config->manual;
+        learned.pulses.min_pulse = (uint16_t) Calibration_Clamp_Pulse(learned.pulses.min_pulse);
+        learned.pulses.max_pulse = (uint16_t) Calibration_Clamp_Pulse(learned.pulses.max_pulse);
+        if (!(learned.pulses.centre_pulse)) {
+            learned.pulses.centre_pulse = ((learned.pulses.min_pulse + learned.pulses.max_pulse) / 2U);
+        }
+    } else {
+        int32_t sweep_min = Calibration_Clamp_Pulse(config->sweep_min ? config->sweep_min : TIM1_SERVO_DEFAULT_MIN_US);
+        int32_t sweep_max = Calibration_Clamp_Pulse(config->sweep_max ? config->sweep_max : TIM1_SERVO_DEFAULT_MAX_US);
+        int32_t step      = config->step ? config->step : 10;
+        if (sweep_min >= (int32_t) TIM1_SERVO_DEFAULT_CENTRE_US || sweep_max <= (int32_t) TIM1_SERVO_DEFAULT_CENTRE_US) {
+            return INVALID_PARAM;
+        }
+
+        //find the end stops, the cycle counter may already be timing other modules
+        if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA)) {
+            Cycle_Counter_Init();
+        }
+        if (Calibration_Sweep(config, TIM1_SERVO_DEFAULT_CENTRE_US, -step, sweep_min, &learned.pulses.min_pulse) != SUCCESS
+            || Calibration_Sweep(config, TIM1_SERVO_DEFAULT_CENTRE_US, step, sweep_max, &learned.pulses.max_pulse) != SUCCESS
+            || Calibration_Sample(config, learned.pulses.min_pulse, &learned.feedback_min) != SUCCESS
+            || Calibration_Sample(config, learned.pulses.max_pulse, &learned.feedback_max) != SUCCESS) {
+            return ERROR;
+        }
+
+        //bisect for the pulse giving the feedback midpoint
+        int32_t  low       = learned.pulses.min_pulse;
+        int32_t  high      = learned.pulses.max_pulse;
+        uint16_t target    = ((learned.feedback_min + learned.feedback_max) / 2U);
+        uint8_t  ascending = (learned.feedback_max > learned.feedback_min);
+        while ((high - low) > step) {
+            int32_t  mid = ((low + high) / 2);
+            uint16_t feedback;
+            if (Calibration_Sample(config, (uint16_t) mid, &feedback) != SUCCESS) {
+                return ERROR;
+            }
+            if ((feedback < target) == ascending) {
+                low = mid;
+            } else {
+                high = mid;
+            }
+        }
+        learned.pulses.centre_pulse = (uint16_t) ((low + high) / 2);
+    }
+
+    //apply and park the servo at centre
+    if (TIM1_Servo_Set_Calibration(config->channel, &learned.pulses) != SUCCESS) {
+        return ERROR;
+    }
+    TIM1_Servo_Set_Pulse(config->channel, learned.pulses.centre_pulse);
+
+    if (result) {
+        *result = learned;
+    }
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Stores the calibration table of every channel in the configuration store
+ * @note   Assumes the store has been mounted via @ref Storage_Init
+ * @retval Status indicating success, or error if the store could not be written
+ */
+Status Calibration_Save(void) {
+    TIM1_Servo_Calibration_t channels[4];
+    for (uint8_t i = 0; i < 4U; i++) {
+        TIM1_Servo_Get_Calibration((TIM1_Channel) (TIM1_CHANNEL_1 + i), &channels[i]);
+    }
+
+    return (Storage_Write(STORAGE_KEY_SERVO_CALIBRATION, channels, sizeof(channels)) == SUCCESS) ? SUCCESS : ERROR;
+}
+
+/**
+ * @brief  Removes the stored calibration of every channel
+ * @note   Channels keep their current table until the next @ref TIM1_Servo_Init
+ * @retval Status indicating success, or error if the store could not be written
+ */
+Status Calibration_Erase(void) {
+    return (Storage_Delete(STORAGE_KEY_SERVO_CALIBRATION) == SUCCESS) ? SUCCESS : ERROR;
+}
+
+/**
+ * @brief  Loads the stored calibration of a servo channel
+ * @note   Overrides the weak default in the TIM1 driver, so that @ref TIM1_Servo_Init picks
+ *         up the stored table automatically once @ref Storage_Init has been called
+ * @param  channel:     TIM1 channel driving the servo
+ * @param  calibration: Pointer to store the pulse widths in microseconds
+ * @retval Status indicating success, invalid parameters, or error if no calibration is stored
+ */
+Status TIM1_Servo_Load_Calibration(TIM1_Channel channel, TIM1_Servo_Calibration_t *calibration) {
+    //validate channel and calibration pointer
+    if (Validate_TIM1_Channel(channel) == INVALID_PARAM || !calibration) {
+        return INVALID_PARAM;
+    }
+
+    TIM1_Servo_Calibration_t channels[4];
+    uint16_t length;
+    if (Storage_Read(STORAGE_KEY_SERVO_CALIBRATION, channels, sizeof(channels), &length) != SUCCESS
+        || length != sizeof(channels)) {
+        return ERROR;
+    }
+
+    *calibration = channels[channel - TIM1_CHANNEL_1];
+
+    return SUCCESS;
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+#ifndef __CALIBRATION_H
+#define __CALIBRATION_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../utils/utils.h"
+#include "../drivers/tim1/tim1.h"
+#include "../drivers/adc/adc.h"
+#include "../storage/storage.h"
+
+
+/**********************************************************************************/
+/*                                      Enums                                     */
+/**********************************************************************************/
+
+typedef enum {
+    CALIBRATION_FEEDBACK_DISABLED = 0,
+    CALIBRATION_FEEDBACK_ENABLED
+} Calibration_Feedback;
+
+
+/**********************************************************************************/
+/*                              Configuration Structs                             */
+/**********************************************************************************/
+
+typedef struct {
+/************************************ Required ************************************/
+    TIM1_Channel             channel;
+/************************************ Optional ************************************/
+    Calibration_Feedback     feedback;
+    uint8_t                  feedback_index;
+    uint16_t                 sweep_min;
+    uint16_t                 sweep_max;
+    uint16_t                 step;
+    uint16_t                 settle_frames;
+    uint16_t                 motion_threshold;
+    TIM1_Servo_Calibration_t manual;
+} Calibration_Config_t;
+
+typedef struct {
+    TIM1_Servo_Calibration_t pulses;
+    uint16_t                 feedback_min;
+    uint16_t                 feedback_max;
+} Calibration_Result_t;
+
+
+/**********************************************************************************/
+/*                               Function Prototypes                              */
+/**********************************************************************************/
+
+Status Calibration_Run           (Calibration_Config_t *calibration_config, Calibration_Result_t *result);
+Status Calibration_Save          (void);
+Status Calibration_Erase         (void);
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
\ No newline at end of file
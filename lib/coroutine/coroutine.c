@@ -0,0 +1,160 @@
+#include "coroutine.h"
+
+/**********************************************************************************/
+/*                                Static Functions                                */
+/**********************************************************************************/
+
+/**
+ * @brief  Marks a coroutine delay as elapsed and wakes the coroutine
+ * @note   Runs from the timer wheel in PendSV
+ * @param  context: Pointer to the coroutine
+ */
+static void Coroutine_Delay_Expired(void *context) {
+    Coroutine_t *coroutine = context;
+
+    //a timer left over from before a restart is ignored
+    if (coroutine->delay_state != COROUTINE_DELAY_ARMED) {
+        return;
+    }
+    coroutine->delay_state = COROUTINE_DELAY_EXPIRED;
+    Coroutine_Wake(coroutine);
+}
+
+
+/**********************************************************************************/
+/*                             Coroutine Core Functions                           */
+/**********************************************************************************/
+
+/**
+ * @brief  Starts a stackless coroutine, running it first from PendSV
+ * @note   The coroutine body is a function bracketed by COROUTINE_BEGIN and COROUTINE_END.
+ *         It runs to its next await from PendSV whenever it is woken, so long sequences
+ *         such as calibration or protocol handshakes read linearly without a thread or a
+ *         blocking wait. Claims PendSV via @ref Deferred_Init
+ * @note   Restarting a coroutine cancels a delay it was waiting on. A coroutine that has
+ *         never been started must be zero initialised, as in static storage
+ * @param  coroutine: Pointer to the coroutine, which must stay valid until it is done
+ * @param  function:  Coroutine body
+ * @param  context:   Pointer stored in the coroutine for the body's own state, may be NULL
+ * @retval Status indicating success, invalid parameters, or error if PendSV is unavailable
+ */
+Status Coroutine_Start(Coroutine_t *coroutine, Coroutine_Function_t function, void *context) {
+    //validate coroutine and body
+    if (!coroutine || !function) {
+        return INVALID_PARAM;
+    }
+
+    //coroutines are resumed as deferred work
+    if (Deferred_Init() != SUCCESS) {
+        return ERROR;
+    }
+
+    //cancel the delay timer of a previous run
+    if (coroutine->delay_state == COROUTINE_DELAY_ARMED) {
+        Timer_Wheel_Cancel(coroutine->delay_timer);
+    }
+
+    coroutine->function     = function;
+    coroutine->context      = context;
+    coroutine->resume_point = 0;
+    coroutine->scheduled    = 0;
+    coroutine->delay_state  = COROUTINE_DELAY_IDLE;
+    coroutine->state        = COROUTINE_WAITING;
+
+    return Coroutine_Wake(coroutine);
+}
+
+/**
+ * @brief  Schedules a coroutine to test its await condition again
+ * @note   Callable from any interrupt. At most one resume is queued per coroutine
+ * @param  coroutine: Pointer to the coroutine
+ * @retval Status indicating success, invalid parameters, or error if the deferred queue is full
+ */
+Status Coroutine_Wake(Coroutine_t *coroutine) {
+    //validate coroutine
+    if (!coroutine) {
+        return INVALID_PARAM;
+    }
+
+    if (ATOMIC_EXCHANGE(&coroutine->scheduled, 1U)) {
+        return SUCCESS;
+    }
+
+    if (Deferred_Post(Coroutine_Resume, COROUTINE_ARGUMENT(coroutine)) != SUCCESS) {
+        coroutine->scheduled = 0;
+        return ERROR;
+    }
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Runs a coroutine up to its next await
+ * @note   A Deferred_Work_t, so a driver can post it directly on completion with
+ *         COROUTINE_ARGUMENT as argument, e.g. via @ref USART_Register_Notify. Extra resumes
+ *         only test the await condition again
+ * @param  argument: Pointer to the coroutine, from COROUTINE_ARGUMENT
+ */
+void Coroutine_Resume(uint32_t argument) {
+    Coroutine_t *coroutine = (Coroutine_t *) (uintptr_t) argument;
+
+    //wakes from here on queue another resume
+    coroutine->scheduled = 0;
+
+    if (coroutine->state == COROUTINE_WAITING) {
+        coroutine->state = coroutine->function(coroutine);
+    }
+}
+
+/**
+ * @brief  Reads whether a coroutine has reached COROUTINE_END or COROUTINE_EXIT, or failed
+ * @param  coroutine: Pointer to the coroutine
+ * @retval 1 if the coroutine has finished, otherwise 0
+ */
+uint8_t Coroutine_Is_Done(const Coroutine_t *coroutine) {
+    return (coroutine->state != COROUTINE_WAITING);
+}
+
+/**
+ * @brief  Reads whether a coroutine ended because a COROUTINE_DELAY could not be armed
+ * @param  coroutine: Pointer to the coroutine
+ * @retval 1 if the coroutine has failed, otherwise 0
+ */
+uint8_t Coroutine_Has_Failed(const Coroutine_t *coroutine) {
+    return (coroutine->state == COROUTINE_FAILED);
+}
+
+/**
+ * @brief  Await condition behind COROUTINE_DELAY
+ * @note   Arms a one-shot timer on the first test and reports the delay elapsed once it has
+ *         fired. If no timer can be armed, because the wheel is full or was never initialised
+ *         via @ref Timer_Wheel_Init, the delay state becomes COROUTINE_DELAY_FAILED and
+ *         COROUTINE_DELAY ends the coroutine failed rather than skip the wait
+ * @param  coroutine: Pointer to the coroutine
+ * @param  ticks:     Systick ticks to wait
+ * @retval 1 once the delay has elapsed, otherwise 0
+ */
+uint8_t Coroutine_Delay_Elapsed(Coroutine_t *coroutine, uint32_t ticks) {
+    switch (coroutine->delay_state) {
+        case COROUTINE_DELAY_EXPIRED:
+            coroutine->delay_state = COROUTINE_DELAY_IDLE;
+            return 1U;
+        case COROUTINE_DELAY_ARMED:
+        case COROUTINE_DELAY_FAILED:
+            return 0;
+        default:
+            break;
+    }
+
+    if (!ticks) {
+        return 1U;
+    }
+
+    //armed before the timer starts, so an immediate expiry is not ignored
+    coroutine->delay_state = COROUTINE_DELAY_ARMED;
+    if (Timer_Wheel_Start(ticks, 0, Coroutine_Delay_Expired, coroutine, &coroutine->delay_timer) != SUCCESS) {
+        coroutine->delay_state = COROUTINE_DELAY_FAILED;
+    }
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,128 @@
+#ifndef __COROUTINE_H
+#define __COROUTINE_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../utils/utils.h"
+#include "../timer_wheel/timer_wheel.h"
+
+
+/**********************************************************************************/
+/*                                     Defines                                    */
+/**********************************************************************************/
+
+/* a coroutine body is bracketed by BEGIN and END, with at most one AWAIT, YIELD or DELAY
+   per source line. Locals do not survive an await, keep state in the context instead */
+#define COROUTINE_BEGIN(coroutine)                                                      \
+    switch ((coroutine)->resume_point) {                                                \
+        case 0:
+
+#define COROUTINE_END(coroutine)                                                        \
+    }                                                                                   \
+    (coroutine)->resume_point = 0;                                                      \
+    return COROUTINE_DONE
+
+/* returns until the condition holds, it is tested again each time the coroutine is woken */
+#define COROUTINE_AWAIT(coroutine, condition)                                           \
+    do {                                                                                \
+        (coroutine)->resume_point = __LINE__;                                           \
+        case __LINE__:                                                                  \
+        if (!(condition)) {                                                             \
+            return COROUTINE_WAITING;                                                   \
+        }                                                                               \
+    } while (0)
+
+/* lets other deferred work run, then carries on */
+#define COROUTINE_YIELD(coroutine)                                                      \
+    do {                                                                                \
+        (coroutine)->resume_point = __LINE__;                                           \
+        Coroutine_Wake(coroutine);                                                      \
+        return COROUTINE_WAITING;                                                       \
+        case __LINE__:;                                                                 \
+    } while (0)
+
+/* waits a number of Systick ticks on the timer wheel, ends the coroutine failed if no timer
+   can be armed */
+#define COROUTINE_DELAY(coroutine, ticks)                                               \
+    do {                                                                                \
+        (coroutine)->resume_point = __LINE__;                                           \
+        case __LINE__:                                                                  \
+        if (!Coroutine_Delay_Elapsed((coroutine), (ticks))) {                           \
+            if ((coroutine)->delay_state != COROUTINE_DELAY_FAILED) {                   \
+                return COROUTINE_WAITING;                                               \
+            }                                                                           \
+            (coroutine)->resume_point = 0;                                              \
+            return COROUTINE_FAILED;                                                    \
+        }                                                                               \
+    } while (0)
+
+#define COROUTINE_EXIT(coroutine)                                                       \
+    do {                                                                                \
+        (coroutine)->resume_point = 0;                                                  \
+        return COROUTINE_DONE;                                                          \
+    } while (0)
+
+#define COROUTINE_ARGUMENT(coroutine) ((uint32_t) (uintptr_t) (coroutine))
+
+
+/**********************************************************************************/
+/*                                      Enums                                     */
+/**********************************************************************************/
+
+typedef enum {
+    COROUTINE_WAITING = 0,
+    COROUTINE_DONE,
+    COROUTINE_FAILED
+} Coroutine_State;
+
+typedef enum {
+    COROUTINE_DELAY_IDLE = 0,
+    COROUTINE_DELAY_ARMED,
+    COROUTINE_DELAY_EXPIRED,
+    COROUTINE_DELAY_FAILED
+} Coroutine_Delay_State;
+
+
+/**********************************************************************************/
+/*                                 Callback Types                                 */
+/**********************************************************************************/
+
+struct Coroutine;
+
+typedef Coroutine_State (*Coroutine_Function_t)(struct Coroutine *coroutine);
+
+
+/**********************************************************************************/
+/*                              Configuration Structs                             */
+/**********************************************************************************/
+
+typedef struct Coroutine {
+    Coroutine_Function_t  function;
+    void                  *context;
+    uint32_t              resume_point;
+    volatile uint32_t     scheduled;
+    volatile uint32_t     delay_state;          /* Coroutine_Delay_State */
+    Timer_Wheel_Handle_t  delay_timer;
+    uint8_t               state;
+} Coroutine_t;
+
+
+/**********************************************************************************/
+/*                               Function Prototypes                              */
+/**********************************************************************************/
+
+Status  Coroutine_Start            (Coroutine_t *coroutine, Coroutine_Function_t function, void *context);
+Status  Coroutine_Wake             (Coroutine_t *coroutine);
+void    Coroutine_Resume           (uint32_t argument);
+uint8_t Coroutine_Is_Done          (const Coroutine_t *coroutine);
+uint8_t Coroutine_Has_Failed       (const Coroutine_t *coroutine);
+uint8_t Coroutine_Delay_Elapsed    (Coroutine_t *coroutine, uint32_t ticks);
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
\ No newline at end of file
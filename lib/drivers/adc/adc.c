@@ -0,0 +1,360 @@
+#include "adc.h"
+
+/**********************************************************************************/
+/*                                 Static Variables                               */
+/**********************************************************************************/
+
+static ADC_Config_t      *adc_config;
+static uint8_t           adc_oversampling;
+static uint8_t           adc_conversions;
+static ADC_Callback_t    adc_callback;
+static volatile uint16_t adc_dma_buffer[ADC_MAX_CONVERSIONS] __attribute__((aligned(4)));
+static volatile uint16_t adc_results[ADC_MAX_CONVERSIONS]    = {0};
+static volatile uint32_t adc_sequence                        = 0;
+static volatile uint32_t adc_frame_count                     = 0;
+static volatile uint32_t adc_overrun_count                   = 0;
+
+
+/**********************************************************************************/
+/*                                Static Functions                                */
+/**********************************************************************************/
+
+/**
+ * @brief  Maps an external ADC channel to the GPIO pin it is sampled from
+ * @param  channel: ADC channel to be mapped
+ * @param  port:    Pointer to store the GPIO port of the channel
+ * @param  pin:     Pointer to store the GPIO pin of the channel
+ * @retval Status indicating success, or error if the channel is internal
+ */
+static Status ADC_Get_Channel_Pin(ADC_Channel channel, GPIO_t **port, GPIO_Pin *pin) {
+    if (channel <= ADC_CHANNEL_7) {
+        *port = GPIOA;
+        *pin  = (GPIO_Pin) channel;
+    } else if (channel <= ADC_CHANNEL_9) {
+        *port = GPIOB;
+        *pin  = (GPIO_Pin) (channel - ADC_CHANNEL_8);
+    } else if (channel <= ADC_CHANNEL_15) {
+        *port = GPIOC;
+        *pin  = (GPIO_Pin) (channel - ADC_CHANNEL_10);
+    } else {
+        return ERROR;
+    }
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Restarts the DMA stream at the beginning of the conversion buffer
+ * @note   Called after an ADC overrun or DMA transfer error, both of which stop DMA
+ *         requests until the stream is re-armed
+ */
+static void ADC_DMA_Rearm(void) {
+    //disable stream and wait for the current transfer to finish
+    DMA2_Stream0->CR &= ~(DMA_SxCR_EN);
+    while (DMA2_Stream0->CR & DMA_SxCR_EN);
+
+    //clear stream flags and restart from the first conversion
+    DMA2->LIFCR          = DMA_FLAG_ALL;
+    DMA2_Stream0->NDTR   = adc_conversions;
+    DMA2_Stream0->CR    |= DMA_SxCR_EN;
+
+    //clear overrun so the next trigger starts a new sequence
+    ADC1->SR &= ~(ADC_SR_OVR);
+}
+
+
+/**********************************************************************************/
+/*                               ADC Core Functions                               */
+/**********************************************************************************/
+
+/**
+ * @brief  Initialises ADC1 to scan a channel sequence on every TIM1 compare event
+ * @note   Each channel is converted oversampling times back to back, and DMA2 stream 0
+ *         writes the whole sequence into a circular buffer. A single interrupt per frame
+ *         averages the samples, so no CPU time is spent per conversion
+ * @note   The trigger channel must be running in PWM mode via @ref TIM1_Servo_Init or
+ *         @ref TIM1_PWM_Output_Init. With a rising edge the sequence starts at the
+ *         beginning of each PWM frame, and with a falling edge it starts as the pulse ends
+ * @note   Conversions are not started until @ref ADC_Start is called
+ * @param  config: Pointer to ADC_Config structure containing ADC settings
+ * @retval Status indicating success or invalid parameters
+ */
+Status ADC_Init(ADC_Config_t *config) {
+    //validate config struct pointer and channel list
+    if (!config || !(config->channels) || config->channel_count < 1
+        || config->channel_count > ADC_MAX_CONVERSIONS) {
+        return INVALID_PARAM;
+    }
+
+    //validate trigger and conversion settings
+    if (config->trigger < ADC_TRIGGER_TIM1_CC1 || config->trigger > ADC_TRIGGER_TIM1_CC3
+        || config->trigger_edge < ADC_TRIGGER_EDGE_RISING || config->trigger_edge > ADC_TRIGGER_EDGE_FALLING
+        || config->sample_time < ADC_SAMPLE_3_CYCLES || config->sample_time > ADC_SAMPLE_480_CYCLES
+        || config->resolution < ADC_RESOLUTION_12 || config->resolution > ADC_RESOLUTION_6) {
+        return INVALID_PARAM;
+    }
+
+    //validate oversampling fits within one regular sequence
+    uint8_t oversampling = config->oversampling ? config->oversampling : 1U;
+    if ((uint32_t) config->channel_count * oversampling > ADC_MAX_CONVERSIONS) {
+        return INVALID_PARAM;
+    }
+
+    //validate channels
+    uint8_t internal_channels = 0;
+    for (uint8_t i = 0; i < config->channel_count; i++) {
+        ADC_Channel channel = config->channels[i];
+        if (channel == ADC_CHANNEL_VREFINT || channel == ADC_CHANNEL_TEMP_SENSOR) {
+            internal_channels = 1U;
+        } else if (channel < ADC_CHANNEL_0 || channel > ADC_CHANNEL_15) {
+            return INVALID_PARAM;
+        }
+    }
+
+    //claim DMA and overrun interrupts
+    NVIC_Latency_Class latency_class = config->interrupt_class ? config->interrupt_class
+                                                               : NVIC_CLASS_FEEDBACK;
+    if (NVIC_Request_IRQ(DMA2_Stream0_IRQn, latency_class, ADC1) != SUCCESS
+        || NVIC_Request_IRQ(ADC_IRQn, latency_class, ADC1) != SUCCESS) {
+        return INVALID_PARAM;
+    }
+
+    //configure external channel pins as analog inputs
+    for (uint8_t i = 0; i < config->channel_count; i++) {
+        GPIO_Config_t channel_gpio = {.mode = GPIO_MODE_ANALOG};
+        if (ADC_Get_Channel_Pin(config->channels[i], &channel_gpio.port, &channel_gpio.pin) != SUCCESS) {
+            continue;
+        }
+        if (GPIO_Init(&channel_gpio) != SUCCESS) {
+            return INVALID_PARAM;
+        }
+    }
+
+    adc_config       = config;
+    adc_callback     = config->callback;
+    adc_oversampling = oversampling;
+    adc_conversions  = (config->channel_count * oversampling);
+
+    //enable ADC1 and DMA2 clocks
+    RCC->APB2ENR |= RCC_APB2ENR_ADC1EN;
+    RCC->AHB1ENR |= RCC_AHB1ENR_DMA2EN;
+
+    //power down ADC while it is being configured
+    ADC1->CR2 &= ~(ADC_CR2_ADON);
+
+    //divide APB2 by 4 to keep ADCCLK within its 36MHz limit at the maximum APB2 clock
+    ADC1_COMMON->CCR &= ~(ADC_CCR_ADCPRE | ADC_CCR_TSVREFE);
+    ADC1_COMMON->CCR |= ADC_CCR_ADCPRE_DIV4;
+    if (internal_channels) {
+        ADC1_COMMON->CCR |= ADC_CCR_TSVREFE;
+    }
+
+    //configure scan mode, resolution and overrun interrupt
+    ADC1->CR1 = (ADC_CR1_SCAN | ADC_CR1_OVRIE | (((uint32_t) config->resolution) << ADC_CR1_RES_Pos));
+
+    //configure sample time of each channel
+    for (uint8_t i = 0; i < config->channel_count; i++) {
+        uint32_t channel = config->channels[i];
+        volatile uint32_t *smpr = (channel >= 10U) ? &ADC1->SMPR1 : &ADC1->SMPR2;
+        uint8_t smpr_shift = ((channel % 10U) * 3U);
+        *smpr &= ~(SET_THREE << smpr_shift);
+        *smpr |= (((uint32_t) config->sample_time) << smpr_shift);
+    }
+
+    //build regular sequence with each channel repeated for oversampling
+    uint32_t sqr[3] = {0};
+    for (uint8_t rank = 0; rank < adc_conversions; rank++) {
+        uint32_t channel = config->channels[rank / oversampling];
+        sqr[rank / 6U] |= (channel << ((rank % 6U) * 5U));
+    }
+    ADC1->SQR3 = sqr[0];
+    ADC1->SQR2 = sqr[1];
+    ADC1->SQR1 = (sqr[2] | (((uint32_t) (adc_conversions - 1U)) << ADC_SQR1_L_Pos));
+
+    //configure DMA2 stream 0 channel 0 as a circular peripheral-to-memory transfer
+    DMA2_Stream0->CR &= ~(DMA_SxCR_EN);
+    while (DMA2_Stream0->CR & DMA_SxCR_EN);
+    DMA2->LIFCR        = DMA_FLAG_ALL;
+    DMA2_Stream0->PAR  = (uint32_t) (uintptr_t) &ADC1->DR;
+    DMA2_Stream0->M0AR = (uint32_t) (uintptr_t) adc_dma_buffer;
+    DMA2_Stream0->NDTR = adc_conversions;
+    DMA2_Stream0->FCR  = 0;
+    DMA2_Stream0->CR   = (DMA_SxCR_PL_HIGH | DMA_SxCR_MSIZE_16 | DMA_SxCR_PSIZE_16 | DMA_SxCR_MINC
+                          | DMA_SxCR_CIRC | DMA_SxCR_DIR_P2M | DMA_SxCR_TCIE | DMA_SxCR_TEIE);
+    DMA2_Stream0->CR  |= DMA_SxCR_EN;
+
+    //select TIM1 compare trigger, keep DMA requests running and power up ADC
+    ADC1->CR2 = (ADC_CR2_DMA | ADC_CR2_DDS | (((uint32_t) (config->trigger - ADC_TRIGGER_TIM1_CC1))
+                 << ADC_CR2_EXTSEL_Pos) | ADC_CR2_ADON);
+
+    //enable interrupts
+    ADC1->SR = 0;
+    NVIC_Enable_IRQ(DMA2_Stream0_IRQn);
+    NVIC_Enable_IRQ(ADC_IRQn);
+
+    DSB();
+    return SUCCESS;
+}
+
+/**
+ * @brief  Starts converting the sequence on every trigger event
+ * @retval Status indicating success, or error if the ADC has not been initialised
+ */
+Status ADC_Start(void) {
+    //validate initialisation
+    if (!adc_config) {
+        return ERROR;
+    }
+
+    //enable external trigger on the configured edge
+    ADC1->CR2 &= ~(ADC_CR2_EXTEN);
+    ADC1->CR2 |= (adc_config->trigger_edge == ADC_TRIGGER_EDGE_RISING) ? ADC_CR2_EXTEN_RISING
+                                                                       : ADC_CR2_EXTEN_FALLING;
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Stops converting on trigger events
+ * @note   A sequence already in progress completes and is averaged as normal
+ * @retval Status indicating success, or error if the ADC has not been initialised
+ */
+Status ADC_Stop(void) {
+    //validate initialisation
+    if (!adc_config) {
+        return ERROR;
+    }
+
+    ADC1->CR2 &= ~(ADC_CR2_EXTEN);
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Reads the latest averaged result of one channel in the sequence
+ * @param  index: Position of the channel within the configured channel list
+ * @param  value: Pointer to store the averaged conversion result
+ * @retval Status indicating success or invalid parameters
+ */
+Status ADC_Read(uint8_t index, uint16_t *value) {
+    //validate initialisation, index and value pointer
+    if (!adc_config || index >= adc_config->channel_count || !value) {
+        return INVALID_PARAM;
+    }
+
+    //a single halfword read is atomic
+    *value = adc_results[index];
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Reads a consistent snapshot of the averaged result of every channel
+ * @note   The read is retried if a frame completed part way through
+ * @param  values: Array of at least channel_count elements to store the results
+ * @retval Status indicating success or invalid parameters
+ */
+Status ADC_Read_All(uint16_t *values) {
+    //validate initialisation and values pointer
+    if (!adc_config || !values) {
+        return INVALID_PARAM;
+    }
+
+    uint32_t sequence;
+    do {
+        sequence = adc_sequence;
+        for (uint8_t i = 0; i < adc_config->channel_count; i++) {
+            values[i] = adc_results[i];
+        }
+    } while ((sequence & 1U) || (sequence != adc_sequence));
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Returns the number of completed conversion frames
+ * @retval Number of frames averaged since initialisation
+ */
+uint32_t ADC_Get_Frame_Count(void) {
+    return adc_frame_count;
+}
+
+/**
+ * @brief  Returns the number of frames lost to an ADC overrun or DMA transfer error
+ * @retval Number of times the conversion stream has been re-armed
+ */
+uint32_t ADC_Get_Overrun_Count(void) {
+    return adc_overrun_count;
+}
+
+/**
+ * @brief  Replaces the function called once per completed frame
+ * @note   Modules that need to observe every frame should save the current callback via
+ *         @ref ADC_Get_Callback and call it from their own so that callbacks chain
+ * @param  callback: Function called from interrupt context, or NULL to remove the callback
+ * @retval Status indicating success, or error if the ADC has not been initialised
+ */
+Status ADC_Register_Callback(ADC_Callback_t callback) {
+    //validate initialisation
+    if (!adc_config) {
+        return ERROR;
+    }
+
+    adc_callback = callback;
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Returns the function called once per completed frame
+ * @retval Current frame callback, or NULL if none is registered
+ */
+ADC_Callback_t ADC_Get_Callback(void) {
+    return adc_callback;
+}
+
+
+/**********************************************************************************/
+/*                             ADC Interrupt Handlers                             */
+/**********************************************************************************/
+
+/** @brief  Handles ADC1 overrun interrupts */
+void ADC_IRQHandler(void) {
+    if (ADC1->SR & ADC_SR_OVR) {
+        adc_overrun_count++;
+        ADC_DMA_Rearm();
+    }
+}
+
+/** @brief  Handles DMA2 stream 0 interrupts, averaging one frame of conversions */
+void DMA2_Stream0_IRQHandler(void) {
+    uint32_t flags = DMA2->LISR;
+
+    //transfer error disables the stream
+    if (flags & DMA_FLAG_TEIF) {
+        adc_overrun_count++;
+        ADC_DMA_Rearm();
+        return;
+    }
+
+    if (flags & DMA_FLAG_TCIF) {
+        DMA2->LIFCR = DMA_FLAG_TCIF;
+
+        //the next frame cannot overwrite the buffer until the following trigger event
+        adc_sequence++;
+        const volatile uint16_t *sample = adc_dma_buffer;
+        for (uint8_t i = 0; i < adc_config->channel_count; i++) {
+            uint32_t sum = 0;
+            for (uint8_t k = 0; k < adc_oversampling; k++) {
+                sum += *sample++;
+            }
+            adc_results[i] = (uint16_t) (sum / adc_oversampling);
+        }
+        adc_sequence++;
+        adc_frame_count++;
+
+        if (adc_callback) {
+            adc_callback(adc_results, adc_config->channel_count);
+        }
+    }
+}
\ No newline at end of file
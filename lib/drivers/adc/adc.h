@@ -0,0 +1,121 @@
+#ifndef __ADC_H
+#define __ADC_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../../utils/utils.h"
+#include "../gpio/gpio.h"
+
+
+/**********************************************************************************/
+/*                                     Defines                                    */
+/**********************************************************************************/
+
+#define ADC_MAX_CONVERSIONS     16U
+
+
+/**********************************************************************************/
+/*                                      Enums                                     */
+/**********************************************************************************/
+
+typedef enum {
+    ADC_CHANNEL_0 = 0,
+    ADC_CHANNEL_1,
+    ADC_CHANNEL_2,
+    ADC_CHANNEL_3,
+    ADC_CHANNEL_4,
+    ADC_CHANNEL_5,
+    ADC_CHANNEL_6,
+    ADC_CHANNEL_7,
+    ADC_CHANNEL_8,
+    ADC_CHANNEL_9,
+    ADC_CHANNEL_10,
+    ADC_CHANNEL_11,
+    ADC_CHANNEL_12,
+    ADC_CHANNEL_13,
+    ADC_CHANNEL_14,
+    ADC_CHANNEL_15,
+    ADC_CHANNEL_VREFINT = 17,
+    ADC_CHANNEL_TEMP_SENSOR
+} ADC_Channel;
+
+typedef enum {
+    ADC_TRIGGER_TIM1_CC1 = 1,
+    ADC_TRIGGER_TIM1_CC2,
+    ADC_TRIGGER_TIM1_CC3
+} ADC_Trigger;
+
+typedef enum {
+    ADC_TRIGGER_EDGE_RISING = 0,
+    ADC_TRIGGER_EDGE_FALLING
+} ADC_Trigger_Edge;
+
+typedef enum {
+    ADC_SAMPLE_3_CYCLES = 0,
+    ADC_SAMPLE_15_CYCLES,
+    ADC_SAMPLE_28_CYCLES,
+    ADC_SAMPLE_56_CYCLES,
+    ADC_SAMPLE_84_CYCLES,
+    ADC_SAMPLE_112_CYCLES,
+    ADC_SAMPLE_144_CYCLES,
+    ADC_SAMPLE_480_CYCLES
+} ADC_Sample_Time;
+
+typedef enum {
+    ADC_RESOLUTION_12 = 0,
+    ADC_RESOLUTION_10,
+    ADC_RESOLUTION_8,
+    ADC_RESOLUTION_6
+} ADC_Resolution;
+
+
+/**********************************************************************************/
+/*                                 Callback Types                                 */
+/**********************************************************************************/
+
+typedef void (*ADC_Callback_t)(const volatile uint16_t *results, uint8_t channel_count);
+
+
+/**********************************************************************************/
+/*                              Configuration Structs                             */
+/**********************************************************************************/
+
+typedef struct {
+/************************************ Required ************************************/
+    ADC_Channel         *channels;
+    uint8_t             channel_count;
+    ADC_Trigger         trigger;
+/************************************ Optional ************************************/
+    uint8_t             oversampling;
+    ADC_Sample_Time     sample_time;
+    ADC_Resolution      resolution;
+    ADC_Trigger_Edge    trigger_edge;
+    NVIC_Latency_Class  interrupt_class;
+    ADC_Callback_t      callback;
+} ADC_Config_t;
+
+
+/**********************************************************************************/
+/*                               Function Prototypes                              */
+/**********************************************************************************/
+
+Status   ADC_Init                    (ADC_Config_t *adc_config);
+Status   ADC_Start                   (void);
+Status   ADC_Stop                    (void);
+Status   ADC_Read                    (uint8_t index, uint16_t *value);
+Status   ADC_Read_All                (uint16_t *values);
+uint32_t ADC_Get_Frame_Count         (void);
+uint32_t ADC_Get_Overrun_Count       (void);
+Status   ADC_Register_Callback       (ADC_Callback_t callback);
+ADC_Callback_t ADC_Get_Callback      (void);
+void     ADC_IRQHandler              (void);
+void     DMA2_Stream0_IRQHandler     (void);
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
\ No newline at end of file
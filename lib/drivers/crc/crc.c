@@ -0,0 +1,32 @@
+#include "crc.h"
+
+/**********************************************************************************/
+/*                               CRC Core Functions                               */
+/**********************************************************************************/
+
+/**
+ * @brief  Calculates the CRC-32 of a block of words with the hardware CRC unit
+ * @note   Uses the unit's fixed polynomial (0x04C11DB7) and initial value (0xFFFFFFFF) with
+ *         no reflection, processing one word per AHB cycle. The CRC unit is not reentrant,
+ *         so it must not be used from both thread and interrupt context
+ * @param  data:   Pointer to the data, aligned to 4 bytes
+ * @param  length: Number of bytes, a multiple of 4
+ * @retval CRC of the data, or 0 if the pointer, alignment or length is invalid
+ */
+uint32_t CRC_Calculate(const void *data, uint32_t length) {
+    //validate data pointer, alignment and length
+    if (!data || (((uintptr_t) data) & 0x3UL) || (length & 0x3UL)) {
+        return 0;
+    }
+
+    //enable CRC clock and reset the calculation
+    RCC->AHB1ENR |= RCC_AHB1ENR_CRCEN;
+    CRC->CR = CRC_CR_RESET;
+
+    const uint32_t *word = (const uint32_t *) data;
+    for (uint32_t i = 0; i < (length / 4U); i++) {
+        CRC->DR = word[i];
+    }
+
+    return CRC->DR;
+}
\ No newline at end of file
@@ -0,0 +1,22 @@
+#ifndef __CRC_H
+#define __CRC_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../../utils/utils.h"
+
+
+/**********************************************************************************/
+/*                               Function Prototypes                              */
+/**********************************************************************************/
+
+uint32_t CRC_Calculate               (const void *data, uint32_t length);
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
\ No newline at end of file
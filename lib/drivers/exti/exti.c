@@ -0,0 +1,318 @@
+#include "exti.h"
+
+/**********************************************************************************/
+/*                                 Static Variables                               */
+/**********************************************************************************/
+
+static EXTI_Callback_t   exti_callbacks[16] = {0};
+static uint8_t           exti_classes[16]   = {0};  /* NVIC_Latency_Class of each initialised line */
+static volatile uint32_t exti_entry_cycles  = 0;
+
+
+/**********************************************************************************/
+/*                                Static Functions                                */
+/**********************************************************************************/
+
+/**
+ * @brief  Maps a GPIO port to its SYSCFG EXTICR source selection
+ * @param  port: Pointer to GPIO_t structure containing the GPIO port
+ * @retval EXTICR source selection, or 0xFF if the port is invalid
+ */
+static uint8_t EXTI_Get_Port_Source(GPIO_t *port) {
+    if (port == GPIOA) {
+        return 0x0U;
+    } else if (port == GPIOB) {
+        return 0x1U;
+    } else if (port == GPIOC) {
+        return 0x2U;
+    } else if (port == GPIOD) {
+        return 0x3U;
+    } else if (port == GPIOE) {
+        return 0x4U;
+    } else if (port == GPIOH) {
+        return 0x7U;
+    } else {
+        return 0xFFU;
+    }
+}
+
+/**
+ * @brief  Maps an EXTI line to the NVIC interrupt it is routed to
+ * @param  pin: EXTI line number
+ * @retval Interrupt number of the line
+ */
+static IRQn_t EXTI_Get_IRQn(GPIO_Pin pin) {
+    if (pin <= GPIO_PIN_4) {
+        return (IRQn_t) (EXTI0_IRQn + pin);
+    } else if (pin <= GPIO_PIN_9) {
+        return EXTI9_5_IRQn;
+    } else {
+        return EXTI15_10_IRQn;
+    }
+}
+
+/**
+ * @brief  Maps an EXTI line to the mask of every line sharing its interrupt
+ * @param  pin: EXTI line number
+ * @retval Mask of the lines routed to the same interrupt as the line
+ */
+static uint32_t EXTI_Get_Group_Mask(GPIO_Pin pin) {
+    if (pin <= GPIO_PIN_4) {
+        return (SET_ONE << pin);
+    } else if (pin <= GPIO_PIN_9) {
+        return (0x1FUL << 5U);
+    } else {
+        return (0x3FUL << 10U);
+    }
+}
+
+/**
+ * @brief  Finds the most urgent latency class among the other initialised lines of a group
+ * @param  pin: EXTI line whose group is searched, excluded from the search
+ * @retval Most urgent latency class, or NVIC_CLASS_DEFAULT if no other line is initialised
+ */
+static NVIC_Latency_Class EXTI_Get_Group_Class(GPIO_Pin pin) {
+    uint32_t others = (EXTI_Get_Group_Mask(pin) & ~(SET_ONE << pin));
+    uint8_t  urgent = NVIC_CLASS_DEFAULT;
+
+    for (uint8_t line = 0; line < 16U; line++) {
+        if ((others & (SET_ONE << line)) && exti_classes[line]
+            && (urgent == NVIC_CLASS_DEFAULT || exti_classes[line] < urgent)) {
+            urgent = exti_classes[line];
+        }
+    }
+
+    return (NVIC_Latency_Class) urgent;
+}
+
+/**
+ * @brief  Clears and dispatches all pending EXTI lines within a group
+ * @note   Lines are found with CLZ so the scan costs one iteration per pending line rather
+ *         than one per line in the group. Pending bits are cleared before any callback runs
+ *         so that an edge arriving during a callback is not lost
+ * @note   The cycle counter is sampled on entry for @ref EXTI_Get_Entry_Cycles, and restored
+ *         on exit so a nested dispatch does not overwrite the timestamp of the one it preempted
+ * @param  line_mask: Mask of the EXTI lines sharing the calling interrupt handler
+ */
+static void EXTI_Dispatch(uint32_t line_mask) {
+    uint32_t preempted_cycles = exti_entry_cycles;
+    exti_entry_cycles = Cycle_Counter_Get();
+
+    uint32_t pending = (EXTI->PR & EXTI->IMR & line_mask);
+    EXTI->PR = pending;
+
+    while (pending) {
+        uint32_t line = (31U - CLZ(pending));
+        pending &= ~(SET_ONE << line);
+        if (exti_callbacks[line]) {
+            exti_callbacks[line]((GPIO_Pin) line);
+        }
+    }
+
+    exti_entry_cycles = preempted_cycles;
+}
+
+
+/**********************************************************************************/
+/*                               EXTI Core Functions                              */
+/**********************************************************************************/
+
+/**
+ * @brief  Routes a GPIO pin to its EXTI line and enables the line's interrupt
+ * @note   The GPIO pin should be configured as an input via @ref GPIO_Init beforehand
+ * @note   EXTI lines 5-9 and 10-15 share an interrupt, which runs at the most urgent class
+ *         of its lines. A line requesting a less urgent class than one already initialised in
+ *         its group is refused, as it would delay that line's interrupt
+ * @param  exti_config: Pointer to EXTI_Config structure containing EXTI settings
+ * @retval Status indicating success, invalid parameters, or error if the class would lower
+ *         the priority of a more urgent line sharing the interrupt
+ */
+Status EXTI_Init(EXTI_Config_t *exti_config) {
+    //validate config struct pointer
+    if (!exti_config) {
+        return INVALID_PARAM;
+    }
+
+    //validate pin, trigger and callback
+    if (exti_config->pin < 0 || exti_config->pin > 15 || exti_config->trigger < EXTI_TRIGGER_RISING
+        || exti_config->trigger > EXTI_TRIGGER_BOTH || !(exti_config->callback)) {
+        return INVALID_PARAM;
+    }
+
+    //validate port
+    uint8_t port_source = EXTI_Get_Port_Source(exti_config->port);
+    if (port_source == 0xFFU) {
+        return INVALID_PARAM;
+    }
+
+    //a shared interrupt is never moved below the most urgent class already on it
+    IRQn_t irqn = EXTI_Get_IRQn(exti_config->pin);
+    NVIC_Latency_Class latency_class = exti_config->interrupt_class ? exti_config->interrupt_class
+                                                                    : NVIC_CLASS_FEEDBACK;
+    NVIC_Latency_Class group_class   = EXTI_Get_Group_Class(exti_config->pin);
+    if (group_class && latency_class > group_class) {
+        return ERROR;
+    }
+
+    //claim interrupt, lines in a shared group may be requested repeatedly by the EXTI driver
+    if (NVIC_Request_IRQ(irqn, latency_class, EXTI) != SUCCESS) {
+        return INVALID_PARAM;
+    }
+
+    //enable SYSCFG clock
+    RCC->APB2ENR |= RCC_APB2ENR_SYSCFGEN;
+
+    //mask line while it is being configured
+    uint32_t line = (SET_ONE << exti_config->pin);
+    EXTI->IMR &= ~(line);
+
+    //route port to EXTI line
+    volatile uint32_t *exticr = (&SYSCFG->EXTICR1 + (exti_config->pin / 4U));
+    uint8_t exticr_shift = ((exti_config->pin % 4U) * 4U);
+    *exticr &= ~(SET_FOUR << exticr_shift);
+    *exticr |= (((uint32_t) port_source) << exticr_shift);
+
+    //configure edge selection
+    EXTI->RTSR &= ~(line);
+    EXTI->FTSR &= ~(line);
+    if (exti_config->trigger == EXTI_TRIGGER_RISING || exti_config->trigger == EXTI_TRIGGER_BOTH) {
+        EXTI->RTSR |= line;
+    }
+    if (exti_config->trigger == EXTI_TRIGGER_FALLING || exti_config->trigger == EXTI_TRIGGER_BOTH) {
+        EXTI->FTSR |= line;
+    }
+
+    //register callback and class
+    exti_callbacks[exti_config->pin] = exti_config->callback;
+    exti_classes[exti_config->pin]   = (uint8_t) latency_class;
+
+    //clear any stale pending request and unmask line
+    EXTI->PR = line;
+    EXTI->IMR |= line;
+
+    //enable interrupt
+    NVIC_Enable_IRQ(irqn);
+
+    DSB();
+    return SUCCESS;
+}
+
+/**
+ * @brief  Disables an EXTI line and removes its callback
+ * @note   The shared interrupt of lines 5-9 or 10-15 is only disabled once every line in
+ *         the group has been deinitialised, until then it moves to the most urgent class of
+ *         the lines that remain
+ * @param  pin: EXTI line to be deinitialised
+ * @retval Status indicating success or invalid parameters
+ */
+Status EXTI_Deinit(GPIO_Pin pin) {
+    //validate pin
+    if (pin < 0 || pin > 15) {
+        return INVALID_PARAM;
+    }
+
+    //mask line and clear edge selection
+    uint32_t line = (SET_ONE << pin);
+    EXTI->IMR  &= ~(line);
+    EXTI->RTSR &= ~(line);
+    EXTI->FTSR &= ~(line);
+    EXTI->PR    = line;
+
+    //remove callback and class
+    exti_callbacks[pin] = 0;
+    exti_classes[pin]   = 0;
+
+    //disable interrupt once no lines in the group remain
+    NVIC_Latency_Class group_class = EXTI_Get_Group_Class(pin);
+    if (!(EXTI->IMR & EXTI_Get_Group_Mask(pin))) {
+        NVIC_Release_IRQ(EXTI_Get_IRQn(pin), EXTI);
+    } else if (group_class) {
+        NVIC_Request_IRQ(EXTI_Get_IRQn(pin), group_class, EXTI);
+    }
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Replaces the callback of an initialised EXTI line
+ * @param  pin:      EXTI line whose callback will be replaced
+ * @param  callback: Function called from interrupt context when the line triggers
+ * @retval Status indicating success or invalid parameters
+ */
+Status EXTI_Register_Callback(GPIO_Pin pin, EXTI_Callback_t callback) {
+    //validate pin and callback
+    if (pin < 0 || pin > 15 || !callback) {
+        return INVALID_PARAM;
+    }
+
+    exti_callbacks[pin] = callback;
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Raises an EXTI line's interrupt from software
+ * @param  pin: EXTI line to be triggered
+ * @retval Status indicating success or invalid parameters
+ */
+Status EXTI_Software_Trigger(GPIO_Pin pin) {
+    //validate pin
+    if (pin < 0 || pin > 15) {
+        return INVALID_PARAM;
+    }
+
+    EXTI->SWIER |= (SET_ONE << pin);
+
+    return SUCCESS;
+}
+
+
+/**
+ * @brief  Reads the cycle counter as sampled on entry to the EXTI handler now dispatching
+ * @note   Only meaningful from within an EXTI callback, and only once the cycle counter has
+ *         been enabled via @ref Cycle_Counter_Init
+ * @retval Cycle counter value at handler entry
+ */
+uint32_t EXTI_Get_Entry_Cycles(void) {
+    return exti_entry_cycles;
+}
+
+
+/**********************************************************************************/
+/*                             EXTI Interrupt Handlers                            */
+/**********************************************************************************/
+
+/** @brief  Handles EXTI line 0 interrupts */
+void EXTI0_IRQHandler(void) {
+    EXTI_Dispatch(SET_ONE << 0U);
+}
+
+/** @brief  Handles EXTI line 1 interrupts */
+void EXTI1_IRQHandler(void) {
+    EXTI_Dispatch(SET_ONE << 1U);
+}
+
+/** @brief  Handles EXTI line 2 interrupts */
+void EXTI2_IRQHandler(void) {
+    EXTI_Dispatch(SET_ONE << 2U);
+}
+
+/** @brief  Handles EXTI line 3 interrupts */
+void EXTI3_IRQHandler(void) {
+    EXTI_Dispatch(SET_ONE << 3U);
+}
+
+/** @brief  Handles EXTI line 4 interrupts */
+void EXTI4_IRQHandler(void) {
+    EXTI_Dispatch(SET_ONE << 4U);
+}
+
+/** @brief  Handles EXTI lines 5 to 9 interrupts */
+void EXTI9_5_IRQHandler(void) {
+    EXTI_Dispatch(0x1FUL << 5U);
+}
+
+/** @brief  Handles EXTI lines 10 to 15 interrupts */
+void EXTI15_10_IRQHandler(void) {
+    EXTI_Dispatch(0x3FUL << 10U);
+}
@@ -0,0 +1,67 @@
+#ifndef __EXTI_H
+#define __EXTI_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../../utils/utils.h"
+#include "../gpio/gpio.h"
+
+
+/**********************************************************************************/
+/*                                      Enums                                     */
+/**********************************************************************************/
+
+typedef enum {
+    EXTI_TRIGGER_RISING = 1,
+    EXTI_TRIGGER_FALLING,
+    EXTI_TRIGGER_BOTH
+} EXTI_Trigger;
+
+
+/**********************************************************************************/
+/*                                 Callback Types                                 */
+/**********************************************************************************/
+
+typedef void (*EXTI_Callback_t)(GPIO_Pin pin);
+
+
+/**********************************************************************************/
+/*                              Configuration Structs                             */
+/**********************************************************************************/
+
+typedef struct {
+/************************************ Required ************************************/
+    GPIO_t          *port;
+    GPIO_Pin        pin;
+    EXTI_Trigger    trigger;
+    EXTI_Callback_t callback;
+/************************************ Optional ************************************/
+    NVIC_Latency_Class interrupt_class;
+} EXTI_Config_t;
+
+
+/**********************************************************************************/
+/*                               Function Prototypes                              */
+/**********************************************************************************/
+
+Status   EXTI_Init               (EXTI_Config_t *exti_config);
+Status   EXTI_Deinit             (GPIO_Pin pin);
+Status   EXTI_Register_Callback  (GPIO_Pin pin, EXTI_Callback_t callback);
+Status   EXTI_Software_Trigger   (GPIO_Pin pin);
+uint32_t EXTI_Get_Entry_Cycles   (void);
+void     EXTI0_IRQHandler        (void);
+void     EXTI1_IRQHandler        (void);
+void     EXTI2_IRQHandler        (void);
+void     EXTI3_IRQHandler        (void);
+void     EXTI4_IRQHandler        (void);
+void     EXTI9_5_IRQHandler      (void);
+void     EXTI15_10_IRQHandler    (void);
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,144 @@
+#include "flash.h"
+
+/**********************************************************************************/
+/*                                Static Functions                                */
+/**********************************************************************************/
+
+/**
+ * @brief  Unlocks the flash control register
+ */
+static void FLASH_Unlock(void) {
+    if (FLASH->CR & FLASH_CR_LOCK) {
+        FLASH->KEYR = FLASH_KEYR_KEY1;
+        FLASH->KEYR = FLASH_KEYR_KEY2;
+    }
+}
+
+/**
+ * @brief  Waits for the current flash operation, locks the control register and flushes
+ *         the data cache
+ * @retval Status indicating success, or error if the operation failed
+ */
+static Status FLASH_Finish(void) {
+    while (FLASH->SR & FLASH_SR_BSY);
+
+    uint32_t errors = (FLASH->SR & (FLASH_SR_OPERR | FLASH_SR_WRPERR | FLASH_SR_PGAERR
+                                    | FLASH_SR_PGPERR | FLASH_SR_PGSERR | FLASH_SR_RDERR));
+    FLASH->SR  = (errors | FLASH_SR_EOP);
+    FLASH->CR &= ~(FLASH_CR_PG | FLASH_CR_SER | FLASH_CR_SNB);
+    FLASH->CR |= FLASH_CR_LOCK;
+
+    //flush data cache so reads observe the new contents
+    if (FLASH->ACR & FLASH_ACR_DCEN) {
+        FLASH->ACR &= ~(FLASH_ACR_DCEN);
+        FLASH->ACR |= FLASH_ACR_DCRST;
+        FLASH->ACR &= ~(FLASH_ACR_DCRST);
+        FLASH->ACR |= FLASH_ACR_DCEN;
+    }
+
+    return errors ? ERROR : SUCCESS;
+}
+
+
+/**********************************************************************************/
+/*                              FLASH Core Functions                              */
+/**********************************************************************************/
+
+/**
+ * @brief  Erases one flash sector to all ones
+ * @note   The F411 has a single flash bank, so instruction fetches from flash stall for the
+ *         duration of the erase (up to 2s for a 128KB sector). Interrupts are delayed rather
+ *         than lost; the TIM1 break input acts in hardware and is unaffected
+ * @note   The sector must not contain the running program. Sectors used for storage should
+ *         be excluded from the image via board_upload.maximum_size in platformio.ini
+ * @param  sector: Sector to be erased
+ * @retval Status indicating success, invalid parameters, or error if the erase failed
+ */
+Status FLASH_Erase_Sector(FLASH_Sector sector) {
+    //validate sector
+    if (sector < FLASH_SECTOR_0 || sector > FLASH_SECTOR_7) {
+        return INVALID_PARAM;
+    }
+
+    FLASH_Unlock();
+    while (FLASH->SR & FLASH_SR_BSY);
+
+    //erase with 32-bit parallelism
+    FLASH->CR &= ~(FLASH_CR_PSIZE | FLASH_CR_SNB);
+    FLASH->CR |= (FLASH_CR_PSIZE_32 | FLASH_CR_SER | (((uint32_t) sector) << FLASH_CR_SNB_Pos));
+    FLASH->CR |= FLASH_CR_STRT;
+
+    return FLASH_Finish();
+}
+
+/**
+ * @brief  Programs a block of data into erased flash
+ * @note   Flash bits can only be cleared by programming, so the destination must have been
+ *         erased via @ref FLASH_Erase_Sector. Data is written as words, so the address and
+ *         length must both be multiples of 4
+ * @param  address: Destination address in flash
+ * @param  data:    Pointer to the data to be written
+ * @param  length:  Number of bytes to be written
+ * @retval Status indicating success, invalid parameters, or error if programming failed
+ */
+Status FLASH_Program(uint32_t address, const void *data, uint32_t length) {
+    //validate data, alignment and range
+    if (!data || (address & 0x3UL) || (length & 0x3UL) || address < FLASH_BASE
+        || (address + length - 1U) > FLASH_END) {
+        return INVALID_PARAM;
+    }
+
+    FLASH_Unlock();
+    while (FLASH->SR & FLASH_SR_BSY);
+
+    //program with 32-bit parallelism
+    FLASH->CR &= ~(FLASH_CR_PSIZE | FLASH_CR_SER | FLASH_CR_SNB);
+    FLASH->CR |= (FLASH_CR_PSIZE_32 | FLASH_CR_PG);
+
+    const uint8_t *source = (const uint8_t *) data;
+    for (uint32_t offset = 0; offset < length; offset += 4U) {
+        uint32_t word = (((uint32_t) source[offset]) | (((uint32_t) source[offset + 1U]) << 8U)
+                         | (((uint32_t) source[offset + 2U]) << 16U) | (((uint32_t) source[offset + 3U]) << 24U));
+        *(volatile uint32_t *) (uintptr_t) (address + offset) = word;
+        while (FLASH->SR & FLASH_SR_BSY);
+        if (FLASH->SR & (FLASH_SR_PGAERR | FLASH_SR_PGPERR | FLASH_SR_PGSERR | FLASH_SR_WRPERR)) {
+            break;
+        }
+    }
+
+    return FLASH_Finish();
+}
+
+/**
+ * @brief  Returns the start address of a flash sector
+ * @param  sector: Sector whose address is required
+ * @retval Start address of the sector, or 0 if the sector is invalid
+ */
+uint32_t FLASH_Get_Sector_Address(FLASH_Sector sector) {
+    if (sector >= FLASH_SECTOR_0 && sector <= FLASH_SECTOR_3) {
+        return (FLASH_BASE + (((uint32_t) sector) * 0x4000UL));
+    } else if (sector == FLASH_SECTOR_4) {
+        return (FLASH_BASE + 0x10000UL);
+    } else if (sector >= FLASH_SECTOR_5 && sector <= FLASH_SECTOR_7) {
+        return (FLASH_BASE + (((uint32_t) (sector - FLASH_SECTOR_4)) * 0x20000UL));
+    } else {
+        return 0;
+    }
+}
+
+/**
+ * @brief  Returns the size of a flash sector
+ * @param  sector: Sector whose size is required
+ * @retval Size of the sector in bytes, or 0 if the sector is invalid
+ */
+uint32_t FLASH_Get_Sector_Size(FLASH_Sector sector) {
+    if (sector >= FLASH_SECTOR_0 && sector <= FLASH_SECTOR_3) {
+        return 0x4000UL;
+    } else if (sector == FLASH_SECTOR_4) {
+        return 0x10000UL;
+    } else if (sector >= FLASH_SECTOR_5 && sector <= FLASH_SECTOR_7) {
+        return 0x20000UL;
+    } else {
+        return 0;
+    }
+}
\ No newline at end of file
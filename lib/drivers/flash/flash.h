@@ -0,0 +1,48 @@
+#ifndef __FLASH_H
+#define __FLASH_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../../utils/utils.h"
+
+
+/**********************************************************************************/
+/*                                     Defines                                    */
+/**********************************************************************************/
+
+#define FLASH_ERASED_WORD       0xFFFFFFFFUL
+
+
+/**********************************************************************************/
+/*                                      Enums                                     */
+/**********************************************************************************/
+
+typedef enum {
+    FLASH_SECTOR_0 = 0,
+    FLASH_SECTOR_1,
+    FLASH_SECTOR_2,
+    FLASH_SECTOR_3,
+    FLASH_SECTOR_4,
+    FLASH_SECTOR_5,
+    FLASH_SECTOR_6,
+    FLASH_SECTOR_7
+} FLASH_Sector;
+
+
+/**********************************************************************************/
+/*                               Function Prototypes                              */
+/**********************************************************************************/
+
+Status   FLASH_Erase_Sector          (FLASH_Sector sector);
+Status   FLASH_Program               (uint32_t address, const void *data, uint32_t length);
+uint32_t FLASH_Get_Sector_Address    (FLASH_Sector sector);
+uint32_t FLASH_Get_Sector_Size       (FLASH_Sector sector);
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
\ No newline at end of file
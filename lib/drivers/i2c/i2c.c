@@ -0,0 +1,785 @@
+#include "i2c.h"
+
+/**********************************************************************************/
+/*                                 Static Variables                               */
+/**********************************************************************************/
+
+/* DMA1 streams serving each I2C, only the receive stream raises interrupts */
+typedef struct {
+    DMA_Stream_t *rx_stream;
+    DMA_Stream_t *tx_stream;
+    IRQn_t       rx_irqn;
+    IRQn_t       tx_irqn;
+    uint8_t      rx_number;
+    uint8_t      tx_number;
+    uint8_t      rx_channel;
+    uint8_t      tx_channel;
+} I2C_DMA_Map_t;
+
+static const I2C_DMA_Map_t i2c_dma_map[3] = {
+    {DMA1_Stream5, DMA1_Stream6, DMA1_Stream5_IRQn, DMA1_Stream6_IRQn, 5U, 6U, 1U, 1U},
+    {DMA1_Stream2, DMA1_Stream7, DMA1_Stream2_IRQn, DMA1_Stream7_IRQn, 2U, 7U, 7U, 7U},
+    {DMA1_Stream1, DMA1_Stream4, DMA1_Stream1_IRQn, DMA1_Stream4_IRQn, 1U, 4U, 1U, 3U}
+};
+
+/* bit offset of each stream's flags within DMA_xISR and DMA_xIFCR */
+static const uint8_t i2c_dma_flag_shift[4] = {0U, 6U, 16U, 22U};
+
+typedef struct {
+    I2C_Transaction_t *head;
+    I2C_Transaction_t *tail;
+    I2C_Init_Config_t *init_config;
+    uint32_t          cr2;
+    uint32_t          ccr;
+    uint32_t          trise;
+    uint32_t          timeout_us;
+    uint64_t          start_time;
+    uint32_t          basepri;
+    uint8_t           reading;
+    volatile uint8_t  recovering;
+    uint8_t           initialised;
+    volatile uint32_t reset_pending;
+} I2C_Bus_State_t;
+
+static I2C_Bus_State_t i2c_buses[3] = {0};
+
+
+/**********************************************************************************/
+/*                                Static Functions                                */
+/**********************************************************************************/
+
+static I2C_Index Get_I2C_Index(I2C_t *instance) {
+    if (instance == I2C1) {
+        return I2C1_Index;
+    } else if (instance == I2C2) {
+        return I2C2_Index;
+    } else if (instance == I2C3) {
+        return I2C3_Index;
+    } else {
+        return I2C_Index_Error;
+    }
+}
+
+static uint32_t I2C_DMA_Get_Flags(uint8_t stream) {
+    uint32_t isr = (stream < 4U) ? DMA1->LISR : DMA1->HISR;
+    return ((isr >> i2c_dma_flag_shift[stream & 3U]) & DMA_FLAG_ALL);
+}
+
+static void I2C_DMA_Clear_Flags(uint8_t stream, uint32_t flags) {
+    if (stream < 4U) {
+        DMA1->LIFCR = (flags << i2c_dma_flag_shift[stream]);
+    } else {
+        DMA1->HIFCR = (flags << i2c_dma_flag_shift[stream - 4U]);
+    }
+}
+
+static void I2C_DMA_Stop(DMA_Stream_t *stream) {
+    stream->CR &= ~(DMA_SxCR_EN);
+    while (stream->CR & DMA_SxCR_EN);
+}
+
+static void I2C_DMA_Start(DMA_Stream_t *stream, uint8_t number, uint8_t channel, I2C_t *instance,
+                          const void *buffer, uint16_t length, uint32_t direction) {
+    I2C_DMA_Clear_Flags(number, DMA_FLAG_ALL);
+    stream->PAR  = (uint32_t) (uintptr_t) &instance->DR;
+    stream->M0AR = (uint32_t) (uintptr_t) buffer;
+    stream->NDTR = length;
+    stream->FCR  = 0;
+    stream->CR   = ((((uint32_t) channel) << DMA_SxCR_CHSEL_Pos) | DMA_SxCR_PL_HIGH | DMA_SxCR_MINC | direction
+                    | ((direction == DMA_SxCR_DIR_P2M) ? (DMA_SxCR_TCIE | DMA_SxCR_TEIE) : 0));
+    stream->CR  |= DMA_SxCR_EN;
+}
+
+/* busy-waits half a 100kHz bit period on the cycle counter */
+static void I2C_Delay_Half_Bit(void) {
+    uint32_t start  = Cycle_Counter_Get();
+    uint32_t cycles = (g_sys_clk_freq / 200000U);
+    while ((Cycle_Counter_Get() - start) < cycles);
+}
+
+static void I2C_Set_Pin_Mode(GPIO_t *port, GPIO_Pin pin, GPIO_Mode mode) {
+    port->MODER = ((port->MODER & ~(SET_TWO << (pin * 2U))) | (((uint32_t) mode) << (pin * 2U)));
+}
+
+/**
+ * @brief  Waits for a requested stop condition to go out
+ * @note   Bounded to 100us so a held bus cannot stall the caller
+ * @param  instance: Pointer to the I2C peripheral
+ * @retval Status indicating success, or error if the stop was not sent
+ */
+static Status I2C_Wait_Stop(I2C_t *instance) {
+    uint32_t start  = Cycle_Counter_Get();
+    uint32_t cycles = (g_sys_clk_freq / 10000U);
+    while (instance->CR1 & I2C_CR1_STOP) {
+        if ((Cycle_Counter_Get() - start) > cycles) {
+            return ERROR;
+        }
+    }
+    return SUCCESS;
+}
+
+/**
+ * @brief  Frees a stuck bus and reprograms the peripheral
+ * @note   With the peripheral disabled SCL is clocked by hand until a slave holding SDA low
+ *         has shifted out its byte, at most nine clocks, then a stop condition is sent so
+ *         every slave returns to idle. Takes around 100us
+ * @param  i2c_index: Index of the bus
+ * @retval Status indicating success, or error if SDA is still held low
+ */
+static Status I2C_Bus_Reset(I2C_Index i2c_index) {
+    I2C_Bus_State_t *bus           = &i2c_buses[i2c_index];
+    I2C_Init_Config_t *init_config = bus->init_config;
+    I2C_t *instance                = init_config->instance;
+
+    //take the pins from the peripheral, both released high
+    instance->CR1 = 0;
+    init_config->scl_port->BSRR = (SET_ONE << init_config->scl_pin);
+    init_config->sda_port->BSRR = (SET_ONE << init_config->sda_pin);
+    I2C_Set_Pin_Mode(init_config->scl_port, init_config->scl_pin, GPIO_MODE_OUTPUT);
+    I2C_Set_Pin_Mode(init_config->sda_port, init_config->sda_pin, GPIO_MODE_OUTPUT);
+    I2C_Delay_Half_Bit();
+
+    //clock out whatever byte a slave is still sending
+    for (uint8_t i = 0; i < 9U && !(init_config->sda_port->IDR & (SET_ONE << init_config->sda_pin)); i++) {
+        init_config->scl_port->BSRR = (SET_ONE << (init_config->scl_pin + 16U));
+        I2C_Delay_Half_Bit();
+        init_config->scl_port->BSRR = (SET_ONE << init_config->scl_pin);
+        I2C_Delay_Half_Bit();
+    }
+
+    //stop condition, SDA rising while SCL is high
+    init_config->scl_port->BSRR = (SET_ONE << (init_config->scl_pin + 16U));
+    I2C_Delay_Half_Bit();
+    init_config->sda_port->BSRR = (SET_ONE << (init_config->sda_pin + 16U));
+    I2C_Delay_Half_Bit();
+    init_config->scl_port->BSRR = (SET_ONE << init_config->scl_pin);
+    I2C_Delay_Half_Bit();
+    init_config->sda_port->BSRR = (SET_ONE << init_config->sda_pin);
+    I2C_Delay_Half_Bit();
+    uint32_t sda_released = (init_config->sda_port->IDR & (SET_ONE << init_config->sda_pin));
+
+    //hand the pins back and reprogram from reset
+    I2C_Set_Pin_Mode(init_config->scl_port, init_config->scl_pin, GPIO_MODE_AF);
+    I2C_Set_Pin_Mode(init_config->sda_port, init_config->sda_pin, GPIO_MODE_AF);
+    instance->CR1   = I2C_CR1_SWRST;
+    instance->CR1   = 0;
+    instance->CR2   = bus->cr2;
+    instance->CCR   = bus->ccr;
+    instance->TRISE = bus->trise;
+    instance->CR1   = I2C_CR1_PE;
+
+    return sda_released ? SUCCESS : ERROR;
+}
+
+/**
+ * @brief  Starts the transaction at the head of a bus queue with a start condition
+ * @note   Called with the bus queue protected, either inside a critical section or from
+ *         a bus interrupt
+ * @param  i2c_index: Index of the bus
+ */
+static void I2C_Start_Transaction(I2C_Index i2c_index) {
+    I2C_Bus_State_t *bus           = &i2c_buses[i2c_index];
+    I2C_Transaction_t *transaction = bus->head;
+
+    bus->start_time     = TIM5_Time_Get_Us();
+    bus->reading        = (!transaction->tx_length && transaction->rx_length) ? 1U : 0;
+    transaction->status = I2C_TRANSACTION_ACTIVE;
+    bus->init_config->instance->CR1 |= I2C_CR1_START;
+}
+
+/**
+ * @brief  Takes a bus from its interrupts so it can be reset from thread level
+ * @note   Runs with the bus interrupts masked by BASEPRI, so only the bus class and below
+ *         are held off, and only for long enough to stop DMA and the interrupt sources. The
+ *         bus handlers ignore the bus until @ref I2C_Release, and new transactions are
+ *         queued without being started
+ * @param  i2c_index:      Index of the bus
+ * @param  timed_out_only: Only claim if the active transaction has run past the bus timeout
+ * @param  claimed:        Receives the active transaction, or 0 if the bus was idle
+ * @retval Status indicating success, or error if the bus was not claimed
+ */
+static Status I2C_Claim(I2C_Index i2c_index, uint8_t timed_out_only, I2C_Transaction_t **claimed) {
+    const I2C_DMA_Map_t *map = &i2c_dma_map[i2c_index];
+    I2C_Bus_State_t *bus     = &i2c_buses[i2c_index];
+    I2C_t *instance          = bus->init_config->instance;
+    Status status            = ERROR;
+
+    uint32_t basepri = ENTER_CRITICAL_BASEPRI(bus->basepri);
+    if (!bus->recovering && (!timed_out_only
+        || (bus->head && (TIM5_Time_Get_Us() - bus->start_time) >= bus->timeout_us))) {
+        bus->recovering = 1U;
+        instance->CR2   = (bus->cr2 & ~(I2C_CR2_ITEVTEN | I2C_CR2_ITERREN));
+        I2C_DMA_Stop(map->tx_stream);
+        I2C_DMA_Stop(map->rx_stream);
+        *claimed = bus->head;
+        status   = SUCCESS;
+    }
+    EXIT_CRITICAL_BASEPRI(basepri);
+
+    return status;
+}
+
+/**
+ * @brief  Resets a claimed bus, ends the claimed transaction and starts the next one
+ * @note   The reset takes around 100us and runs with interrupts enabled. Only handing the
+ *         bus back to its interrupts is done under BASEPRI
+ * @param  i2c_index: Index of the bus
+ * @param  claimed:   Transaction returned by @ref I2C_Claim, or 0
+ * @param  status:    Final I2C_Transaction_Status of the claimed transaction
+ * @retval Status indicating success, or error if SDA is still held low
+ */
+static Status I2C_Release(I2C_Index i2c_index, I2C_Transaction_t *claimed, uint32_t status) {
+    I2C_Bus_State_t *bus = &i2c_buses[i2c_index];
+    Status bus_status    = I2C_Bus_Reset(i2c_index);
+
+    //the claimed transaction is still at the head, as nothing is removed while recovering
+    Deferred_Work_t callback = 0;
+    uint32_t argument        = 0;
+    uint32_t basepri         = ENTER_CRITICAL_BASEPRI(bus->basepri);
+    if (claimed) {
+        callback        = claimed->callback;
+        argument        = claimed->argument;
+        bus->head       = claimed->next;
+        claimed->status = status;
+    }
+    if (bus->head) {
+        I2C_Start_Transaction(i2c_index);
+    } else {
+        bus->tail = 0;
+    }
+    bus->recovering = 0;
+    EXIT_CRITICAL_BASEPRI(basepri);
+
+    if (callback) {
+        Deferred_Post(callback, argument);
+    }
+
+    return bus_status;
+}
+
+/**
+ * @brief  Runs a bus reset left pending by the bus interrupts
+ * @note   Runs from PendSV, or from @ref I2C_Check_Timeout if the post was dropped. Whichever
+ *         takes the pending flag first resets the bus and starts the next transaction
+ * @param  argument: Index of the bus
+ */
+static void I2C_Reset_Work(uint32_t argument) {
+    I2C_Index i2c_index = (I2C_Index) argument;
+    if (ATOMIC_EXCHANGE(&i2c_buses[i2c_index].reset_pending, 0)) {
+        I2C_Release(i2c_index, 0, 0);
+    }
+}
+
+/**
+ * @brief  Ends the active transaction of a bus and starts the next one
+ * @note   A stop condition must already have been requested for DONE and NACK. TIMEOUT and
+ *         ERROR need a bus reset, which takes around 100us, so the bus is taken from its
+ *         interrupts as by @ref I2C_Claim and the reset is posted to PendSV. Queued
+ *         transactions start once it has run
+ * @param  i2c_index: Index of the bus
+ * @param  status:    Final I2C_Transaction_Status of the transaction
+ */
+static void I2C_Finish(I2C_Index i2c_index, uint32_t status) {
+    const I2C_DMA_Map_t *map       = &i2c_dma_map[i2c_index];
+    I2C_Bus_State_t *bus           = &i2c_buses[i2c_index];
+    I2C_Transaction_t *transaction = bus->head;
+    I2C_t *instance                = bus->init_config->instance;
+
+    //drop DMA, buffer interrupts and LAST
+    instance->CR2 = bus->cr2;
+    I2C_DMA_Stop(map->tx_stream);
+    I2C_DMA_Stop(map->rx_stream);
+
+    //mark the bus for recovery and silence it until the reset has run
+    uint8_t reset = (status == I2C_TRANSACTION_TIMEOUT || status == I2C_TRANSACTION_ERROR
+                     || I2C_Wait_Stop(instance) != SUCCESS);
+    if (reset) {
+        bus->recovering    = 1U;
+        bus->reset_pending = 1U;
+        instance->CR2      = (bus->cr2 & ~(I2C_CR2_ITEVTEN | I2C_CR2_ITERREN));
+    }
+
+    //start the next transaction before signalling this one
+    Deferred_Work_t callback = transaction->callback;
+    uint32_t argument        = transaction->argument;
+    bus->head = transaction->next;
+    if (!bus->head) {
+        bus->tail = 0;
+    } else if (!reset) {
+        I2C_Start_Transaction(i2c_index);
+    }
+    transaction->status = status;
+
+    if (callback) {
+        Deferred_Post(callback, argument);
+    }
+
+    //a dropped post leaves the reset to the next I2C_Check_Timeout
+    if (reset) {
+        Deferred_Post(I2C_Reset_Work, (uint32_t) i2c_index);
+    }
+}
+
+
+/**********************************************************************************/
+/*                                I2C Core Functions                              */
+/**********************************************************************************/
+
+/**
+ * @brief  Initialises an I2C peripheral as a DMA bus master
+ * @note   Configures SCL and SDA as open-drain alternate function pins, and frees the bus
+ *         in case a slave was left mid-byte by a reset. Claims the event, error and DMA
+ *         stream interrupts with the peripheral as owner
+ * @note   I2C1 uses DMA1 streams 5 and 6, I2C2 DMA1 streams 2 and 7, and I2C3 DMA1 streams
+ *         1 and 4. The APB1 clock must be at least 2MHz, or 4MHz for 400kHz
+ * @note   Transaction timeouts are measured on the TIM5 time base, which is started here
+ *         via @ref TIM5_Time_Init if it is not already running. A bus error is recovered from
+ *         PendSV, claimed via @ref Deferred_Init
+ * @param  init_config: Pointer to I2C_Init_Config structure, which must stay valid
+ * @retval Status indicating success, invalid parameters, or error if an interrupt is taken,
+ *         or the time base or PendSV is unavailable
+ */
+Status I2C_Init(I2C_Init_Config_t *init_config) {
+    //validate config struct pointer, instance and pins
+    if (!init_config || !init_config->scl_port || !init_config->sda_port) {
+        return INVALID_PARAM;
+    }
+    I2C_Index i2c_index = Get_I2C_Index(init_config->instance);
+    if (i2c_index == I2C_Index_Error) {
+        return INVALID_PARAM;
+    }
+
+    //validate speed against the APB1 clock
+    uint32_t freq_mhz = (g_apb1_clk_freq / SEC_TO_MICRO);
+    if (init_config->speed < I2C_SPEED_STANDARD || init_config->speed > I2C_SPEED_FAST
+        || freq_mhz < ((init_config->speed == I2C_SPEED_FAST) ? 4U : 2U) || freq_mhz > 50U) {
+        return INVALID_PARAM;
+    }
+
+    //claim interrupts, the transmit stream only to mark it as in use
+    const I2C_DMA_Map_t *map = &i2c_dma_map[i2c_index];
+    IRQn_t ev_irqn = (i2c_index == I2C1_Index) ? I2C1_EV_IRQn : (i2c_index == I2C2_Index) ? I2C2_EV_IRQn
+                                                                                         : I2C3_EV_IRQn;
+    IRQn_t er_irqn = (i2c_index == I2C1_Index) ? I2C1_ER_IRQn : (i2c_index == I2C2_Index) ? I2C2_ER_IRQn
+                                                                                         : I2C3_ER_IRQn;
+    NVIC_Latency_Class latency_class = init_config->interrupt_class ? init_config->interrupt_class
+                                                                    : NVIC_CLASS_COMMS;
+    if (NVIC_Request_IRQ(ev_irqn, latency_class, init_config->instance) != SUCCESS
+        || NVIC_Request_IRQ(er_irqn, latency_class, init_config->instance) != SUCCESS
+        || NVIC_Request_IRQ(map->rx_irqn, latency_class, init_config->instance) != SUCCESS
+        || NVIC_Request_IRQ(map->tx_irqn, latency_class, init_config->instance) != SUCCESS) {
+        return ERROR;
+    }
+
+    //transaction timeouts need a running time base, and bus resets are run as deferred work
+    if (((!(RCC->APB1ENR & RCC_APB1ENR_TIM5EN) || !(TIM5->CR1 & TIM_CR1_CEN))
+         && TIM5_Time_Init(0) != SUCCESS)
+        || Deferred_Init() != SUCCESS) {
+        return ERROR;
+    }
+
+    //configure SCL and SDA as open-drain alternate function pins
+    GPIO_Config_t pin_gpio = {
+        .port         = init_config->scl_port,
+        .pin          = init_config->scl_pin,
+        .mode         = GPIO_MODE_AF,
+        .output_type  = GPIO_OUTPUT_OPEN_DRAIN,
+        .output_speed = GPIO_OUTPUT_SPEED_HIGH,
+        .pupd         = init_config->pupd,
+        .alt_function = init_config->alt_function
+    };
+    if (GPIO_Init(&pin_gpio) != SUCCESS) {
+        return INVALID_PARAM;
+    }
+    pin_gpio.port = init_config->sda_port;
+    pin_gpio.pin  = init_config->sda_pin;
+    if (GPIO_Init(&pin_gpio) != SUCCESS) {
+        return INVALID_PARAM;
+    }
+
+    //enable I2C and DMA1 clocks, and the cycle counter used to time bus recovery
+    RCC->APB1ENR |= (i2c_index == I2C1_Index) ? RCC_APB1ENR_I2C1EN : (i2c_index == I2C2_Index) ? RCC_APB1ENR_I2C2EN
+                                                                                              : RCC_APB1ENR_I2C3EN;
+    RCC->AHB1ENR |= RCC_AHB1ENR_DMA1EN;
+    if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA)) {
+        Cycle_Counter_Init();
+    }
+
+    //derive SCL timing, fast mode uses a 2:1 low to high ratio
+    I2C_Bus_State_t *bus = &i2c_buses[i2c_index];
+    bus->cr2 = (freq_mhz | I2C_CR2_ITEVTEN | I2C_CR2_ITERREN);
+    if (init_config->speed == I2C_SPEED_FAST) {
+        uint32_t ccr = (g_apb1_clk_freq / (3U * 400000U));
+        bus->ccr     = (I2C_CCR_FS | (ccr ? ccr : 1U));
+        bus->trise   = (((freq_mhz * 300U) / 1000U) + 1U);
+    } else {
+        uint32_t ccr = (g_apb1_clk_freq / (2U * 100000U));
+        bus->ccr     = ((ccr < 4U) ? 4U : ccr);
+        bus->trise   = (freq_mhz + 1U);
+    }
+    bus->init_config = init_config;
+    bus->timeout_us  = init_config->timeout_us ? init_config->timeout_us : I2C_DEFAULT_TIMEOUT_US;
+    bus->basepri     = NVIC_Class_To_BASEPRI(latency_class);
+    bus->head          = 0;
+    bus->tail          = 0;
+    bus->recovering    = 0;
+    bus->reset_pending = 0;
+
+    I2C_DMA_Stop(map->rx_stream);
+    I2C_DMA_Stop(map->tx_stream);
+    I2C_Bus_Reset(i2c_index);
+    bus->initialised = 1U;
+
+    NVIC_Enable_IRQ(ev_irqn);
+    NVIC_Enable_IRQ(er_irqn);
+    NVIC_Enable_IRQ(map->rx_irqn);
+
+    DSB();
+    return SUCCESS;
+}
+
+/**
+ * @brief  Queues a transaction on an I2C bus
+ * @note   A transaction writes tx_length bytes, then if rx_length is non-zero reads rx_length
+ *         bytes after a repeated start, so a register read never releases the bus. With both
+ *         lengths zero it only addresses the slave, to probe for it
+ * @note   Transactions run in submission order, each started from the interrupt that ends
+ *         the previous one. The callback is posted to PendSV via @ref Deferred_Post once the
+ *         transaction has ended. A transaction that overruns the timeout is aborted with
+ *         TIMEOUT by @ref I2C_Check_Timeout, which is also run here
+ * @param  instance:    Pointer to the I2C peripheral
+ * @param  transaction: Pointer to the transaction, which with its buffers must stay valid
+ *                      until its status is no longer QUEUED or ACTIVE
+ * @retval Status indicating success, invalid parameters, or error if the bus is not
+ *         initialised, the transaction is already queued, or PendSV is unavailable
+ */
+Status I2C_Transfer(I2C_t *instance, I2C_Transaction_t *transaction) {
+    //validate instance and transaction
+    I2C_Index i2c_index = Get_I2C_Index(instance);
+    if (i2c_index == I2C_Index_Error || !transaction || transaction->address > 0x7FU
+        || (transaction->tx_length && !transaction->tx_buffer)
+        || (transaction->rx_length && !transaction->rx_buffer)) {
+        return INVALID_PARAM;
+    }
+
+    //validate bus and transaction state
+    I2C_Bus_State_t *bus = &i2c_buses[i2c_index];
+    if (!bus->initialised || transaction->status == I2C_TRANSACTION_QUEUED
+        || transaction->status == I2C_TRANSACTION_ACTIVE) {
+        return ERROR;
+    }
+
+    //callbacks are run as deferred work
+    if (transaction->callback && Deferred_Init() != SUCCESS) {
+        return ERROR;
+    }
+
+    //a stalled transaction would hold up the queue
+    I2C_Check_Timeout(instance);
+
+    transaction->next   = 0;
+    transaction->status = I2C_TRANSACTION_QUEUED;
+
+    //append, starting the bus if it is idle
+    uint32_t primask = ENTER_CRITICAL();
+    if (bus->tail) {
+        bus->tail->next = transaction;
+        bus->tail       = transaction;
+    } else {
+        bus->head = transaction;
+        bus->tail = transaction;
+        if (!bus->recovering) {
+            I2C_Start_Transaction(i2c_index);
+        }
+    }
+    EXIT_CRITICAL(primask);
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Removes a queued transaction from an I2C bus before it starts
+ * @note   A transaction that is already active cannot be withdrawn, it ends as normal or by
+ *         @ref I2C_Check_Timeout. A cancelled transaction returns to IDLE without its callback
+ * @param  instance:    Pointer to the I2C peripheral
+ * @param  transaction: Pointer to the transaction
+ * @retval Status indicating success, invalid parameters, or error if the transaction is active
+ */
+Status I2C_Cancel(I2C_t *instance, I2C_Transaction_t *transaction) {
+    //validate instance and transaction
+    I2C_Index i2c_index = Get_I2C_Index(instance);
+    if (i2c_index == I2C_Index_Error || !transaction) {
+        return INVALID_PARAM;
+    }
+
+    I2C_Bus_State_t *bus = &i2c_buses[i2c_index];
+    Status status        = SUCCESS;
+
+    //unlink, the bus interrupts only ever remove the active head
+    uint32_t primask = ENTER_CRITICAL();
+    if (transaction->status == I2C_TRANSACTION_QUEUED) {
+        I2C_Transaction_t *previous = 0;
+        I2C_Transaction_t *entry    = bus->head;
+        while (entry && entry != transaction) {
+            previous = entry;
+            entry    = entry->next;
+        }
+        if (entry) {
+            if (previous) {
+                previous->next = entry->next;
+            } else {
+                bus->head = entry->next;
+            }
+            if (bus->tail == entry) {
+                bus->tail = previous;
+            }
+            transaction->status = I2C_TRANSACTION_IDLE;
+        }
+    } else if (transaction->status == I2C_TRANSACTION_ACTIVE) {
+        status = ERROR;
+    }
+    EXIT_CRITICAL(primask);
+
+    return status;
+}
+
+/**
+ * @brief  Aborts the active transaction if it has run past the bus timeout
+ * @note   A slave stretching the clock forever or a lost interrupt would otherwise hold the
+ *         queue. The aborted transaction ends with TIMEOUT and the bus is reset as by
+ *         @ref I2C_Recover before the next one starts. Call periodically, e.g. once per frame
+ * @note   Only the bus interrupts are masked, and only while the transaction is taken from
+ *         them. The bus reset itself runs with interrupts enabled
+ * @note   Also runs a reset left pending by a bus error, in case its post to PendSV was
+ *         dropped because the deferred work queue was full
+ * @param  instance: Pointer to the I2C peripheral
+ * @retval Status indicating success, invalid parameters, or error if a transaction was aborted
+ */
+Status I2C_Check_Timeout(I2C_t *instance) {
+    //validate instance and initialisation
+    I2C_Index i2c_index = Get_I2C_Index(instance);
+    if (i2c_index == I2C_Index_Error || !i2c_buses[i2c_index].initialised) {
+        return INVALID_PARAM;
+    }
+
+    //a pending reset holds the queue until it has run
+    I2C_Reset_Work((uint32_t) i2c_index);
+
+    I2C_Transaction_t *claimed;
+    if (I2C_Claim(i2c_index, 1U, &claimed) != SUCCESS) {
+        return SUCCESS;
+    }
+    I2C_Release(i2c_index, claimed, I2C_TRANSACTION_TIMEOUT);
+
+    return ERROR;
+}
+
+/**
+ * @brief  Frees a stuck I2C bus
+ * @note   Aborts the active transaction with ERROR, clocks SCL until SDA is released, sends
+ *         a stop condition and resets the peripheral. Queued transactions then carry on
+ * @note   Only the bus interrupts are masked, and only while the transaction is taken from
+ *         them. The bus reset itself runs with interrupts enabled
+ * @param  instance: Pointer to the I2C peripheral
+ * @retval Status indicating success, invalid parameters, or error if SDA is still held low
+ *         or the bus is already being recovered
+ */
+Status I2C_Recover(I2C_t *instance) {
+    //validate instance and initialisation
+    I2C_Index i2c_index = Get_I2C_Index(instance);
+    if (i2c_index == I2C_Index_Error || !i2c_buses[i2c_index].initialised) {
+        return INVALID_PARAM;
+    }
+
+    I2C_Transaction_t *claimed;
+    if (I2C_Claim(i2c_index, 0, &claimed) != SUCCESS) {
+        return ERROR;
+    }
+
+    return I2C_Release(i2c_index, claimed, I2C_TRANSACTION_ERROR);
+}
+
+/**
+ * @brief  Reads the progress of a transaction
+ * @param  transaction: Pointer to the transaction
+ * @retval Transaction status
+ */
+I2C_Transaction_Status I2C_Get_Status(const I2C_Transaction_t *transaction) {
+    return transaction ? (I2C_Transaction_Status) transaction->status : I2C_TRANSACTION_IDLE;
+}
+
+
+/**********************************************************************************/
+/*                             I2C Interrupt Handlers                             */
+/**********************************************************************************/
+
+/**
+ * @brief  Steps the active transaction through address, write and repeated start
+ * @note   Data moves by DMA, so only SB, ADDR and BTF reach here, plus RXNE for single
+ *         byte reads, which cannot use DMA
+ * @param  i2c_index: Index of the bus
+ */
+static void I2C_EV_IRQHandler(I2C_Index i2c_index) {
+    const I2C_DMA_Map_t *map       = &i2c_dma_map[i2c_index];
+    I2C_Bus_State_t *bus           = &i2c_buses[i2c_index];
+    I2C_Transaction_t *transaction = bus->head;
+    I2C_t *instance                = bus->init_config->instance;
+    uint32_t sr1                   = instance->SR1;
+
+    //being reset from thread level
+    if (bus->recovering) {
+        return;
+    }
+
+    //nothing active, release the bus
+    if (!transaction || transaction->status != I2C_TRANSACTION_ACTIVE) {
+        (void) instance->SR2;
+        if (sr1 & (I2C_SR1_SB | I2C_SR1_BTF)) {
+            instance->CR1 |= I2C_CR1_STOP;
+        }
+        return;
+    }
+
+    //start sent, address the slave
+    if (sr1 & I2C_SR1_SB) {
+        instance->DR = ((((uint32_t) transaction->address) << 1U) | bus->reading);
+        return;
+    }
+
+    //slave acknowledged, arm the data phase before ADDR is cleared by reading SR2
+    if (sr1 & I2C_SR1_ADDR) {
+        if (!bus->reading) {
+            if (transaction->tx_length) {
+                I2C_DMA_Start(map->tx_stream, map->tx_number, map->tx_channel, instance,
+                              transaction->tx_buffer, transaction->tx_length, DMA_SxCR_DIR_M2P);
+                instance->CR2 = (bus->cr2 | I2C_CR2_DMAEN);
+                (void) instance->SR2;
+            } else {
+                (void) instance->SR2;
+                instance->CR1 |= I2C_CR1_STOP;
+                I2C_Finish(i2c_index, I2C_TRANSACTION_DONE);
+            }
+        } else if (transaction->rx_length == 1U) {
+            instance->CR1 &= ~(I2C_CR1_ACK);
+            (void) instance->SR2;
+            instance->CR1 |= I2C_CR1_STOP;
+            instance->CR2  = (bus->cr2 | I2C_CR2_ITBUFEN);
+        } else {
+            instance->CR1 |= I2C_CR1_ACK;
+            I2C_DMA_Start(map->rx_stream, map->rx_number, map->rx_channel, instance,
+                          transaction->rx_buffer, transaction->rx_length, DMA_SxCR_DIR_P2M);
+            instance->CR2 = (bus->cr2 | I2C_CR2_DMAEN | I2C_CR2_LAST);
+            (void) instance->SR2;
+        }
+        return;
+    }
+
+    //last byte written, either turn around with a repeated start or stop
+    if ((sr1 & I2C_SR1_BTF) && !bus->reading && !map->tx_stream->NDTR) {
+        instance->CR2 = bus->cr2;
+        if (transaction->rx_length) {
+            bus->reading   = 1U;
+            instance->CR1 |= I2C_CR1_START;
+        } else {
+            instance->CR1 |= I2C_CR1_STOP;
+            I2C_Finish(i2c_index, I2C_TRANSACTION_DONE);
+        }
+        return;
+    }
+
+    //single byte read, stop was requested when the address was acknowledged
+    if ((sr1 & I2C_SR1_RXNE) && bus->reading) {
+        transaction->rx_buffer[0] = (uint8_t) instance->DR;
+        I2C_Finish(i2c_index, I2C_TRANSACTION_DONE);
+    }
+}
+
+/**
+ * @brief  Ends the active transaction on a NACK or bus error
+ * @param  i2c_index: Index of the bus
+ */
+static void I2C_ER_IRQHandler(I2C_Index i2c_index) {
+    I2C_Bus_State_t *bus = &i2c_buses[i2c_index];
+    I2C_t *instance      = bus->init_config->instance;
+
+    uint32_t errors = (instance->SR1 & (I2C_SR1_BERR | I2C_SR1_ARLO | I2C_SR1_AF | I2C_SR1_OVR));
+    instance->SR1   = (~errors & 0xFFFFUL);
+    if (!errors || !bus->head || bus->recovering) {
+        return;
+    }
+
+    if (errors == I2C_SR1_AF) {
+        instance->CR1 |= I2C_CR1_STOP;
+        I2C_Finish(i2c_index, I2C_TRANSACTION_NACK);
+    } else {
+        I2C_Finish(i2c_index, I2C_TRANSACTION_ERROR);
+    }
+}
+
+/**
+ * @brief  Ends a multi-byte read once DMA has stored its last byte
+ * @note   LAST has already made the peripheral NACK the final byte
+ * @param  i2c_index: Index of the bus
+ */
+static void I2C_DMA_IRQHandler(I2C_Index i2c_index) {
+    const I2C_DMA_Map_t *map = &i2c_dma_map[i2c_index];
+    I2C_Bus_State_t *bus     = &i2c_buses[i2c_index];
+
+    uint32_t flags = I2C_DMA_Get_Flags(map->rx_number);
+    I2C_DMA_Clear_Flags(map->rx_number, flags);
+    if (!(flags & (DMA_FLAG_TCIF | DMA_FLAG_TEIF)) || !bus->head || bus->recovering) {
+        return;
+    }
+
+    if (flags & DMA_FLAG_TEIF) {
+        I2C_Finish(i2c_index, I2C_TRANSACTION_ERROR);
+    } else {
+        bus->init_config->instance->CR1 |= I2C_CR1_STOP;
+        I2C_Finish(i2c_index, I2C_TRANSACTION_DONE);
+    }
+}
+
+/** @brief  Handles I2C1 event interrupts */
+void I2C1_EV_IRQHandler(void) {
+    I2C_EV_IRQHandler(I2C1_Index);
+}
+
+/** @brief  Handles I2C2 event interrupts */
+void I2C2_EV_IRQHandler(void) {
+    I2C_EV_IRQHandler(I2C2_Index);
+}
+
+/** @brief  Handles I2C3 event interrupts */
+void I2C3_EV_IRQHandler(void) {
+    I2C_EV_IRQHandler(I2C3_Index);
+}
+
+/** @brief  Handles I2C1 error interrupts */
+void I2C1_ER_IRQHandler(void) {
+    I2C_ER_IRQHandler(I2C1_Index);
+}
+
+/** @brief  Handles I2C2 error interrupts */
+void I2C2_ER_IRQHandler(void) {
+    I2C_ER_IRQHandler(I2C2_Index);
+}
+
+/** @brief  Handles I2C3 error interrupts */
+void I2C3_ER_IRQHandler(void) {
+    I2C_ER_IRQHandler(I2C3_Index);
+}
+
+/** @brief  Handles I2C1 receive stream interrupts */
+void DMA1_Stream5_IRQHandler(void) {
+    I2C_DMA_IRQHandler(I2C1_Index);
+}
+
+/** @brief  Handles I2C2 receive stream interrupts */
+void DMA1_Stream2_IRQHandler(void) {
+    I2C_DMA_IRQHandler(I2C2_Index);
+}
+
+/** @brief  Handles I2C3 receive stream interrupts */
+void DMA1_Stream1_IRQHandler(void) {
+    I2C_DMA_IRQHandler(I2C3_Index);
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+#ifndef __I2C_H
+#define __I2C_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../../utils/utils.h"
+#include "../gpio/gpio.h"
+#include "../tim5/tim5.h"
+
+
+/**********************************************************************************/
+/*                                     Defines                                    */
+/**********************************************************************************/
+
+/* microseconds a transaction may stay active before it is aborted and the bus recovered */
+#ifndef I2C_DEFAULT_TIMEOUT_US
+#define I2C_DEFAULT_TIMEOUT_US      10000U
+#endif
+
+
+/**********************************************************************************/
+/*                                      Enums                                     */
+/**********************************************************************************/
+
+typedef enum {
+    I2C1_Index = 0,
+    I2C2_Index,
+    I2C3_Index,
+    I2C_Index_Error
+} I2C_Index;
+
+typedef enum {
+    I2C_SPEED_STANDARD = 0,                     /* 100kHz */
+    I2C_SPEED_FAST                              /* 400kHz */
+} I2C_Speed;
+
+typedef enum {
+    I2C_TRANSACTION_IDLE = 0,
+    I2C_TRANSACTION_QUEUED,
+    I2C_TRANSACTION_ACTIVE,
+    I2C_TRANSACTION_DONE,
+    I2C_TRANSACTION_NACK,
+    I2C_TRANSACTION_TIMEOUT,
+    I2C_TRANSACTION_ERROR
+} I2C_Transaction_Status;
+
+
+/**********************************************************************************/
+/*                              Configuration Structs                             */
+/**********************************************************************************/
+
+typedef struct {
+/************************************ Required ************************************/
+    I2C_t              *instance;
+    GPIO_t             *scl_port;
+    GPIO_Pin           scl_pin;
+    GPIO_t             *sda_port;
+    GPIO_Pin           sda_pin;
+    GPIO_AF            alt_function;
+/************************************ Optional ************************************/
+    I2C_Speed          speed;
+    GPIO_PUPD          pupd;
+    uint32_t           timeout_us;
+    NVIC_Latency_Class interrupt_class;
+} I2C_Init_Config_t;
+
+typedef struct I2C_Transaction {
+/************************************ Required ************************************/
+    uint8_t                address;             /* 7 bit, unshifted */
+    const uint8_t          *tx_buffer;
+    uint16_t               tx_length;
+    uint8_t                *rx_buffer;
+    uint16_t               rx_length;           /* read after a repeated start if tx_length > 0 */
+/************************************ Optional ************************************/
+    Deferred_Work_t        callback;
+    uint32_t               argument;
+/********************************** Driver Owned **********************************/
+    volatile uint32_t      status;              /* I2C_Transaction_Status */
+    struct I2C_Transaction *next;
+} I2C_Transaction_t;
+
+
+/**********************************************************************************/
+/*                               Function Prototypes                              */
+/**********************************************************************************/
+
+Status                 I2C_Init(I2C_Init_Config_t *init_config);
+Status                 I2C_Transfer(I2C_t *instance, I2C_Transaction_t *transaction);
+Status                 I2C_Cancel(I2C_t *instance, I2C_Transaction_t *transaction);
+Status                 I2C_Check_Timeout(I2C_t *instance);
+Status                 I2C_Recover(I2C_t *instance);
+I2C_Transaction_Status I2C_Get_Status(const I2C_Transaction_t *transaction);
+void                   I2C1_EV_IRQHandler(void);
+void                   I2C2_EV_IRQHandler(void);
+void                   I2C3_EV_IRQHandler(void);
+void                   I2C1_ER_IRQHandler(void);
+void                   I2C2_ER_IRQHandler(void);
+void                   I2C3_ER_IRQHandler(void);
+void                   DMA1_Stream5_IRQHandler(void);
+void                   DMA1_Stream2_IRQHandler(void);
+void                   DMA1_Stream1_IRQHandler(void);
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
\ No newline at end of file
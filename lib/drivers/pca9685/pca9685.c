@@ -0,0 +1,223 @@
+#include "pca9685.h"
+
+/**********************************************************************************/
+/*                                 Static Variables                               */
+/**********************************************************************************/
+
+/* register map */
+static const uint8_t PCA9685_MODE1      = 0x00U;
+static const uint8_t PCA9685_MODE2      = 0x01U;
+static const uint8_t PCA9685_LED0_ON_L  = 0x06U;
+static const uint8_t PCA9685_PRE_SCALE  = 0xFEU;
+
+/* MODE1 and MODE2 bits */
+static const uint8_t PCA9685_MODE1_AI     = 0x20U;
+static const uint8_t PCA9685_MODE1_SLEEP  = 0x10U;
+static const uint8_t PCA9685_MODE2_OUTDRV = 0x04U;
+
+/* full on or full off flag in ON_H and OFF_H */
+static const uint8_t PCA9685_LED_FULL     = 0x10U;
+
+
+/**********************************************************************************/
+/*                                Static Functions                                */
+/**********************************************************************************/
+
+static void PCA9685_Queue_Setup(PCA9685_t *device, uint8_t index, uint8_t reg, uint8_t value) {
+    device->setup_data[index][0]   = reg;
+    device->setup_data[index][1]   = value;
+    device->setup[index].address   = device->address;
+    device->setup[index].tx_buffer = device->setup_data[index];
+    device->setup[index].tx_length = 2U;
+    device->setup[index].rx_buffer = 0;
+    device->setup[index].rx_length = 0;
+    device->setup[index].callback  = 0;
+}
+
+
+/**********************************************************************************/
+/*                              PCA9685 Core Functions                            */
+/**********************************************************************************/
+
+/**
+ * @brief  Initialises a PCA9685 16 channel PWM expander on an initialised I2C bus
+ * @note   The setup writes are queued rather than waited on: sleep with auto-increment,
+ *         output driver, prescaler, then wake. Every channel starts off, and channel outputs
+ *         are only written by @ref PCA9685_Flush
+ * @note   If the bus rejects a setup write, the writes queued before it are cancelled. Only
+ *         one already on the bus still completes
+ * @param  device: Pointer to PCA9685 structure, which must stay valid while in use
+ * @retval Status indicating success, invalid parameters, or error if the bus rejected the
+ *         setup or a previous setup is still in flight
+ */
+Status PCA9685_Init(PCA9685_t *device) {
+    //validate device
+    if (!device || !device->instance || device->address > 0x7FU
+        || device->output_type < PCA9685_OUTPUT_TOTEM_POLE || device->output_type > PCA9685_OUTPUT_OPEN_DRAIN) {
+        return INVALID_PARAM;
+    }
+    for (uint8_t i = 0; i < PCA9685_SETUP_WRITES; i++) {
+        if (I2C_Get_Status(&device->setup[i]) == I2C_TRANSACTION_QUEUED
+            || I2C_Get_Status(&device->setup[i]) == I2C_TRANSACTION_ACTIVE) {
+            return ERROR;
+        }
+    }
+
+    //validate prescaler, limited by the chip to 3 - 255 (1526Hz - 24Hz)
+    device->address       = device->address ? device->address : PCA9685_DEFAULT_ADDRESS;
+    device->pwm_frequency = device->pwm_frequency ? device->pwm_frequency : 50U;
+    uint32_t prescale = (((PCA9685_OSCILLATOR_HZ + ((PCA9685_COUNTS * device->pwm_frequency) / 2U))
+                         / (PCA9685_COUNTS * device->pwm_frequency)) - 1U);
+    if (prescale < 3U || prescale > 255U) {
+        return INVALID_PARAM;
+    }
+    device->count_time_us  = 0;
+    device->dirty          = 0;
+    device->skipped_frames = 0;
+    for (uint8_t channel = 0; channel < PCA9685_CHANNEL_COUNT; channel++) {
+        device->counts[channel] = 0;
+    }
+
+    //the prescaler can only be written while asleep
+    PCA9685_Queue_Setup(device, 0, PCA9685_MODE1, (PCA9685_MODE1_AI | PCA9685_MODE1_SLEEP));
+    PCA9685_Queue_Setup(device, 1U, PCA9685_MODE2,
+                        (device->output_type == PCA9685_OUTPUT_TOTEM_POLE) ? PCA9685_MODE2_OUTDRV : 0);
+    PCA9685_Queue_Setup(device, 2U, PCA9685_PRE_SCALE, (uint8_t) prescale);
+    PCA9685_Queue_Setup(device, 3U, PCA9685_MODE1, PCA9685_MODE1_AI);
+    for (uint8_t i = 0; i < PCA9685_SETUP_WRITES; i++) {
+        if (I2C_Transfer(device->instance, &device->setup[i]) != SUCCESS) {
+            //withdraw the writes already queued, so a partial setup never reaches the chip
+            while (i--) {
+                I2C_Cancel(device->instance, &device->setup[i]);
+            }
+            return ERROR;
+        }
+    }
+    device->count_time_us = ((((float) (prescale + 1U)) * (float) SEC_TO_MICRO) / (float) PCA9685_OSCILLATOR_HZ);
+
+    //every frame is one auto-increment write from LED0_ON_L
+    device->frame_data[0]    = PCA9685_LED0_ON_L;
+    device->frame.address    = device->address;
+    device->frame.tx_buffer  = device->frame_data;
+    device->frame.tx_length  = PCA9685_FRAME_SIZE;
+    device->frame.rx_buffer  = 0;
+    device->frame.rx_length  = 0;
+    device->frame.callback   = 0;
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Stages the high time of a channel in PWM counts
+ * @note   Takes effect on the next @ref PCA9685_Flush
+ * @param  device:  Pointer to the device
+ * @param  channel: Channel number (0 - 15)
+ * @param  counts:  High time out of PCA9685_COUNTS, 0 for off and PCA9685_COUNTS for full on
+ * @retval Status indicating success or invalid parameters
+ */
+Status PCA9685_Set_Counts(PCA9685_t *device, uint8_t channel, uint16_t counts) {
+    //validate device, channel and counts
+    if (!device || channel >= PCA9685_CHANNEL_COUNT || counts > PCA9685_COUNTS) {
+        return INVALID_PARAM;
+    }
+
+    device->counts[channel] = counts;
+    device->dirty           = 1U;
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Stages the pulse width of a channel
+ * @note   Converted with the period the prescaler actually gives, which can differ slightly
+ *         from the requested frequency. Takes effect on the next @ref PCA9685_Flush
+ * @param  device:         Pointer to the device
+ * @param  channel:        Channel number (0 - 15)
+ * @param  pulse_width_us: Pulse width in microseconds, clamped to the PWM period
+ * @retval Status indicating success, invalid parameters, or error if not initialised
+ */
+Status PCA9685_Set_Pulse_Width(PCA9685_t *device, uint8_t channel, float pulse_width_us) {
+    //validate device and initialisation
+    if (!device) {
+        return INVALID_PARAM;
+    }
+    if (device->count_time_us <= 0.0f) {
+        return ERROR;
+    }
+
+    float counts = ((pulse_width_us / device->count_time_us) + 0.5f);
+    if (counts < 0.0f) {
+        counts = 0.0f;
+    } else if (counts > (float) PCA9685_COUNTS) {
+        counts = (float) PCA9685_COUNTS;
+    }
+
+    return PCA9685_Set_Counts(device, channel, (uint16_t) counts);
+}
+
+/**
+ * @brief  Writes every staged channel to the device in a single I2C transaction
+ * @note   All 16 channels go out as one auto-increment write of 65 bytes, so a frame costs
+ *         one bus transaction instead of sixteen. Channel rising edges are staggered by
+ *         256 counts so sixteen servos do not draw their pulse current at the same instant.
+ *         Call once per frame, nothing is sent if no channel has changed
+ * @note   Runs @ref I2C_Check_Timeout so a stalled bus is recovered within a frame
+ * @param  device: Pointer to the device
+ * @retval Status indicating success, invalid parameters, or error if the previous frame is
+ *         still on the bus, in which case the frame is counted as skipped and stays staged
+ */
+Status PCA9685_Flush(PCA9685_t *device) {
+    //validate device
+    if (!device || !device->instance) {
+        return INVALID_PARAM;
+    }
+
+    I2C_Check_Timeout(device->instance);
+    if (!device->dirty) {
+        return SUCCESS;
+    }
+
+    //the frame buffer is read by DMA until the previous frame completes
+    I2C_Transaction_Status status = I2C_Get_Status(&device->frame);
+    if (status == I2C_TRANSACTION_QUEUED || status == I2C_TRANSACTION_ACTIVE) {
+        device->skipped_frames++;
+        return ERROR;
+    }
+
+    //build ON and OFF registers of every channel
+    device->dirty = 0;
+    uint8_t *registers = &device->frame_data[1];
+    for (uint8_t channel = 0; channel < PCA9685_CHANNEL_COUNT; channel++) {
+        uint16_t counts  = device->counts[channel];
+        uint16_t on      = (uint16_t) (channel * (PCA9685_COUNTS / PCA9685_CHANNEL_COUNT));
+        uint16_t off     = (uint16_t) ((on + counts) & (PCA9685_COUNTS - 1U));
+        uint8_t on_full  = 0;
+        uint8_t off_full = 0;
+        if (!counts) {
+            off_full = PCA9685_LED_FULL;
+        } else if (counts >= PCA9685_COUNTS) {
+            on_full = PCA9685_LED_FULL;
+        }
+        registers[0] = (uint8_t) (on & 0xFFU);
+        registers[1] = (uint8_t) ((on >> 8U) | on_full);
+        registers[2] = (uint8_t) (off & 0xFFU);
+        registers[3] = (uint8_t) ((off >> 8U) | off_full);
+        registers   += 4U;
+    }
+
+    if (I2C_Transfer(device->instance, &device->frame) != SUCCESS) {
+        device->dirty = 1U;
+        return ERROR;
+    }
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Reads the number of flushes dropped because the bus was still busy
+ * @param  device: Pointer to the device
+ * @retval Number of skipped frames since @ref PCA9685_Init
+ */
+uint32_t PCA9685_Get_Skipped_Frames(const PCA9685_t *device) {
+    return device ? device->skipped_frames : 0;
+}
\ No newline at end of file
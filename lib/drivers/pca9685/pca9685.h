@@ -0,0 +1,77 @@
+#ifndef __PCA9685_H
+#define __PCA9685_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../../utils/utils.h"
+#include "../i2c/i2c.h"
+
+
+/**********************************************************************************/
+/*                                     Defines                                    */
+/**********************************************************************************/
+
+#define PCA9685_CHANNEL_COUNT       16U
+#define PCA9685_COUNTS              4096U
+#define PCA9685_DEFAULT_ADDRESS     0x40U
+
+#ifndef PCA9685_OSCILLATOR_HZ
+#define PCA9685_OSCILLATOR_HZ       25000000U
+#endif
+
+/* register address followed by ON_L, ON_H, OFF_L, OFF_H of every channel */
+#define PCA9685_FRAME_SIZE          (1U + (4U * PCA9685_CHANNEL_COUNT))
+#define PCA9685_SETUP_WRITES        4U
+
+
+/**********************************************************************************/
+/*                                      Enums                                     */
+/**********************************************************************************/
+
+typedef enum {
+    PCA9685_OUTPUT_TOTEM_POLE = 0,
+    PCA9685_OUTPUT_OPEN_DRAIN
+} PCA9685_Output_Type;
+
+
+/**********************************************************************************/
+/*                              Configuration Structs                             */
+/**********************************************************************************/
+
+typedef struct {
+/************************************ Required ************************************/
+    I2C_t               *instance;
+/************************************ Optional ************************************/
+    uint8_t             address;
+    uint16_t            pwm_frequency;
+    PCA9685_Output_Type output_type;
+/********************************** Driver Owned **********************************/
+    float               count_time_us;
+    uint16_t            counts[PCA9685_CHANNEL_COUNT];
+    volatile uint32_t   dirty;
+    uint32_t            skipped_frames;
+    uint8_t             setup_data[PCA9685_SETUP_WRITES][2];
+    I2C_Transaction_t   setup[PCA9685_SETUP_WRITES];
+    uint8_t             frame_data[PCA9685_FRAME_SIZE];
+    I2C_Transaction_t   frame;
+} PCA9685_t;
+
+
+/**********************************************************************************/
+/*                               Function Prototypes                              */
+/**********************************************************************************/
+
+Status   PCA9685_Init                (PCA9685_t *device);
+Status   PCA9685_Set_Counts          (PCA9685_t *device, uint8_t channel, uint16_t counts);
+Status   PCA9685_Set_Pulse_Width     (PCA9685_t *device, uint8_t channel, float pulse_width_us);
+Status   PCA9685_Flush               (PCA9685_t *device);
+uint32_t PCA9685_Get_Skipped_Frames  (const PCA9685_t *device);
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,416 @@
+#include "spi.h"
+
+/**********************************************************************************/
+/*                                 Static Variables                               */
+/**********************************************************************************/
+
+/* DMA streams serving each SPI, the transmit stream only raises transfer errors */
+typedef struct {
+    DMA_t        *dma;
+    DMA_Stream_t *rx_stream;
+    DMA_Stream_t *tx_stream;
+    IRQn_t       rx_irqn;
+    IRQn_t       tx_irqn;
+    uint8_t      rx_number;
+    uint8_t      tx_number;
+    uint8_t      channel;
+} SPI_DMA_Map_t;
+
+/* SPI4 and SPI5 share DMA2 streams 3 and 4, so only one of them can be initialised */
+static const SPI_DMA_Map_t spi_dma_map[5] = {
+    {DMA2, DMA2_Stream2, DMA2_Stream5, DMA2_Stream2_IRQn, DMA2_Stream5_IRQn, 2U, 5U, 3U},
+    {DMA1, DMA1_Stream3, DMA1_Stream4, DMA1_Stream3_IRQn, DMA1_Stream4_IRQn, 3U, 4U, 0U},
+    {DMA1, DMA1_Stream0, DMA1_Stream7, DMA1_Stream0_IRQn, DMA1_Stream7_IRQn, 0U, 7U, 0U},
+    {DMA2, DMA2_Stream3, DMA2_Stream4, DMA2_Stream3_IRQn, DMA2_Stream4_IRQn, 3U, 4U, 5U},
+    {DMA2, DMA2_Stream3, DMA2_Stream4, DMA2_Stream3_IRQn, DMA2_Stream4_IRQn, 3U, 4U, 2U}
+};
+
+/* bit offset of each stream's flags within DMA_xISR and DMA_xIFCR */
+static const uint8_t spi_dma_flag_shift[4] = {0U, 6U, 16U, 22U};
+
+/* transmit source for transactions without a transmit buffer */
+static const uint16_t spi_dummy_tx = SPI_DUMMY_FRAME;
+
+typedef struct {
+    SPI_Transaction_t *head;
+    SPI_Transaction_t *tail;
+    uint16_t          dummy_rx;
+    uint8_t           initialised;
+} SPI_Bus_State_t;
+
+static SPI_Bus_State_t spi_buses[5] = {0};
+
+
+/**********************************************************************************/
+/*                                Static Functions                                */
+/**********************************************************************************/
+
+static SPI_Index Get_SPI_Index(SPI_t *instance) {
+    if (instance == SPI1) {
+        return SPI1_Index;
+    } else if (instance == SPI2) {
+        return SPI2_Index;
+    } else if (instance == SPI3) {
+        return SPI3_Index;
+    } else if (instance == SPI4) {
+        return SPI4_Index;
+    } else if (instance == SPI5) {
+        return SPI5_Index;
+    } else {
+        return SPI_Index_Error;
+    }
+}
+
+static uint32_t SPI_DMA_Get_Flags(DMA_t *dma, uint8_t stream) {
+    uint32_t isr = (stream < 4U) ? dma->LISR : dma->HISR;
+    return ((isr >> spi_dma_flag_shift[stream & 3U]) & DMA_FLAG_ALL);
+}
+
+static void SPI_DMA_Clear_Flags(DMA_t *dma, uint8_t stream, uint32_t flags) {
+    if (stream < 4U) {
+        dma->LIFCR = (flags << spi_dma_flag_shift[stream]);
+    } else {
+        dma->HIFCR = (flags << spi_dma_flag_shift[stream - 4U]);
+    }
+}
+
+static void SPI_DMA_Stop(DMA_Stream_t *stream) {
+    stream->CR &= ~(DMA_SxCR_EN);
+    while (stream->CR & DMA_SxCR_EN);
+}
+
+/**
+ * @brief  Builds the CR1 value that runs the bus with a device's settings
+ * @param  device: Pointer to the device
+ * @retval CR1 register value with the peripheral enabled
+ */
+static uint32_t SPI_Device_CR1(const SPI_Device_t *device) {
+    return (SPI_CR1_MSTR | SPI_CR1_SSM | SPI_CR1_SSI | SPI_CR1_SPE
+            | (((uint32_t) device->clock_divider) << SPI_CR1_BR_Pos)
+            | (((uint32_t) device->clock_mode) << SPI_CR1_CPHA_Pos)
+            | (((uint32_t) device->frame_size) << SPI_CR1_DFF_Pos)
+            | (((uint32_t) device->first_bit) << SPI_CR1_LSBFIRST_Pos));
+}
+
+/**
+ * @brief  Starts the transaction at the head of a bus queue
+ * @note   Called with the bus queue protected, either from @ref SPI_Transfer inside a
+ *         critical section or from a stream interrupt
+ * @param  spi_index: Index of the bus
+ */
+static void SPI_Start_Transaction(SPI_Index spi_index) {
+    const SPI_DMA_Map_t *map       = &spi_dma_map[spi_index];
+    SPI_Bus_State_t *bus           = &spi_buses[spi_index];
+    SPI_Transaction_t *transaction = bus->head;
+    SPI_Device_t *device           = transaction->device;
+    SPI_t *instance                = device->instance;
+
+    //reconfigure the bus only when this device's settings differ from the last one's
+    uint32_t cr1 = SPI_Device_CR1(device);
+    if (instance->CR1 != cr1) {
+        instance->CR1 = (cr1 & ~(SPI_CR1_SPE));
+        instance->CR1 = cr1;
+    }
+
+    //discard into a dummy frame and clock out a dummy frame when a buffer is absent
+    uint32_t size = (device->frame_size == SPI_FRAME_16) ? (DMA_SxCR_PSIZE_16 | DMA_SxCR_MSIZE_16)
+                                                         : (DMA_SxCR_PSIZE_8 | DMA_SxCR_MSIZE_8);
+    uint32_t channel = (((uint32_t) map->channel) << DMA_SxCR_CHSEL_Pos);
+    SPI_DMA_Clear_Flags(map->dma, map->rx_number, DMA_FLAG_ALL);
+    SPI_DMA_Clear_Flags(map->dma, map->tx_number, DMA_FLAG_ALL);
+
+    map->rx_stream->PAR  = (uint32_t) (uintptr_t) &instance->DR;
+    map->rx_stream->M0AR = transaction->rx_buffer ? (uint32_t) (uintptr_t) transaction->rx_buffer
+                                                  : (uint32_t) (uintptr_t) &bus->dummy_rx;
+    map->rx_stream->NDTR = transaction->length;
+    map->rx_stream->CR   = (channel | size | DMA_SxCR_PL_VERY_HIGH | DMA_SxCR_DIR_P2M | DMA_SxCR_TCIE
+                            | DMA_SxCR_TEIE | (transaction->rx_buffer ? DMA_SxCR_MINC : 0));
+
+    map->tx_stream->PAR  = (uint32_t) (uintptr_t) &instance->DR;
+    map->tx_stream->M0AR = transaction->tx_buffer ? (uint32_t) (uintptr_t) transaction->tx_buffer
+                                                  : (uint32_t) (uintptr_t) &spi_dummy_tx;
+    map->tx_stream->NDTR = transaction->length;
+    map->tx_stream->CR   = (channel | size | DMA_SxCR_PL_HIGH | DMA_SxCR_DIR_M2P | DMA_SxCR_TEIE
+                            | (transaction->tx_buffer ? DMA_SxCR_MINC : 0));
+
+    transaction->status = SPI_TRANSACTION_ACTIVE;
+
+    //select the device, arm receive before transmit so no frame is missed
+    device->cs_port->BSRR = (SET_ONE << (device->cs_pin + 16U));
+    map->rx_stream->CR   |= DMA_SxCR_EN;
+    map->tx_stream->CR   |= DMA_SxCR_EN;
+    instance->CR2         = SPI_CR2_RXDMAEN;
+    instance->CR2         = (SPI_CR2_RXDMAEN | SPI_CR2_TXDMAEN);
+}
+
+
+/**********************************************************************************/
+/*                                SPI Core Functions                              */
+/**********************************************************************************/
+
+/**
+ * @brief  Initialises an SPI peripheral as a full-duplex DMA bus master
+ * @note   SCK, MISO and MOSI pins should be configured in their alternate function prior to
+ *         initialisation. Chip selects are driven in software per device, so NSS is unused.
+ *         Claims the bus's DMA stream interrupts with the peripheral as owner
+ * @note   SPI1 uses DMA2 streams 2 and 5, SPI2 DMA1 streams 3 and 4, SPI3 DMA1 streams 0
+ *         and 7, and SPI4 or SPI5 DMA2 streams 3 and 4
+ * @param  init_config: Pointer to SPI_Init_Config structure containing SPI settings
+ * @retval Status indicating success, invalid parameters, or error if a DMA stream is taken
+ */
+Status SPI_Init(SPI_Init_Config_t *init_config) {
+    //validate config struct pointer and instance
+    if (!init_config) {
+        return INVALID_PARAM;
+    }
+    SPI_Index spi_index = Get_SPI_Index(init_config->instance);
+    if (spi_index == SPI_Index_Error) {
+        return INVALID_PARAM;
+    }
+
+    //claim both streams, giving back the receive stream if the transmit stream is taken
+    const SPI_DMA_Map_t *map = &spi_dma_map[spi_index];
+    NVIC_Latency_Class latency_class = init_config->interrupt_class ? init_config->interrupt_class
+                                                                    : NVIC_CLASS_COMMS;
+    uint8_t rx_owned = (NVIC_Get_Owner(map->rx_irqn) == init_config->instance);
+    if (NVIC_Request_IRQ(map->rx_irqn, latency_class, init_config->instance) != SUCCESS) {
+        return ERROR;
+    }
+    if (NVIC_Request_IRQ(map->tx_irqn, latency_class, init_config->instance) != SUCCESS) {
+        if (!rx_owned) {
+            NVIC_Release_IRQ(map->rx_irqn, init_config->instance);
+        }
+        return ERROR;
+    }
+
+    //enable SPI and DMA clocks
+    switch (spi_index) {
+        case SPI1_Index: RCC->APB2ENR |= RCC_APB2ENR_SPI1EN; break;
+        case SPI2_Index: RCC->APB1ENR |= RCC_APB1ENR_SPI2EN; break;
+        case SPI3_Index: RCC->APB1ENR |= RCC_APB1ENR_SPI3EN; break;
+        case SPI4_Index: RCC->APB2ENR |= RCC_APB2ENR_SPI4EN; break;
+        default: RCC->APB2ENR |= RCC_APB2ENR_SPI5EN; break;
+    }
+    RCC->AHB1ENR |= (map->dma == DMA1) ? RCC_AHB1ENR_DMA1EN : RCC_AHB1ENR_DMA2EN;
+
+    //stop any transfer in progress
+    SPI_DMA_Stop(map->rx_stream);
+    SPI_DMA_Stop(map->tx_stream);
+    map->rx_stream->FCR = 0;
+    map->tx_stream->FCR = 0;
+
+    //master with software slave select, enabled at the slowest clock until a transfer
+    init_config->instance->CR2 = 0;
+    init_config->instance->CR1 = (SPI_CR1_MSTR | SPI_CR1_SSM | SPI_CR1_SSI | SPI_CR1_BR_DIV256);
+    init_config->instance->CR1 |= SPI_CR1_SPE;
+
+    spi_buses[spi_index].head        = 0;
+    spi_buses[spi_index].tail        = 0;
+    spi_buses[spi_index].initialised = 1U;
+
+    NVIC_Enable_IRQ(map->rx_irqn);
+    NVIC_Enable_IRQ(map->tx_irqn);
+
+    DSB();
+    return SUCCESS;
+}
+
+/**
+ * @brief  Prepares a device on an SPI bus, driving its chip select high
+ * @note   The clock divider is applied to the bus's APB clock, SPI_CLOCK_DIV_2 being the
+ *         fastest. Each transaction runs with the settings of its own device, so devices with
+ *         different modes, frame sizes and clocks share one bus
+ * @param  device: Pointer to SPI_Device structure, which must stay valid while in use
+ * @retval Status indicating success or invalid parameters
+ */
+Status SPI_Device_Init(SPI_Device_t *device) {
+    //validate device, instance and chip select
+    if (!device || Get_SPI_Index(device->instance) == SPI_Index_Error || !device->cs_port
+        || device->cs_pin < GPIO_PIN_0 || device->cs_pin > GPIO_PIN_15) {
+        return INVALID_PARAM;
+    }
+
+    //validate bus settings
+    if (device->clock_divider < SPI_CLOCK_DIV_2 || device->clock_divider > SPI_CLOCK_DIV_256
+        || device->clock_mode < SPI_MODE_0 || device->clock_mode > SPI_MODE_3
+        || device->frame_size < SPI_FRAME_8 || device->frame_size > SPI_FRAME_16
+        || device->first_bit < SPI_FIRST_BIT_MSB || device->first_bit > SPI_FIRST_BIT_LSB) {
+        return INVALID_PARAM;
+    }
+
+    //deselect before the pin becomes an output so the device never sees a glitch
+    device->cs_port->BSRR = (SET_ONE << device->cs_pin);
+    GPIO_Config_t cs_gpio = {
+        .port         = device->cs_port,
+        .pin          = device->cs_pin,
+        .mode         = GPIO_MODE_OUTPUT,
+        .output_speed = GPIO_OUTPUT_SPEED_HIGH
+    };
+    return GPIO_Init(&cs_gpio);
+}
+
+/**
+ * @brief  Queues a full-duplex transfer with a device
+ * @note   Transactions on a bus run in submission order. Each one asserts its device's chip
+ *         select, exchanges length frames by DMA and releases the chip select, and the next
+ *         one is started from the same interrupt, so queued transfers run back to back
+ *         without waiting on the CPU. The callback is posted to PendSV via
+ *         @ref Deferred_Post once the transaction has finished
+ * @note   The transaction and its buffers must stay valid until its status is DONE or ERROR.
+ *         With 16 bit frames the buffers must be half-word aligned
+ * @param  transaction: Pointer to the transaction
+ * @retval Status indicating success, invalid parameters, or error if the bus is not
+ *         initialised, the transaction is already queued, or PendSV is unavailable
+ */
+Status SPI_Transfer(SPI_Transaction_t *transaction) {
+    //validate transaction, device and length
+    if (!transaction || !transaction->device || !transaction->length) {
+        return INVALID_PARAM;
+    }
+    SPI_Index spi_index = Get_SPI_Index(transaction->device->instance);
+    if (spi_index == SPI_Index_Error) {
+        return INVALID_PARAM;
+    }
+
+    //validate buffer alignment for half-word frames
+    if (transaction->device->frame_size == SPI_FRAME_16
+        && ((((uintptr_t) transaction->tx_buffer) | ((uintptr_t) transaction->rx_buffer)) & 1U)) {
+        return INVALID_PARAM;
+    }
+
+    //validate bus and transaction state
+    if (!spi_buses[spi_index].initialised || transaction->status == SPI_TRANSACTION_QUEUED
+        || transaction->status == SPI_TRANSACTION_ACTIVE) {
+        return ERROR;
+    }
+
+    //callbacks are run as deferred work
+    if (transaction->callback && Deferred_Init() != SUCCESS) {
+        return ERROR;
+    }
+
+    transaction->next   = 0;
+    transaction->status = SPI_TRANSACTION_QUEUED;
+
+    //append, starting the bus if it is idle
+    SPI_Bus_State_t *bus = &spi_buses[spi_index];
+    uint32_t primask = ENTER_CRITICAL();
+    if (bus->tail) {
+        bus->tail->next = transaction;
+        bus->tail       = transaction;
+    } else {
+        bus->head = transaction;
+        bus->tail = transaction;
+        SPI_Start_Transaction(spi_index);
+    }
+    EXIT_CRITICAL(primask);
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Reads the progress of a transaction
+ * @param  transaction: Pointer to the transaction
+ * @retval Transaction status, DONE or ERROR once the chip select has been released
+ */
+SPI_Transaction_Status SPI_Get_Status(const SPI_Transaction_t *transaction) {
+    return transaction ? (SPI_Transaction_Status) transaction->status : SPI_TRANSACTION_IDLE;
+}
+
+
+/**********************************************************************************/
+/*                             SPI Interrupt Handlers                             */
+/**********************************************************************************/
+
+/**
+ * @brief  Completes the active transaction of a bus and starts the next one
+ * @note   Receive finishes after transmit, so its transfer complete marks the end of the
+ *         transaction. A transfer error on either stream ends it with ERROR, as the receive
+ *         stream never completes once transmit has stopped
+ * @param  spi_index: Index of the bus
+ */
+static void SPI_DMA_IRQHandler(SPI_Index spi_index) {
+    const SPI_DMA_Map_t *map = &spi_dma_map[spi_index];
+    SPI_Bus_State_t *bus     = &spi_buses[spi_index];
+
+    uint32_t flags    = SPI_DMA_Get_Flags(map->dma, map->rx_number);
+    uint32_t tx_flags = SPI_DMA_Get_Flags(map->dma, map->tx_number);
+    SPI_DMA_Clear_Flags(map->dma, map->rx_number, flags);
+    SPI_DMA_Clear_Flags(map->dma, map->tx_number, tx_flags);
+    flags |= (tx_flags & DMA_FLAG_TEIF);
+    SPI_Transaction_t *transaction = bus->head;
+    if (!(flags & (DMA_FLAG_TCIF | DMA_FLAG_TEIF)) || !transaction) {
+        return;
+    }
+
+    //a transfer error disables the stream, stop the other one too
+    SPI_t *instance = transaction->device->instance;
+    instance->CR2   = 0;
+    uint32_t status = SPI_TRANSACTION_DONE;
+    if (flags & DMA_FLAG_TEIF) {
+        SPI_DMA_Stop(map->tx_stream);
+        SPI_DMA_Stop(map->rx_stream);
+        status = SPI_TRANSACTION_ERROR;
+    }
+
+    //release chip select once the last clock edge is out
+    while (instance->SR & SPI_SR_BSY);
+    (void) instance->DR;
+    (void) instance->SR;
+    transaction->device->cs_port->BSRR = (SET_ONE << transaction->device->cs_pin);
+
+    //start the next transaction before signalling this one
+    Deferred_Work_t callback = transaction->callback;
+    uint32_t argument        = transaction->argument;
+    bus->head = transaction->next;
+    if (bus->head) {
+        SPI_Start_Transaction(spi_index);
+    } else {
+        bus->tail = 0;
+    }
+    transaction->status = status;
+
+    if (callback) {
+        Deferred_Post(callback, argument);
+    }
+}
+
+/** @brief  Handles SPI1 receive stream interrupts */
+void DMA2_Stream2_IRQHandler(void) {
+    SPI_DMA_IRQHandler(SPI1_Index);
+}
+
+/** @brief  Handles SPI2 receive stream interrupts */
+void DMA1_Stream3_IRQHandler(void) {
+    SPI_DMA_IRQHandler(SPI2_Index);
+}
+
+/** @brief  Handles SPI3 receive stream interrupts */
+void DMA1_Stream0_IRQHandler(void) {
+    SPI_DMA_IRQHandler(SPI3_Index);
+}
+
+/** @brief  Handles SPI4 or SPI5 receive stream interrupts, whichever owns the stream */
+void DMA2_Stream3_IRQHandler(void) {
+    SPI_DMA_IRQHandler((NVIC_Get_Owner(DMA2_Stream3_IRQn) == SPI4) ? SPI4_Index : SPI5_Index);
+}
+
+/** @brief  Handles SPI1 transmit stream errors */
+void DMA2_Stream5_IRQHandler(void) {
+    SPI_DMA_IRQHandler(SPI1_Index);
+}
+
+/** @brief  Handles SPI2 transmit stream errors */
+void DMA1_Stream4_IRQHandler(void) {
+    SPI_DMA_IRQHandler(SPI2_Index);
+}
+
+/** @brief  Handles SPI3 transmit stream errors */
+void DMA1_Stream7_IRQHandler(void) {
+    SPI_DMA_IRQHandler(SPI3_Index);
+}
+
+/** @brief  Handles SPI4 or SPI5 transmit stream errors, whichever owns the stream */
+void DMA2_Stream4_IRQHandler(void) {
+    SPI_DMA_IRQHandler((NVIC_Get_Owner(DMA2_Stream4_IRQn) == SPI4) ? SPI4_Index : SPI5_Index);
+}
\ No newline at end of file
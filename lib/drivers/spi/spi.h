@@ -0,0 +1,133 @@
+#ifndef __SPI_H
+#define __SPI_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../../utils/utils.h"
+#include "../gpio/gpio.h"
+
+
+/**********************************************************************************/
+/*                                     Defines                                    */
+/**********************************************************************************/
+
+/* frame clocked out when a transaction has no transmit buffer */
+#ifndef SPI_DUMMY_FRAME
+#define SPI_DUMMY_FRAME             0xFFFFU
+#endif
+
+
+/**********************************************************************************/
+/*                                      Enums                                     */
+/**********************************************************************************/
+
+typedef enum {
+    SPI1_Index = 0,
+    SPI2_Index,
+    SPI3_Index,
+    SPI4_Index,
+    SPI5_Index,
+    SPI_Index_Error
+} SPI_Index;
+
+typedef enum {
+    SPI_CLOCK_DIV_2 = 0,
+    SPI_CLOCK_DIV_4,
+    SPI_CLOCK_DIV_8,
+    SPI_CLOCK_DIV_16,
+    SPI_CLOCK_DIV_32,
+    SPI_CLOCK_DIV_64,
+    SPI_CLOCK_DIV_128,
+    SPI_CLOCK_DIV_256
+} SPI_Clock_Divider;
+
+/* mode number is CPOL << 1 | CPHA */
+typedef enum {
+    SPI_MODE_0 = 0,
+    SPI_MODE_1,
+    SPI_MODE_2,
+    SPI_MODE_3
+} SPI_Clock_Mode;
+
+typedef enum {
+    SPI_FRAME_8 = 0,
+    SPI_FRAME_16
+} SPI_Frame_Size;
+
+typedef enum {
+    SPI_FIRST_BIT_MSB = 0,
+    SPI_FIRST_BIT_LSB
+} SPI_First_Bit;
+
+typedef enum {
+    SPI_TRANSACTION_IDLE = 0,
+    SPI_TRANSACTION_QUEUED,
+    SPI_TRANSACTION_ACTIVE,
+    SPI_TRANSACTION_DONE,
+    SPI_TRANSACTION_ERROR
+} SPI_Transaction_Status;
+
+
+/**********************************************************************************/
+/*                              Configuration Structs                             */
+/**********************************************************************************/
+
+typedef struct {
+/************************************ Required ************************************/
+    SPI_t              *instance;
+/************************************ Optional ************************************/
+    NVIC_Latency_Class interrupt_class;
+} SPI_Init_Config_t;
+
+typedef struct {
+/************************************ Required ************************************/
+    SPI_t              *instance;
+    GPIO_t             *cs_port;
+    GPIO_Pin           cs_pin;
+/************************************ Optional ************************************/
+    SPI_Clock_Divider  clock_divider;
+    SPI_Clock_Mode     clock_mode;
+    SPI_Frame_Size     frame_size;
+    SPI_First_Bit      first_bit;
+} SPI_Device_t;
+
+typedef struct SPI_Transaction {
+/************************************ Required ************************************/
+    SPI_Device_t           *device;
+    const void             *tx_buffer;          /* NULL clocks out SPI_DUMMY_FRAME */
+    void                   *rx_buffer;          /* NULL discards received frames */
+    uint16_t               length;              /* frames, bytes or half-words by frame size */
+/************************************ Optional ************************************/
+    Deferred_Work_t        callback;
+    uint32_t               argument;
+/********************************** Driver Owned **********************************/
+    volatile uint32_t      status;              /* SPI_Transaction_Status */
+    struct SPI_Transaction *next;
+} SPI_Transaction_t;
+
+
+/**********************************************************************************/
+/*                               Function Prototypes                              */
+/**********************************************************************************/
+
+Status                 SPI_Init(SPI_Init_Config_t *init_config);
+Status                 SPI_Device_Init(SPI_Device_t *device);
+Status                 SPI_Transfer(SPI_Transaction_t *transaction);
+SPI_Transaction_Status SPI_Get_Status(const SPI_Transaction_t *transaction);
+void                   DMA2_Stream2_IRQHandler(void);
+void                   DMA1_Stream3_IRQHandler(void);
+void                   DMA1_Stream0_IRQHandler(void);
+void                   DMA2_Stream3_IRQHandler(void);
+void                   DMA2_Stream5_IRQHandler(void);
+void                   DMA1_Stream4_IRQHandler(void);
+void                   DMA1_Stream7_IRQHandler(void);
+void                   DMA2_Stream4_IRQHandler(void);
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,189 @@
+#include "tim5.h"
+
+/**********************************************************************************/
+/*                                 Static Variables                               */
+/**********************************************************************************/
+
+static volatile uint32_t     tim5_epoch          = 0;
+static uint64_t              tim5_deadline       = TIM5_ALARM_NONE;
+static NVIC_Latency_Class    tim5_class          = NVIC_CLASS_TIMEBASE;
+static TIM5_Alarm_Callback_t tim5_alarm_callback;
+
+
+/**********************************************************************************/
+/*                                Static Functions                                */
+/**********************************************************************************/
+
+/**
+ * @brief  Loads the lower 32 bits of the deadline into the compare register
+ * @note   Called with the TIM5 interrupt masked. A deadline more than one counter period
+ *         away matches early, which the interrupt handler ignores until the upper bits agree.
+ *         If the deadline has already passed the compare event is forced
+ */
+static void TIM5_Arm_Alarm(void) {
+    if (tim5_deadline == TIM5_ALARM_NONE) {
+        TIM5->DIER &= ~(TIM_DIER_CC1IE);
+        return;
+    }
+
+    TIM5->CCR1 = (uint32_t) tim5_deadline;
+    TIM5->SR = (uint32_t) ~(TIM_SR_CC1IF);
+    TIM5->DIER |= TIM_DIER_CC1IE;
+
+    //the counter may have passed the compare value before it was written
+    if (TIM5_Time_Get_Us() >= tim5_deadline) {
+        TIM5->EGR = TIM_EGR_CC1G;
+    }
+}
+
+
+/**********************************************************************************/
+/*                              TIM5 Core Functions                               */
+/**********************************************************************************/
+
+/**
+ * @brief  Initialises TIM5 as a free-running 1us time base with a single compare alarm
+ * @note   The 32-bit counter is extended to 64 bits by an overflow count, so the only
+ *         periodic interrupt is one update every 71 minutes. Wakeups are requested with
+ *         @ref TIM5_Set_Alarm for the next deadline only
+ * @note   Assumes the system clock has reached its final frequency, as the prescaler is
+ *         derived from g_sys_clk_freq. TIM5 runs at the core clock with APB1 divided by 1 or 2
+ * @param  interrupt_class: Latency class of the TIM5 interrupt, NVIC_CLASS_TIMEBASE if 0
+ * @retval Status indicating success or invalid parameters
+ */
+Status TIM5_Time_Init(NVIC_Latency_Class interrupt_class) {
+    //claim interrupt
+    tim5_class = interrupt_class ? interrupt_class : NVIC_CLASS_TIMEBASE;
+    if (NVIC_Request_IRQ(TIM5_IRQn, tim5_class, TIM5) != SUCCESS) {
+        return INVALID_PARAM;
+    }
+
+    //enable TIM5 clock
+    RCC->APB1ENR |= RCC_APB1ENR_TIM5EN;
+    DSB();
+
+    //free-run over the full 32 bits at 1MHz
+    TIM5->CR1 = TIM_CR1_URS;
+    TIM5->PSC = ((g_sys_clk_freq / SEC_TO_MICRO) - 1UL);
+    TIM5->ARR = 0xFFFFFFFFUL;
+    TIM5->CCMR1 = CLEAR_REGISTER;
+    tim5_epoch    = 0;
+    tim5_deadline = TIM5_ALARM_NONE;
+
+    //load the prescaler and start from zero
+    TIM5->EGR = TIM_EGR_UG;
+    TIM5->SR = CLEAR_REGISTER;
+    TIM5->DIER = TIM_DIER_UIE;
+    NVIC_Enable_IRQ(TIM5_IRQn);
+    TIM5->CR1 |= TIM_CR1_CEN;
+
+    DSB();
+    return SUCCESS;
+}
+
+/**
+ * @brief  Reads the time since @ref TIM5_Time_Init in microseconds
+ * @note   Lock-free and callable from any context, including with interrupts masked. An
+ *         overflow that has happened but not yet been counted by the update interrupt is
+ *         added here
+ * @retval 64-bit monotonic time in microseconds
+ */
+uint64_t TIM5_Time_Get_Us(void) {
+    uint32_t epoch, count, pending;
+    do {
+        epoch   = tim5_epoch;
+        count   = TIM5->CNT;
+        pending = (TIM5->SR & TIM_SR_UIF);
+    } while (epoch != tim5_epoch);
+
+    //the counter has wrapped but the update interrupt has not run yet
+    if (pending && count < 0x80000000UL) {
+        epoch++;
+    }
+
+    return ((((uint64_t) epoch) << 32U) | count);
+}
+
+/**
+ * @brief  Requests the alarm callback at an absolute time, replacing any pending alarm
+ * @note   A deadline already in the past fires immediately from the TIM5 interrupt
+ * @param  deadline_us: Time from @ref TIM5_Time_Get_Us at which to call the alarm callback
+ * @retval Status indicating success or invalid parameters
+ */
+Status TIM5_Set_Alarm(uint64_t deadline_us) {
+    //validate deadline
+    if (deadline_us == TIM5_ALARM_NONE) {
+        return INVALID_PARAM;
+    }
+
+    uint32_t basepri = ENTER_CRITICAL_BASEPRI(NVIC_Class_To_BASEPRI(tim5_class));
+    tim5_deadline = deadline_us;
+    TIM5_Arm_Alarm();
+    EXIT_CRITICAL_BASEPRI(basepri);
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Cancels the pending alarm, if any
+ */
+void TIM5_Cancel_Alarm(void) {
+    uint32_t basepri = ENTER_CRITICAL_BASEPRI(NVIC_Class_To_BASEPRI(tim5_class));
+    tim5_deadline = TIM5_ALARM_NONE;
+    TIM5_Arm_Alarm();
+    EXIT_CRITICAL_BASEPRI(basepri);
+}
+
+/**
+ * @brief  Registers the function called when the alarm deadline is reached
+ * @note   The callback runs in the TIM5 interrupt with the current time, and may call
+ *         @ref TIM5_Set_Alarm to request the next deadline
+ * @note   The alarm has a single owner, so a callback is refused while a different one is
+ *         registered. Remove the current callback first to hand the alarm over
+ * @param  callback: Function called from interrupt context, or NULL to remove the callback
+ * @retval Status indicating success, or error if the alarm is owned by another callback
+ */
+Status TIM5_Register_Alarm_Callback(TIM5_Alarm_Callback_t callback) {
+    //validate alarm ownership
+    if (callback && tim5_alarm_callback && tim5_alarm_callback != callback) {
+        return ERROR;
+    }
+
+    tim5_alarm_callback = callback;
+
+    return SUCCESS;
+}
+
+
+/**********************************************************************************/
+/*                             TIM5 Interrupt Handlers                            */
+/**********************************************************************************/
+
+/** @brief  Counts counter overflows and dispatches the alarm */
+void TIM5_IRQHandler(void) {
+    //status flags are cleared by writing 0, so clear each one alone to keep the others
+    uint32_t status = TIM5->SR;
+
+    //count the overflow and clear its flag as one step, an interrupt preempting between
+    //the two would see neither the pending flag nor the new epoch and read time 2^32us back
+    if (status & TIM_SR_UIF) {
+        uint32_t primask = ENTER_CRITICAL();
+        tim5_epoch++;
+        TIM5->SR = (uint32_t) ~(TIM_SR_UIF);
+        EXIT_CRITICAL(primask);
+    }
+
+    if ((status & TIM_SR_CC1IF) && (TIM5->DIER & TIM_DIER_CC1IE)) {
+        TIM5->SR = (uint32_t) ~(TIM_SR_CC1IF);
+        uint64_t now = TIM5_Time_Get_Us();
+
+        //a match in an earlier counter period stays armed for the next one
+        if (now >= tim5_deadline) {
+            tim5_deadline = TIM5_ALARM_NONE;
+            TIM5->DIER &= ~(TIM_DIER_CC1IE);
+            if (tim5_alarm_callback) {
+                tim5_alarm_callback(now);
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+#ifndef __TIM5_H
+#define __TIM5_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../../utils/utils.h"
+
+
+/**********************************************************************************/
+/*                                     Defines                                    */
+/**********************************************************************************/
+
+#define TIM5_ALARM_NONE             (0xFFFFFFFFFFFFFFFFULL)
+
+
+/**********************************************************************************/
+/*                                 Callback Types                                 */
+/**********************************************************************************/
+
+typedef void (*TIM5_Alarm_Callback_t)(uint64_t now_us);
+
+
+/**********************************************************************************/
+/*                               Function Prototypes                              */
+/**********************************************************************************/
+
+Status   TIM5_Time_Init                 (NVIC_Latency_Class interrupt_class);
+uint64_t TIM5_Time_Get_Us               (void);
+Status   TIM5_Set_Alarm                 (uint64_t deadline_us);
+void     TIM5_Cancel_Alarm              (void);
+Status   TIM5_Register_Alarm_Callback   (TIM5_Alarm_Callback_t callback);
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
\ No newline at end of file
@@ -1,305 +1,661 @@
-#include "usart.h"
-
-/**********************************************************************************/
-/*                               USART Core Functions                             */
-/**********************************************************************************/
-
-//gpio pins should be configured prior to USART being initialised
-Status USART_Init(USART_Init_Config_t *init_config) {
-    //validate config struct pointer
-    if (!(init_config)) {
-        return INVALID_PARAM;
-    }
-
-    //validate instance
-    if ((init_config->instance   != USART1) && (init_config->instance != USART2)
-        && (init_config->instance != USART6)) {
-        return INVALID_PARAM;
-    }
-
-    //validate word length, oversampling, stop bits, one bit, parity control and selection
-    if (init_config->word_length         < 0 || init_config->word_length      > 1
-        || init_config->oversampling     < 0 || init_config->oversampling     > 1
-        || init_config->stop_bits        < 0 || init_config->stop_bits        > 2
-        || init_config->one_bit          < 0 || init_config->one_bit          > 1
-        || init_config->parity_control   < 0 || init_config->parity_control   > 1
-        || init_config->parity_selection < 0 || init_config->parity_selection > 1) {
-        return INVALID_PARAM;
-    }
-
-    //validate interrupt priority level
-    if (Validate_Priority(init_config->interrupt_priority) == INVALID_PARAM) {
-        return INVALID_PARAM;
-    }
-
-    //validate availability of interrupt priority level
-    if (!(priority_tracker[init_config->interrupt_priority])) {
-        return INVALID_PARAM;
-    }
-
-    //get USART index
-    USART_Index usart_index;
-    if (Get_USART_Index(init_config->instance) == USART_Index_Error) {
-        return INVALID_PARAM;
-    } else {
-        usart_index = Get_USART_Index(init_config->instance);
-    }
-
-    //store init config in global usart state struct
-    usart_states[usart_index].init_config = init_config;
-
-    //enable USART clock
-    if (init_config->instance == USART1) {
-        RCC->APB2ENR |= RCC_APB2ENR_USART1EN;
-    } else if (init_config->instance == USART2) {
-        RCC->APB1ENR |= RCC_APB1ENR_USART2EN;
-    } else if (init_config->instance == USART6) {
-        RCC->APB2ENR |= RCC_APB2ENR_USART6EN;
-    } else {
-        return INVALID_PARAM;
-    }
-
-    //calculate and configure USART_DIV
-    uint8_t over;
-    if (init_config->oversampling) {
-        over = 8U;
-    } else {
-        over = 16U;
-    }
-    float usart_div = (((float) g_sys_clk_freq) / ((float) (init_config->baud_rate * over)));
-    uint16_t mantissa = ((uint16_t) usart_div);
-    if (mantissa < 0x0UL || mantissa > 0xFFFUL) {
-        return INVALID_PARAM;
-    }
-    uint8_t fraction = round((usart_div - mantissa) * over);
-    mantissa = (mantissa << 4U);
-
-    if (over == 8U && fraction == 8U) {
-        mantissa += (0x1UL << 4U);
-        fraction = 0UL;
-    }
-
-    uint16_t brr = (mantissa + fraction);
-    init_config->instance->BRR = brr;
-
-    //configure word length
-    init_config->instance->CR1 &= ~(USART_CR1_M);
-    init_config->instance->CR1 |= (((uint32_t) init_config->word_length) << 12U);
-
-    //configure oversampling
-    init_config->instance->CR1 &= ~(USART_CR1_OVER8);
-    init_config->instance->CR1 |= (((uint32_t) init_config->oversampling) << 15U);
-
-    //configure stop bits
-    init_config->instance->CR2 &= ~(USART_CR2_STOP);
-    init_config->instance->CR2 |= (((uint32_t) init_config->stop_bits) << 12U);
-
-    //configure onebit
-    init_config->instance->CR3 &= ~(USART_CR3_ONEBIT);
-    init_config->instance->CR3 |= (((uint32_t) init_config->one_bit) << 11U);
-
-    //configure parity
-    init_config->instance->CR1 &= ~(USART_CR1_PCE);
-    init_config->instance->CR1 |= (((uint32_t) init_config->parity_control) << 10U);
-    init_config->instance->CR1 &= ~(USART_CR1_PS);
-    init_config->instance->CR1 |= (((uint32_t) init_config->parity_selection) << 9U);
-
-    //configure interrupts
-    if (init_config->pe_interrupt_enable) {
-        init_config->instance->CR1 |= USART_CR1_PEIE;
-    }
-    if (init_config->idle_interrupt_enable) {
-        init_config->instance->CR1 |= USART_CR1_IDLEIE;
-    }
-    if (init_config->cts_interrupt_enable) {
-        init_config->instance->CR3 |= USART_CR3_CTSIE;
-    }
-    if (init_config->error_interrupt_enable) {
-        init_config->instance->CR3 |= USART_CR3_EIE;
-    }
-    if (init_config->lbd_interrupt_enable) {
-        init_config->instance->CR2 |= USART_CR2_LBDIE;
-    }
-
-    DISABLE_IRQ();
-    if (init_config->instance == USART1) {
-        NVIC_Set_Priority(USART1_IRQn, init_config->interrupt_priority);
-        NVIC_Enable_IRQ(USART1_IRQn);
-    } else if (init_config->instance == USART2) {
-        NVIC_Set_Priority(USART2_IRQn, init_config->interrupt_priority);
-        NVIC_Enable_IRQ(USART2_IRQn);
-    } else {
-        NVIC_Set_Priority(USART6_IRQn, init_config->interrupt_priority);
-        NVIC_Enable_IRQ(USART6_IRQn);
-    }
-    ENABLE_IRQ();
-    
-    //record utilised interrupt priority level
-    priority_tracker[init_config->interrupt_priority] = 1U;
-
-    //enable transmitter and receiver
-    init_config->instance->CR1 |= (USART_CR1_TE | USART_CR1_RE);
-
-    //enable USART
-    init_config->instance->CR1 |= USART_CR1_UE;
-
-    return SUCCESS;
-}
-
-
-//include a note on how when a string is passed, strlen((char *) tx_data) should be used to find tx_length
-//otherwise tx_length should be specified
-Status USART_Transmit(USART_Init_Config_t *init_config, uint8_t *tx_data, uint16_t tx_length) {
-    //validate config struct pointer and length
-    if ((!(init_config)) || tx_length <= 0) {
-        return INVALID_PARAM;
-    }
-
-    //get USART index
-    USART_Index usart_index;
-    if (Get_USART_Index(init_config->instance) == USART_Index_Error) {
-        return INVALID_PARAM;
-    } else {
-        usart_index = Get_USART_Index(init_config->instance);
-    }
-
-    //check if USART is currently transmitting
-    if (usart_states[usart_index].tx_status == USART_BUSY) {
-        return ERROR;
-    }
-
-    //store and initialise transmitter parameters in global usart state struct
-    usart_states[usart_index].tx_buffer = tx_data;
-    usart_states[usart_index].tx_length = tx_length;
-    usart_states[usart_index].tx_index  = 0;
-    usart_states[usart_index].tx_status = USART_BUSY;
-
-    //enable TXE interrupts
-    init_config->instance->CR1 |= USART_CR1_TXEIE;
-
-    //transmit the first byte
-    init_config->instance->DR = usart_states[usart_index].tx_buffer[usart_states[usart_index].tx_index++];
-
-    return SUCCESS;
-}
-
-
-Status USART_Receive(USART_Init_Config_t *init_config, uint8_t *rx_buffer, uint16_t rx_length) {
-    //validate config struct pointer and length
-    if ((!(init_config)) || rx_length <= 0) {
-        return INVALID_PARAM;
-    }
-
-    //get usart index
-    USART_Index usart_index;
-    if (Get_USART_Index(init_config->instance) == USART_Index_Error) {
-        return INVALID_PARAM;
-    } else {
-        usart_index = Get_USART_Index(init_config->instance);
-    }
-
-    //check if USART is currently receiving
-    if (usart_states[usart_index].rx_status == USART_BUSY) {
-        return ERROR;
-    }
-
-    //store and intitialise receiver parameters in global usart state struct
-    usart_states[usart_index].rx_buffer = rx_buffer;
-    usart_states[usart_index].rx_length = rx_length;
-    usart_states[usart_index].rx_index  = 0;
-    usart_states[usart_index].rx_status = USART_BUSY;
-
-    //enable RXNE interrupts
-    init_config->instance->CR1 |= USART_CR1_RXNEIE;
-
-    return SUCCESS;
-}
-
-
-//write USART_Deinit()
-
-//check TC=1 before disabling USART
-//RE should not be reset while receiving data, RXNE=0
-
-
-
-static USART_Index Get_USART_Index(USART_t *instance) {
-    if (instance == USART1) {
-        return USART1_Index;
-    } else if (instance == USART2) {
-        return USART2_Index;
-    } else if (instance == USART6) {
-        return USART6_Index;
-    } else {
-        return USART_Index_Error;
-    }
-}
-
-
-/**********************************************************************************/
-/*                            USART Interrupt Handlers                            */
-/**********************************************************************************/
-
-void USART_IRQHandler(USART_Index usart_index) {
-    //alias usart state and usart state config
-    USART_State_Config_t *usart_state = &usart_states[usart_index];
-    USART_Init_Config_t *config       = usart_state->init_config;
-
-    //handle TXE interrupt
-    if (config->instance->SR & USART_SR_TXE) {
-        if (usart_state->tx_index < usart_state->tx_length) {
-            config->instance->DR = usart_state->tx_buffer[usart_state->tx_index++];
-        } else {
-            config->instance->CR1 &= ~(USART_CR1_TXEIE);
-            config->instance->CR1 |= USART_CR1_TCIE;
-        }        
-    }
-
-    //handle RXNE interrupt
-    if (config->instance->SR & USART_SR_RXNE) {
-        //check for errors
-        USART_RX_Error error = USART_ERROR_NONE;
-        if (config->instance->SR & USART_SR_ORE) {
-            error = USART_ERROR_OVERRUN;
-        } else if (config->instance->SR & USART_SR_FE) {
-            error = USART_ERROR_FRAMING;
-        } else if (config->instance->SR & USART_SR_NF) {
-            error = USART_ERROR_NOISE;
-        }
-
-        //read data to clear RXNE and error flags
-        uint8_t data = config->instance->DR;                            /* validate in docs */
-
-        if (error == USART_ERROR_NONE && (usart_state->rx_status == USART_BUSY)) {
-            //store byte in buffer
-            usart_state->rx_buffer[usart_state->rx_index++] = data;
-            
-            //check for receiption of all bytes
-            if (usart_state->rx_index >= usart_state->rx_length) {
-                usart_state->rx_status = USART_IDLE;
-            }
-        } else if (error != USART_ERROR_NONE) {
-            usart_state->rx_status = USART_IDLE;
-        }
-    }
-
-    //handle TC interrupt
-    if (config->instance->SR & USART_SR_TC) {
-        config->instance->CR1 &= ~(USART_CR1_TCIE);
-        usart_state->tx_status   = USART_IDLE;
-    }
-}
-
-void USART1_IRQHandler(void) {
-     USART_IRQHandler(USART1_Index);
-}
-
-void USART2_IRQHandler(void) {
-     USART_IRQHandler(USART2_Index);
-}
-
-void USART6_IRQHandler(void) {
-     USART_IRQHandler(USART6_Index);
-}
-
-
+#include "usart.h"
+
+/**********************************************************************************/
+/*                          Specialised Handler Prototypes                        */
+/**********************************************************************************/
+
+static void USART1_TX_IRQHandler(void);
+static void USART2_TX_IRQHandler(void);
+static void USART6_TX_IRQHandler(void);
+static void USART1_RX_IRQHandler(void);
+static void USART2_RX_IRQHandler(void);
+static void USART6_RX_IRQHandler(void);
+
+/* specialised handlers indexed by USART_Index and USART_Handler_Mode - 1 */
+static const ISR_Handler_t usart_specialised_handlers[3][2] = {
+    {USART1_TX_IRQHandler, USART1_RX_IRQHandler},
+    {USART2_TX_IRQHandler, USART2_RX_IRQHandler},
+    {USART6_TX_IRQHandler, USART6_RX_IRQHandler}
+};
+
+/**********************************************************************************/
+/*                               USART Core Functions                             */
+/**********************************************************************************/
+
+//gpio pins should be configured prior to USART being initialised
+Status USART_Init(USART_Init_Config_t *init_config) {
+    //validate config struct pointer
+    if (!(init_config)) {
+        return INVALID_PARAM;
+    }
+
+    //validate instance
+    if ((init_config->instance   != USART1) && (init_config->instance != USART2)
+        && (init_config->instance != USART6)) {
+        return INVALID_PARAM;
+    }
+
+    //validate word length, oversampling, stop bits, one bit, parity control and selection
+    if (init_config->word_length         < 0 || init_config->word_length      > 1
+        || init_config->oversampling     < 0 || init_config->oversampling     > 1
+        || init_config->stop_bits        < 0 || init_config->stop_bits        > 2
+        || init_config->one_bit          < 0 || init_config->one_bit          > 1
+        || init_config->parity_control   < 0 || init_config->parity_control   > 1
+        || init_config->parity_selection < 0 || init_config->parity_selection > 1) {
+        return INVALID_PARAM;
+    }
+
+    //validate handler mode, specialised handlers require a relocated vector table
+    if (init_config->handler_mode < USART_HANDLER_GENERIC || init_config->handler_mode > USART_HANDLER_RX_ONLY
+        || (init_config->handler_mode != USART_HANDLER_GENERIC && !(Vector_Table_Is_Relocated()))) {
+        return INVALID_PARAM;
+    }
+
+    //validate interrupts, the specialised handlers only service TXE and TC, or RXNE
+    if (init_config->handler_mode != USART_HANDLER_GENERIC
+        && (init_config->pe_interrupt_enable || init_config->idle_interrupt_enable
+            || init_config->cts_interrupt_enable || init_config->lbd_interrupt_enable)) {
+        return INVALID_PARAM;
+    }
+
+    //get USART index
+    USART_Index usart_index;
+    if (Get_USART_Index(init_config->instance) == USART_Index_Error) {
+        return INVALID_PARAM;
+    } else {
+        usart_index = Get_USART_Index(init_config->instance);
+    }
+
+    //claim USART interrupt
+    IRQn_t usart_irqn;
+    switch (usart_index) {
+        case USART1_Index: usart_irqn = USART1_IRQn; break;
+        case USART2_Index: usart_irqn = USART2_IRQn; break;
+        default: usart_irqn = USART6_IRQn; break;
+    }
+    NVIC_Latency_Class latency_class = init_config->interrupt_class ? init_config->interrupt_class
+                                                                    : NVIC_CLASS_COMMS;
+    if (NVIC_Request_IRQ(usart_irqn, latency_class, init_config->instance) != SUCCESS) {
+        return INVALID_PARAM;
+    }
+
+    //store init config in global usart state struct
+    usart_states[usart_index].init_config = init_config;
+
+    //enable USART clock
+    if (init_config->instance == USART1) {
+        RCC->APB2ENR |= RCC_APB2ENR_USART1EN;
+    } else if (init_config->instance == USART2) {
+        RCC->APB1ENR |= RCC_APB1ENR_USART2EN;
+    } else if (init_config->instance == USART6) {
+        RCC->APB2ENR |= RCC_APB2ENR_USART6EN;
+    } else {
+        return INVALID_PARAM;
+    }
+
+    //calculate and configure USART_DIV
+    uint8_t over;
+    if (init_config->oversampling) {
+        over = 8U;
+    } else {
+        over = 16U;
+    }
+    uint32_t pclk   = (init_config->instance == USART2) ? g_apb1_clk_freq : g_sys_clk_freq;
+    float usart_div = (((float) pclk) / ((float) (init_config->baud_rate * over)));
+    uint16_t mantissa = ((uint16_t) usart_div);
+    if (mantissa < 0x0UL || mantissa > 0xFFFUL) {
+        return INVALID_PARAM;
+    }
+    uint8_t fraction = round((usart_div - mantissa) * over);
+    mantissa = (mantissa << 4U);
+
+    if (over == 8U && fraction == 8U) {
+        mantissa += (0x1UL << 4U);
+        fraction = 0UL;
+    }
+
+    uint16_t brr = (mantissa + fraction);
+    init_config->instance->BRR = brr;
+
+    //configure word length
+    init_config->instance->CR1 &= ~(USART_CR1_M);
+    init_config->instance->CR1 |= (((uint32_t) init_config->word_length) << 12U);
+
+    //configure oversampling
+    init_config->instance->CR1 &= ~(USART_CR1_OVER8);
+    init_config->instance->CR1 |= (((uint32_t) init_config->oversampling) << 15U);
+
+    //configure stop bits
+    init_config->instance->CR2 &= ~(USART_CR2_STOP);
+    init_config->instance->CR2 |= (((uint32_t) init_config->stop_bits) << 12U);
+
+    //configure onebit
+    init_config->instance->CR3 &= ~(USART_CR3_ONEBIT);
+    init_config->instance->CR3 |= (((uint32_t) init_config->one_bit) << 11U);
+
+    //configure parity
+    init_config->instance->CR1 &= ~(USART_CR1_PCE);
+    init_config->instance->CR1 |= (((uint32_t) init_config->parity_control) << 10U);
+    init_config->instance->CR1 &= ~(USART_CR1_PS);
+    init_config->instance->CR1 |= (((uint32_t) init_config->parity_selection) << 9U);
+
+    //configure interrupts
+    if (init_config->pe_interrupt_enable) {
+        init_config->instance->CR1 |= USART_CR1_PEIE;
+    }
+    if (init_config->idle_interrupt_enable) {
+        init_config->instance->CR1 |= USART_CR1_IDLEIE;
+    }
+    if (init_config->cts_interrupt_enable) {
+        init_config->instance->CR3 |= USART_CR3_CTSIE;
+    }
+    if (init_config->error_interrupt_enable) {
+        init_config->instance->CR3 |= USART_CR3_EIE;
+    }
+    if (init_config->lbd_interrupt_enable) {
+        init_config->instance->CR2 |= USART_CR2_LBDIE;
+    }
+
+    //install specialised handler
+    if (init_config->handler_mode != USART_HANDLER_GENERIC) {
+        NVIC_Register_Handler(usart_irqn, usart_specialised_handlers[usart_index][init_config->handler_mode - 1U]);
+    }
+
+    NVIC_Enable_IRQ(usart_irqn);
+
+    //enable transmitter and receiver, a specialised handler only enables the direction it services
+    uint32_t directions = (USART_CR1_TE | USART_CR1_RE);
+    if (init_config->handler_mode == USART_HANDLER_TX_ONLY) {
+        directions = USART_CR1_TE;
+    } else if (init_config->handler_mode == USART_HANDLER_RX_ONLY) {
+        directions = USART_CR1_RE;
+    }
+    init_config->instance->CR1 = ((init_config->instance->CR1 & ~(USART_CR1_TE | USART_CR1_RE)) | directions);
+
+    //enable USART
+    init_config->instance->CR1 |= USART_CR1_UE;
+
+    return SUCCESS;
+}
+
+
+//include a note on how when a string is passed, strlen((char *) tx_data) should be used to find tx_length
+//otherwise tx_length should be specified
+Status USART_Transmit(USART_Init_Config_t *init_config, uint8_t *tx_data, uint16_t tx_length) {
+    //validate config struct pointer, length and direction
+    if ((!(init_config)) || tx_length <= 0 || init_config->handler_mode == USART_HANDLER_RX_ONLY) {
+        return INVALID_PARAM;
+    }
+
+    //get USART index
+    USART_Index usart_index;
+    if (Get_USART_Index(init_config->instance) == USART_Index_Error) {
+        return INVALID_PARAM;
+    } else {
+        usart_index = Get_USART_Index(init_config->instance);
+    }
+
+    //claim the transmitter, fails if USART is currently transmitting
+    //the ISR cannot observe the parameters before TXE interrupts are enabled below
+    if (!(ATOMIC_CAS(&usart_states[usart_index].tx_status, USART_IDLE, USART_BUSY))) {
+        return ERROR;
+    }
+
+    //store and initialise transmitter parameters in global usart state struct
+    usart_states[usart_index].tx_buffer = tx_data;
+    usart_states[usart_index].tx_length = tx_length;
+    usart_states[usart_index].tx_index  = 0;
+
+    //enable TXE interrupts
+    init_config->instance->CR1 |= USART_CR1_TXEIE;
+
+    //transmit the first byte
+    init_config->instance->DR = usart_states[usart_index].tx_buffer[usart_states[usart_index].tx_index++];
+
+    return SUCCESS;
+}
+
+
+Status USART_Receive(USART_Init_Config_t *init_config, uint8_t *rx_buffer, uint16_t rx_length) {
+    //validate config struct pointer, length and direction
+    if ((!(init_config)) || rx_length <= 0 || init_config->handler_mode == USART_HANDLER_TX_ONLY) {
+        return INVALID_PARAM;
+    }
+
+    //get usart index
+    USART_Index usart_index;
+    if (Get_USART_Index(init_config->instance) == USART_Index_Error) {
+        return INVALID_PARAM;
+    } else {
+        usart_index = Get_USART_Index(init_config->instance);
+    }
+
+    //claim the receiver, fails if USART is currently receiving
+    //the ISR ignores received bytes until the status is published as busy
+    if (!(ATOMIC_CAS(&usart_states[usart_index].rx_status, USART_IDLE, USART_CLAIMED))) {
+        return ERROR;
+    }
+
+    //store and intitialise receiver parameters in global usart state struct
+    usart_states[usart_index].rx_buffer = rx_buffer;
+    usart_states[usart_index].rx_length = rx_length;
+    usart_states[usart_index].rx_index  = 0;
+    DMB();
+    usart_states[usart_index].rx_status = USART_BUSY;
+
+    //enable RXNE interrupts
+    init_config->instance->CR1 |= USART_CR1_RXNEIE;
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Starts receiving continuously into a ring buffer
+ * @note   Reception never ends, so bytes arriving while the reader is busy are kept instead
+ *         of being lost until the next @ref USART_Receive. Bytes are taken with
+ *         @ref USART_Read. The receive notification is posted each time the ring goes from
+ *         empty to holding a byte, so the notified work reads until @ref USART_Read returns 0
+ * @note   Bytes received with an error or while the ring is full are dropped and counted,
+ *         see @ref USART_Get_RX_Dropped
+ * @param  init_config: Pointer to USART_Init_Config structure
+ * @param  ring:        Pointer to the ring buffer, which must stay valid
+ * @param  ring_size:   Size of the ring buffer, which holds up to ring_size - 1 bytes
+ * @retval Status indicating success, invalid parameters, including a USART that only
+ *         transmits, or error if the USART is receiving
+ */
+Status USART_Receive_Continuous(USART_Init_Config_t *init_config, uint8_t *ring, uint16_t ring_size) {
+    //validate config struct pointer, ring, size and direction
+    if (!(init_config) || !ring || ring_size < 2U || init_config->handler_mode == USART_HANDLER_TX_ONLY) {
+        return INVALID_PARAM;
+    }
+
+    //get usart index
+    USART_Index usart_index = Get_USART_Index(init_config->instance);
+    if (usart_index == USART_Index_Error) {
+        return INVALID_PARAM;
+    }
+
+    //claim the receiver for good, the ISR ignores received bytes until it is published as busy
+    USART_State_Config_t *usart_state = &usart_states[usart_index];
+    if (!(ATOMIC_CAS(&usart_state->rx_status, USART_IDLE, USART_CLAIMED))) {
+        return ERROR;
+    }
+
+    usart_state->rx_buffer     = ring;
+    usart_state->rx_length     = ring_size;
+    usart_state->rx_index      = 0;
+    usart_state->rx_tail       = 0;
+    usart_state->rx_dropped    = 0;
+    usart_state->rx_continuous = 1U;
+    DMB();
+    usart_state->rx_status     = USART_BUSY;
+
+    //enable RXNE interrupts
+    init_config->instance->CR1 |= USART_CR1_RXNEIE;
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Takes received bytes from a continuous reception
+ * @param  instance: USART instance
+ * @param  data:     Pointer to store the bytes
+ * @param  length:   Maximum number of bytes to take
+ * @retval Number of bytes taken, 0 once the ring is empty or if reception is not continuous
+ */
+uint16_t USART_Read(USART_t *instance, uint8_t *data, uint16_t length) {
+    USART_Index usart_index = Get_USART_Index(instance);
+    if (usart_index == USART_Index_Error || !data || !usart_states[usart_index].rx_continuous) {
+        return 0;
+    }
+
+    //only the ISR moves the head and only the reader moves the tail
+    USART_State_Config_t *usart_state = &usart_states[usart_index];
+    uint16_t head  = usart_state->rx_index;
+    uint16_t tail  = usart_state->rx_tail;
+    uint16_t count = 0;
+    DMB();
+    while (tail != head && count < length) {
+        data[count++] = usart_state->rx_buffer[tail];
+        tail = (uint16_t) ((tail + 1U == usart_state->rx_length) ? 0 : (tail + 1U));
+    }
+    usart_state->rx_tail = tail;
+
+    return count;
+}
+
+
+/**
+ * @brief  Registers work to be posted when a transfer on a USART finishes
+ * @note   The ISR only queues the work via @ref Deferred_Post, it runs later from PendSV.
+ *         The receive notification is also posted when a reception ends on an error, which
+ *         @ref USART_Get_RX_Count tells apart. Pass @ref Coroutine_Resume with the coroutine
+ *         as argument to resume a coroutine awaiting the transfer. A notification the full
+ *         queue rejects is posted again on the next interrupt of the instance
+ * @param  instance:  USART instance
+ * @param  tx_notify: Work posted once the last byte has left the shift register, may be NULL
+ * @param  rx_notify: Work posted once a reception ends, may be NULL
+ * @param  argument:  Argument passed to both
+ * @retval Status indicating success, invalid parameters, or error if PendSV is unavailable
+ */
+Status USART_Register_Notify(USART_t *instance, Deferred_Work_t tx_notify, Deferred_Work_t rx_notify,
+                             uint32_t argument) {
+    //validate instance
+    USART_Index usart_index = Get_USART_Index(instance);
+    if (usart_index == USART_Index_Error) {
+        return INVALID_PARAM;
+    }
+
+    //notifications are run from PendSV
+    if ((tx_notify || rx_notify) && Deferred_Init() != SUCCESS) {
+        return ERROR;
+    }
+
+    //detach the handlers while they are replaced
+    usart_states[usart_index].tx_notify       = 0;
+    usart_states[usart_index].rx_notify       = 0;
+    usart_states[usart_index].notify_argument = argument;
+    usart_states[usart_index].notify_pending  = 0;
+    usart_states[usart_index].tx_notify       = tx_notify;
+    usart_states[usart_index].rx_notify       = rx_notify;
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Reads whether a USART is transmitting
+ * @param  instance: USART instance
+ * @retval USART_IDLE once the last transmission has completed, otherwise USART_BUSY
+ */
+USART_Status USART_Get_TX_Status(USART_t *instance) {
+    USART_Index usart_index = Get_USART_Index(instance);
+    if (usart_index == USART_Index_Error) {
+        return USART_IDLE;
+    }
+
+    return (USART_Status) usart_states[usart_index].tx_status;
+}
+
+/**
+ * @brief  Reads whether a USART is receiving
+ * @param  instance: USART instance
+ * @retval USART_IDLE once a reception has completed or ended on an error, otherwise
+ *         USART_BUSY or USART_CLAIMED
+ */
+USART_Status USART_Get_RX_Status(USART_t *instance) {
+    USART_Index usart_index = Get_USART_Index(instance);
+    if (usart_index == USART_Index_Error) {
+        return USART_IDLE;
+    }
+
+    return (USART_Status) usart_states[usart_index].rx_status;
+}
+
+/**
+ * @brief  Reads the number of bytes stored by the current or last reception
+ * @note   Less than the requested length after a reception ended on an error. During a
+ *         continuous reception this is the write position in the ring
+ * @param  instance: USART instance
+ * @retval Number of bytes received
+ */
+uint16_t USART_Get_RX_Count(USART_t *instance) {
+    USART_Index usart_index = Get_USART_Index(instance);
+    if (usart_index == USART_Index_Error) {
+        return 0;
+    }
+
+    return usart_states[usart_index].rx_index;
+}
+
+/**
+ * @brief  Reads the number of bytes a continuous reception has dropped
+ * @note   Counts bytes received with an overrun, framing or noise error, and bytes that
+ *         arrived while the ring was full
+ * @param  instance: USART instance
+ * @retval Number of dropped bytes since @ref USART_Receive_Continuous
+ */
+uint32_t USART_Get_RX_Dropped(USART_t *instance) {
+    USART_Index usart_index = Get_USART_Index(instance);
+    if (usart_index == USART_Index_Error) {
+        return 0;
+    }
+
+    return usart_states[usart_index].rx_dropped;
+}
+
+
+//write USART_Deinit()
+
+//check TC=1 before disabling USART
+//RE should not be reset while receiving data, RXNE=0
+
+
+
+static USART_Index Get_USART_Index(USART_t *instance) {
+    if (instance == USART1) {
+        return USART1_Index;
+    } else if (instance == USART2) {
+        return USART2_Index;
+    } else if (instance == USART6) {
+        return USART6_Index;
+    } else {
+        return USART_Index_Error;
+    }
+}
+
+
+/**********************************************************************************/
+/*                            USART Interrupt Handlers                            */
+/**********************************************************************************/
+
+/**
+ * @brief  Posts the completion work registered via @ref USART_Register_Notify, if any
+ * @note   A post rejected by a full deferred queue is latched in notify_pending and posted
+ *         again by the next service pass of the instance, so a waiting coroutine is woken
+ *         late rather than never
+ */
+__attribute__((always_inline)) static inline void USART_Notify(USART_State_Config_t *usart_state,
+                                                               Deferred_Work_t notify, uint32_t pending) {
+    if (notify && Deferred_Post(notify, usart_state->notify_argument) != SUCCESS) {
+        usart_state->notify_pending |= pending;
+    }
+}
+
+/* reposts notifications latched by USART_Notify, called at the start of each service pass */
+__attribute__((always_inline)) static inline void USART_Retry_Notify(USART_State_Config_t *usart_state) {
+    uint32_t pending = usart_state->notify_pending;
+    if (!pending) {
+        return;
+    }
+
+    usart_state->notify_pending = 0;
+    if (pending & USART_NOTIFY_PENDING_TX) {
+        USART_Notify(usart_state, usart_state->tx_notify, USART_NOTIFY_PENDING_TX);
+    }
+    if (pending & USART_NOTIFY_PENDING_RX) {
+        USART_Notify(usart_state, usart_state->rx_notify, USART_NOTIFY_PENDING_RX);
+    }
+}
+
+/**
+ * @brief  Stores a byte of a continuous reception in the ring
+ * @note   The receive notification is only posted when the ring goes from empty to holding a
+ *         byte, the reader drains the ring in one pass, see @ref USART_Receive_Continuous
+ */
+__attribute__((always_inline)) static inline void USART_Store_Continuous(USART_State_Config_t *usart_state,
+                                                                         uint8_t data, uint32_t error) {
+    uint16_t head = usart_state->rx_index;
+    uint16_t next = (uint16_t) ((head + 1U == usart_state->rx_length) ? 0 : (head + 1U));
+    if (error || next == usart_state->rx_tail) {
+        usart_state->rx_dropped++;
+        return;
+    }
+
+    usart_state->rx_buffer[head] = data;
+    DMB();
+    usart_state->rx_index = next;
+    if (head == usart_state->rx_tail) {
+        USART_Notify(usart_state, usart_state->rx_notify, USART_NOTIFY_PENDING_RX);
+    }
+}
+
+void USART_IRQHandler(USART_Index usart_index) {
+    //alias usart state and usart state config
+    USART_State_Config_t *usart_state = &usart_states[usart_index];
+    USART_Init_Config_t *config       = usart_state->init_config;
+    USART_Retry_Notify(usart_state);
+
+    //TXE and TC read set whenever the transmitter is idle, so only act on enabled sources
+    uint32_t sr  = config->instance->SR;
+    uint32_t cr1 = config->instance->CR1;
+
+    //handle TXE interrupt
+    if ((sr & USART_SR_TXE) && (cr1 & USART_CR1_TXEIE)) {
+        if (usart_state->tx_index < usart_state->tx_length) {
+            config->instance->DR = usart_state->tx_buffer[usart_state->tx_index++];
+        } else {
+            config->instance->CR1 &= ~(USART_CR1_TXEIE);
+            config->instance->CR1 |= USART_CR1_TCIE;
+        }        
+    }
+
+    //handle RXNE interrupt
+    if (config->instance->SR & USART_SR_RXNE) {
+        //check for errors
+        USART_RX_Error error = USART_ERROR_NONE;
+        if (config->instance->SR & USART_SR_ORE) {
+            error = USART_ERROR_OVERRUN;
+        } else if (config->instance->SR & USART_SR_FE) {
+            error = USART_ERROR_FRAMING;
+        } else if (config->instance->SR & USART_SR_NF) {
+            error = USART_ERROR_NOISE;
+        }
+
+        //read data to clear RXNE and error flags
+        uint8_t data = config->instance->DR;                            /* validate in docs */
+
+        if (usart_state->rx_continuous && (usart_state->rx_status == USART_BUSY)) {
+            USART_Store_Continuous(usart_state, data, error);
+        } else if (error == USART_ERROR_NONE && (usart_state->rx_status == USART_BUSY)) {
+            //store byte in buffer
+            usart_state->rx_buffer[usart_state->rx_index++] = data;
+            
+            //check for receiption of all bytes
+            if (usart_state->rx_index >= usart_state->rx_length) {
+                usart_state->rx_status = USART_IDLE;
+                USART_Notify(usart_state, usart_state->rx_notify, USART_NOTIFY_PENDING_RX);
+            }
+        } else if (error != USART_ERROR_NONE && (usart_state->rx_status == USART_BUSY)) {
+            usart_state->rx_status = USART_IDLE;
+            USART_Notify(usart_state, usart_state->rx_notify, USART_NOTIFY_PENDING_RX);
+        }
+    }
+
+    //handle TC interrupt
+    if ((sr & USART_SR_TC) && (cr1 & USART_CR1_TCIE)) {
+        config->instance->CR1 &= ~(USART_CR1_TCIE);
+        usart_state->tx_status   = USART_IDLE;
+        USART_Notify(usart_state, usart_state->tx_notify, USART_NOTIFY_PENDING_TX);
+    }
+}
+
+void USART1_IRQHandler(void) {
+     USART_IRQHandler(USART1_Index);
+}
+
+void USART2_IRQHandler(void) {
+     USART_IRQHandler(USART2_Index);
+}
+
+void USART6_IRQHandler(void) {
+     USART_IRQHandler(USART6_Index);
+}
+
+
+/**********************************************************************************/
+/*                       USART Specialised Interrupt Handlers                     */
+/**********************************************************************************/
+
+/**
+ * @brief  Services TXE and TC for a USART that only transmits
+ * @note   Inlined into a handler per instance so the instance and state addresses are
+ *         constants and the RXNE and error checks of @ref USART_IRQHandler are skipped
+ */
+__attribute__((always_inline)) static inline void USART_TX_Service(USART_State_Config_t *usart_state,
+                                                                   USART_t *instance) {
+    USART_Retry_Notify(usart_state);
+    uint32_t sr = instance->SR;
+
+    //handle TXE interrupt
+    if ((sr & USART_SR_TXE) && (instance->CR1 & USART_CR1_TXEIE)) {
+        if (usart_state->tx_index < usart_state->tx_length) {
+            instance->DR = usart_state->tx_buffer[usart_state->tx_index++];
+        } else {
+            instance->CR1 &= ~(USART_CR1_TXEIE);
+            instance->CR1 |= USART_CR1_TCIE;
+        }
+        return;
+    }
+
+    //handle TC interrupt
+    if ((sr & USART_SR_TC) && (instance->CR1 & USART_CR1_TCIE)) {
+        instance->CR1 &= ~(USART_CR1_TCIE);
+        usart_state->tx_status = USART_IDLE;
+        USART_Notify(usart_state, usart_state->tx_notify, USART_NOTIFY_PENDING_TX);
+    }
+}
+
+/**
+ * @brief  Services RXNE for a USART that only receives
+ * @note   Inlined into a handler per instance, see @ref USART_TX_Service
+ */
+__attribute__((always_inline)) static inline void USART_RX_Service(USART_State_Config_t *usart_state,
+                                                                   USART_t *instance) {
+    USART_Retry_Notify(usart_state);
+    uint32_t sr = instance->SR;
+    if (!(sr & USART_SR_RXNE)) {
+        return;
+    }
+
+    //read data to clear RXNE and error flags
+    uint8_t data = instance->DR;
+
+    if (usart_state->rx_status != USART_BUSY) {
+        return;
+    } else if (usart_state->rx_continuous) {
+        USART_Store_Continuous(usart_state, data, (sr & (USART_SR_ORE | USART_SR_FE | USART_SR_NF)));
+    } else if (sr & (USART_SR_ORE | USART_SR_FE | USART_SR_NF)) {
+        usart_state->rx_status = USART_IDLE;
+        USART_Notify(usart_state, usart_state->rx_notify, USART_NOTIFY_PENDING_RX);
+    } else {
+        usart_state->rx_buffer[usart_state->rx_index++] = data;
+        if (usart_state->rx_index >= usart_state->rx_length) {
+            usart_state->rx_status = USART_IDLE;
+            USART_Notify(usart_state, usart_state->rx_notify, USART_NOTIFY_PENDING_RX);
+        }
+    }
+}
+
+static void USART1_TX_IRQHandler(void) {
+    USART_TX_Service(&usart_states[USART1_Index], USART1);
+}
+
+static void USART2_TX_IRQHandler(void) {
+    USART_TX_Service(&usart_states[USART2_Index], USART2);
+}
+
+static void USART6_TX_IRQHandler(void) {
+    USART_TX_Service(&usart_states[USART6_Index], USART6);
+}
+
+static void USART1_RX_IRQHandler(void) {
+    USART_RX_Service(&usart_states[USART1_Index], USART1);
+}
+
+static void USART2_RX_IRQHandler(void) {
+    USART_RX_Service(&usart_states[USART2_Index], USART2);
+}
+
+static void USART6_RX_IRQHandler(void) {
+    USART_RX_Service(&usart_states[USART6_Index], USART6);
+}
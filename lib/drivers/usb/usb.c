@@ -0,0 +1,835 @@
+#include "usb.h"
+
+/**********************************************************************************/
+/*                                 Static Variables                               */
+/**********************************************************************************/
+
+/* transfer in progress on one direction of an endpoint */
+typedef struct {
+    const uint8_t *tx_buffer;
+    uint8_t       *rx_buffer;
+    uint16_t      length;
+    uint16_t      count;
+    uint16_t      max_packet;
+} USB_Endpoint_State_t;
+
+static const uint16_t       usb_tx_fifo_words[USB_ENDPOINT_COUNT] = USB_TX_FIFO_WORDS;
+
+static USB_Init_Config_t    *usb_config;
+static USB_Endpoint_State_t usb_in[USB_ENDPOINT_COUNT];
+static USB_Endpoint_State_t usb_out[USB_ENDPOINT_COUNT];
+static volatile uint32_t    usb_state           = USB_STATE_DETACHED;
+static uint32_t             usb_resume_state    = USB_STATE_DETACHED;
+static uint8_t              usb_configuration   = 0;
+
+/* control transfer, the SETUP packet is popped from the FIFO a word at a time */
+static union {
+    uint32_t    words[2];
+    USB_Setup_t request;
+} usb_setup;
+static USB_EP0_Stage        usb_ep0_stage       = USB_EP0_IDLE;
+static const uint8_t        *usb_ep0_tx_data;
+static uint8_t              *usb_ep0_rx_data;
+static uint16_t             usb_ep0_remaining   = 0;
+static uint8_t              usb_ep0_zlp         = 0;
+static uint8_t              usb_ep0_reply[2];
+
+
+/**********************************************************************************/
+/*                                Static Functions                                */
+/**********************************************************************************/
+
+static Status USB_Wait_Flag(volatile uint32_t *reg, uint32_t mask, uint32_t set, uint32_t timeout_us) {
+    uint32_t start  = Cycle_Counter_Get();
+    uint32_t cycles = ((g_sys_clk_freq / SEC_TO_MICRO) * timeout_us);
+    while (((*reg & mask) ? 1U : 0) != set) {
+        if ((Cycle_Counter_Get() - start) > cycles) {
+            return ERROR;
+        }
+    }
+
+    return SUCCESS;
+}
+
+static void USB_Delay_Us(uint32_t delay_us) {
+    uint32_t start  = Cycle_Counter_Get();
+    uint32_t cycles = ((g_sys_clk_freq / SEC_TO_MICRO) * delay_us);
+    while ((Cycle_Counter_Get() - start) < cycles);
+}
+
+static Status USB_Flush_FIFOs(void) {
+    USB_OTG_FS->GRSTCTL = (USB_OTG_GRSTCTL_TXFFLSH | USB_OTG_GRSTCTL_TXFNUM_ALL);
+    if (USB_Wait_Flag(&USB_OTG_FS->GRSTCTL, USB_OTG_GRSTCTL_TXFFLSH, 0, 1000U) != SUCCESS) {
+        return ERROR;
+    }
+    USB_OTG_FS->GRSTCTL = USB_OTG_GRSTCTL_RXFFLSH;
+
+    return USB_Wait_Flag(&USB_OTG_FS->GRSTCTL, USB_OTG_GRSTCTL_RXFFLSH, 0, 1000U);
+}
+
+/**
+ * @brief  Pops a received packet from the shared receive FIFO into its destination
+ * @note   Aligned destinations with room for the word padding take whole words, so bulk
+ *         data lands in the consumer's buffer without a bounce copy. Bytes beyond the space
+ *         left in the buffer are popped and dropped
+ */
+static void USB_Read_FIFO(uint8_t *buffer, uint16_t length, uint16_t space) {
+    uint16_t words = ((length + 3U) / 4U);
+
+    if (buffer && !((uintptr_t) buffer & 3U) && space >= (words * 4U)) {
+        uint32_t *destination = (uint32_t *) (uintptr_t) buffer;
+        for (uint16_t i = 0; i < words; i++) {
+            destination[i] = USB_OTG_FS_FIFO(0);
+        }
+        return;
+    }
+
+    for (uint16_t i = 0; i < words; i++) {
+        uint32_t word = USB_OTG_FS_FIFO(0);
+        for (uint8_t byte = 0; byte < 4U; byte++) {
+            uint16_t index = (uint16_t) ((i * 4U) + byte);
+            if (buffer && index < length && index < space) {
+                buffer[index] = (uint8_t) (word >> (byte * 8U));
+            }
+        }
+    }
+}
+
+/**
+ * @brief  Pushes a packet into an endpoint's transmit FIFO
+ * @note   Every word is written through USB_OTG_FS_FIFO, one push per access, which is also
+ *         what lets the host tests stand a simulated FIFO in for the peripheral
+ */
+static void USB_Write_FIFO(uint8_t endpoint, const uint8_t *buffer, uint16_t length) {
+    uint16_t words = (length / 4U);
+
+    if (!((uintptr_t) buffer & 3U)) {
+        const uint32_t *source = (const uint32_t *) (uintptr_t) buffer;
+        for (uint16_t i = 0; i < words; i++) {
+            USB_OTG_FS_FIFO(endpoint) = source[i];
+        }
+    } else {
+        for (uint16_t i = 0; i < words; i++) {
+            const uint8_t *bytes = &buffer[i * 4U];
+            USB_OTG_FS_FIFO(endpoint) = ((uint32_t) bytes[0] | ((uint32_t) bytes[1] << 8U)
+                                         | ((uint32_t) bytes[2] << 16U) | ((uint32_t) bytes[3] << 24U));
+        }
+    }
+
+    //pad the final partial word
+    if (length & 3U) {
+        uint32_t word = 0;
+        for (uint16_t i = (uint16_t) (words * 4U); i < length; i++) {
+            word |= ((uint32_t) buffer[i] << ((i & 3U) * 8U));
+        }
+        USB_OTG_FS_FIFO(endpoint) = word;
+    }
+}
+
+/** @brief  Loads as many whole packets of the current IN transfer as the FIFO has room for */
+static void USB_Fill_TX_FIFO(uint8_t endpoint) {
+    USB_Endpoint_State_t  *state = &usb_in[endpoint];
+    USB_OTG_IN_Endpoint_t *in_ep = USB_OTG_FS_IN_EP(endpoint);
+
+    while (state->count < state->length) {
+        uint16_t chunk = (uint16_t) (state->length - state->count);
+        chunk = (chunk > state->max_packet) ? state->max_packet : chunk;
+        if ((in_ep->DTXFSTS & USB_OTG_DTXFSTS_INEPTFSAV) < ((chunk + 3U) / 4U)) {
+            break;
+        }
+        USB_Write_FIFO(endpoint, &state->tx_buffer[state->count], chunk);
+        state->count = (uint16_t) (state->count + chunk);
+    }
+
+    if (state->count >= state->length) {
+        USB_OTG_FS_DEVICE->DIEPEMPMSK &= ~(SET_ONE << endpoint);
+    }
+}
+
+static void USB_Start_IN(uint8_t endpoint, const uint8_t *buffer, uint16_t length) {
+    USB_Endpoint_State_t  *state = &usb_in[endpoint];
+    USB_OTG_IN_Endpoint_t *in_ep = USB_OTG_FS_IN_EP(endpoint);
+
+    state->tx_buffer = buffer;
+    state->length    = length;
+    state->count     = 0;
+
+    //a zero length transfer is still one packet
+    uint32_t packets = length ? ((length + state->max_packet - 1U) / state->max_packet) : 1U;
+    in_ep->DIEPTSIZ  = ((packets << USB_OTG_DIEPTSIZ_PKTCNT_Pos) | length);
+    in_ep->DIEPCTL  |= (USB_OTG_DIEPCTL_CNAK | USB_OTG_DIEPCTL_EPENA);
+    if (length) {
+        USB_OTG_FS_DEVICE->DIEPEMPMSK |= (SET_ONE << endpoint);
+    }
+}
+
+/** @brief  Arms endpoint 0 for one OUT packet, SETUP packets are accepted at any time */
+static void USB_EP0_Out_Start(uint8_t *buffer, uint16_t length) {
+    usb_out[0].rx_buffer = buffer;
+    usb_out[0].length    = length;
+    usb_out[0].count     = 0;
+
+    USB_OTG_OUT_Endpoint_t *out_ep = USB_OTG_FS_OUT_EP(0);
+    out_ep->DOEPTSIZ = ((3UL << USB_OTG_DOEPTSIZ_STUPCNT_Pos) | (SET_ONE << USB_OTG_DOEPTSIZ_PKTCNT_Pos)
+                        | USB_EP0_PACKET_SIZE);
+    out_ep->DOEPCTL |= (USB_OTG_DOEPCTL_CNAK | USB_OTG_DOEPCTL_EPENA);
+}
+
+static void USB_EP0_Stall(void) {
+    USB_OTG_FS_IN_EP(0)->DIEPCTL   |= USB_OTG_DIEPCTL_STALL;
+    USB_OTG_FS_OUT_EP(0)->DOEPCTL  |= USB_OTG_DOEPCTL_STALL;
+    usb_ep0_stage = USB_EP0_IDLE;
+    USB_EP0_Out_Start(0, 0);
+}
+
+static void USB_EP0_Status_IN(void) {
+    usb_ep0_stage = USB_EP0_STATUS_IN;
+    USB_Start_IN(0, 0, 0);
+    USB_EP0_Out_Start(0, 0);
+}
+
+static void USB_EP0_Send_Next(void) {
+    uint16_t chunk = (usb_ep0_remaining > USB_EP0_PACKET_SIZE) ? USB_EP0_PACKET_SIZE : usb_ep0_remaining;
+    USB_Start_IN(0, usb_ep0_tx_data, chunk);
+    usb_ep0_tx_data   += chunk;
+    usb_ep0_remaining  = (uint16_t) (usb_ep0_remaining - chunk);
+}
+
+/**
+ * @brief  Starts the IN data stage of a control transfer
+ * @note   Replies shorter than requested end on a short packet, so one that is a multiple of
+ *         the packet size is followed by a zero length packet
+ */
+static void USB_EP0_Reply(const uint8_t *data, uint16_t length) {
+    if (length > usb_setup.request.wLength) {
+        length = usb_setup.request.wLength;
+    }
+
+    usb_ep0_stage     = USB_EP0_DATA_IN;
+    usb_ep0_tx_data   = data;
+    usb_ep0_remaining = length;
+    usb_ep0_zlp       = (length && length < usb_setup.request.wLength && !(length % USB_EP0_PACKET_SIZE));
+    USB_EP0_Send_Next();
+
+    //ready for the host's status stage
+    USB_EP0_Out_Start(0, 0);
+}
+
+static void USB_EP0_Receive(uint8_t *data, uint16_t length) {
+    usb_ep0_stage     = USB_EP0_DATA_OUT;
+    usb_ep0_rx_data   = data;
+    usb_ep0_remaining = length;
+    USB_EP0_Out_Start(data, (length > USB_EP0_PACKET_SIZE) ? USB_EP0_PACKET_SIZE : length);
+}
+
+static void USB_Set_Stall(uint8_t address, uint8_t stall) {
+    uint8_t endpoint = (address & 0x0FU);
+
+    if (address & USB_ENDPOINT_IN) {
+        USB_OTG_IN_Endpoint_t *in_ep = USB_OTG_FS_IN_EP(endpoint);
+        in_ep->DIEPCTL = stall ? (in_ep->DIEPCTL | USB_OTG_DIEPCTL_STALL)
+                               : ((in_ep->DIEPCTL & ~USB_OTG_DIEPCTL_STALL) | USB_OTG_DIEPCTL_SD0PID);
+    } else {
+        USB_OTG_OUT_Endpoint_t *out_ep = USB_OTG_FS_OUT_EP(endpoint);
+        out_ep->DOEPCTL = stall ? (out_ep->DOEPCTL | USB_OTG_DOEPCTL_STALL)
+                                : ((out_ep->DOEPCTL & ~USB_OTG_DOEPCTL_STALL) | USB_OTG_DOEPCTL_SD0PID);
+    }
+}
+
+static const uint8_t *USB_Get_Descriptor(uint16_t value, uint16_t *length) {
+    uint8_t       index      = (uint8_t) (value & 0xFFU);
+    const uint8_t *descriptor = 0;
+
+    switch (value >> 8U) {
+        case USB_DESCRIPTOR_DEVICE:
+            descriptor = usb_config->device_descriptor;
+            *length    = descriptor[0];
+            break;
+        case USB_DESCRIPTOR_CONFIGURATION:
+            descriptor = usb_config->configuration_descriptor;
+            *length    = (uint16_t) (descriptor[2] | (descriptor[3] << 8U));
+            break;
+        case USB_DESCRIPTOR_STRING:
+            if (index < usb_config->string_count) {
+                descriptor = usb_config->string_descriptors[index];
+                *length    = descriptor[0];
+            }
+            break;
+        default:
+            break;
+    }
+
+    return descriptor;
+}
+
+static void USB_Standard_Request(const USB_Setup_t *setup) {
+    uint8_t recipient = (setup->bmRequestType & USB_REQUEST_RECIPIENT_MASK);
+
+    switch (setup->bRequest) {
+        case USB_REQUEST_GET_DESCRIPTOR: {
+            uint16_t      length     = 0;
+            const uint8_t *descriptor = USB_Get_Descriptor(setup->wValue, &length);
+            if (!descriptor) {
+                USB_EP0_Stall();
+                return;
+            }
+            USB_EP0_Reply(descriptor, length);
+            return;
+        }
+        case USB_REQUEST_SET_ADDRESS:
+            //the address applies immediately, the core still answers the status stage on 0
+            USB_OTG_FS_DEVICE->DCFG = ((USB_OTG_FS_DEVICE->DCFG & ~USB_OTG_DCFG_DAD)
+                                       | ((setup->wValue & 0x7FU) << USB_OTG_DCFG_DAD_Pos));
+            usb_state = (setup->wValue & 0x7FU) ? USB_STATE_ADDRESSED : USB_STATE_DEFAULT;
+            USB_EP0_Status_IN();
+            return;
+        case USB_REQUEST_SET_CONFIGURATION:
+            if (setup->wValue > 1U) {
+                USB_EP0_Stall();
+                return;
+            }
+            usb_configuration = (uint8_t) setup->wValue;
+            usb_state         = usb_configuration ? USB_STATE_CONFIGURED : USB_STATE_ADDRESSED;
+            usb_config->configured(usb_configuration);
+            USB_EP0_Status_IN();
+            return;
+        case USB_REQUEST_GET_CONFIGURATION:
+            usb_ep0_reply[0] = usb_configuration;
+            USB_EP0_Reply(usb_ep0_reply, 1U);
+            return;
+        case USB_REQUEST_GET_STATUS:
+            usb_ep0_reply[0] = 0;
+            usb_ep0_reply[1] = 0;
+            if (recipient == USB_REQUEST_RECIPIENT_ENDPOINT) {
+                //an endpoint the core does not have is a request error
+                uint8_t endpoint = (setup->wIndex & 0x0FU);
+                if (endpoint >= USB_ENDPOINT_COUNT) {
+                    USB_EP0_Stall();
+                    return;
+                }
+                uint32_t control = (setup->wIndex & USB_ENDPOINT_IN) ? USB_OTG_FS_IN_EP(endpoint)->DIEPCTL
+                                                                     : USB_OTG_FS_OUT_EP(endpoint)->DOEPCTL;
+                usb_ep0_reply[0] = (control & USB_OTG_DIEPCTL_STALL) ? 1U : 0;
+            }
+            USB_EP0_Reply(usb_ep0_reply, 2U);
+            return;
+        case USB_REQUEST_CLEAR_FEATURE:
+        case USB_REQUEST_SET_FEATURE:
+            if (recipient == USB_REQUEST_RECIPIENT_ENDPOINT && setup->wValue == USB_FEATURE_ENDPOINT_HALT
+                && (setup->wIndex & 0x0FU) && (setup->wIndex & 0x0FU) < USB_ENDPOINT_COUNT) {
+                USB_Set_Stall((uint8_t) setup->wIndex, (setup->bRequest == USB_REQUEST_SET_FEATURE));
+            }
+            USB_EP0_Status_IN();
+            return;
+        case USB_REQUEST_GET_INTERFACE:
+            usb_ep0_reply[0] = 0;
+            USB_EP0_Reply(usb_ep0_reply, 1U);
+            return;
+        case USB_REQUEST_SET_INTERFACE:
+            USB_EP0_Status_IN();
+            return;
+        default:
+            USB_EP0_Stall();
+            return;
+    }
+}
+
+static void USB_Setup_Request(void) {
+    const USB_Setup_t *setup = &usb_setup.request;
+
+    if ((setup->bmRequestType & USB_REQUEST_TYPE_MASK) == USB_REQUEST_TYPE_STANDARD) {
+        USB_Standard_Request(setup);
+        return;
+    }
+
+    //class and vendor requests go to the class driver
+    uint8_t  *data  = 0;
+    uint16_t length = 0;
+    if (!usb_config->setup || usb_config->setup(setup, &data, &length) != SUCCESS) {
+        USB_EP0_Stall();
+    } else if (setup->bmRequestType & USB_REQUEST_DIRECTION_IN) {
+        USB_EP0_Reply(data, length);
+    } else if (setup->wLength) {
+        if (!data || length < setup->wLength) {
+            USB_EP0_Stall();
+            return;
+        }
+        USB_EP0_Receive(data, setup->wLength);
+    } else {
+        USB_EP0_Status_IN();
+    }
+}
+
+static void USB_EP0_OUT_Complete(void) {
+    if (usb_ep0_stage != USB_EP0_DATA_OUT) {
+        usb_ep0_stage = USB_EP0_IDLE;
+        USB_EP0_Out_Start(0, 0);
+        return;
+    }
+
+    //continue the data stage until it is complete or ends on a short packet
+    uint16_t count = usb_out[0].count;
+    usb_ep0_rx_data   += count;
+    usb_ep0_remaining  = (count > usb_ep0_remaining) ? 0 : (uint16_t) (usb_ep0_remaining - count);
+    if (usb_ep0_remaining && count == USB_EP0_PACKET_SIZE) {
+        USB_EP0_Out_Start(usb_ep0_rx_data, (usb_ep0_remaining > USB_EP0_PACKET_SIZE) ? USB_EP0_PACKET_SIZE
+                                                                                   : usb_ep0_remaining);
+        return;
+    }
+    USB_EP0_Status_IN();
+}
+
+static void USB_EP0_IN_Complete(void) {
+    if (usb_ep0_stage != USB_EP0_DATA_IN) {
+        usb_ep0_stage = USB_EP0_IDLE;
+        return;
+    }
+
+    if (usb_ep0_remaining) {
+        USB_EP0_Send_Next();
+    } else if (usb_ep0_zlp) {
+        usb_ep0_zlp = 0;
+        USB_Start_IN(0, 0, 0);
+    } else {
+        usb_ep0_stage = USB_EP0_STATUS_OUT;
+    }
+}
+
+static void USB_Bus_Reset(void) {
+    USB_OTG_FS_DEVICE->DCTL &= ~(USB_OTG_DCTL_RWUSIG);
+    USB_OTG_FS->GRSTCTL = (USB_OTG_GRSTCTL_TXFFLSH | USB_OTG_GRSTCTL_TXFNUM_ALL);
+    USB_Wait_Flag(&USB_OTG_FS->GRSTCTL, USB_OTG_GRSTCTL_TXFFLSH, 0, 1000U);
+
+    //disable every endpoint but 0 and drop transfers in progress
+    for (uint8_t endpoint = 0; endpoint < USB_ENDPOINT_COUNT; endpoint++) {
+        USB_OTG_IN_Endpoint_t  *in_ep  = USB_OTG_FS_IN_EP(endpoint);
+        USB_OTG_OUT_Endpoint_t *out_ep = USB_OTG_FS_OUT_EP(endpoint);
+        in_ep->DIEPINT  = 0xFFU;
+        out_ep->DOEPINT = 0xFFU;
+        if (endpoint) {
+            in_ep->DIEPCTL  = (in_ep->DIEPCTL & USB_OTG_DIEPCTL_EPENA)
+                              ? (USB_OTG_DIEPCTL_EPDIS | USB_OTG_DIEPCTL_SNAK) : 0;
+            out_ep->DOEPCTL = (out_ep->DOEPCTL & USB_OTG_DOEPCTL_EPENA)
+                              ? (USB_OTG_DOEPCTL_EPDIS | USB_OTG_DOEPCTL_SNAK) : 0;
+        }
+        usb_in[endpoint].length  = 0;
+        usb_out[endpoint].length = 0;
+    }
+    usb_in[0].max_packet  = USB_EP0_PACKET_SIZE;
+    usb_out[0].max_packet = USB_EP0_PACKET_SIZE;
+
+    USB_OTG_FS_DEVICE->DAINTMSK   = ((SET_ONE << USB_OTG_DAINT_OEPINT_Pos) | (SET_ONE << USB_OTG_DAINT_IEPINT_Pos));
+    USB_OTG_FS_DEVICE->DIEPEMPMSK = 0;
+    USB_OTG_FS_DEVICE->DCFG      &= ~(USB_OTG_DCFG_DAD);
+
+    usb_configuration = 0;
+    usb_ep0_stage     = USB_EP0_IDLE;
+    usb_state         = USB_STATE_DEFAULT;
+    usb_config->configured(0);
+    USB_EP0_Out_Start(0, 0);
+}
+
+static void USB_Receive_Packet(void) {
+    uint32_t status   = USB_OTG_FS->GRXSTSP;
+    uint8_t  endpoint = (uint8_t) (status & USB_OTG_GRXSTSP_EPNUM);
+    uint16_t length   = (uint16_t) ((status & USB_OTG_GRXSTSP_BCNT) >> USB_OTG_GRXSTSP_BCNT_Pos);
+
+    switch (status & USB_OTG_GRXSTSP_PKTSTS) {
+        case USB_OTG_GRXSTSP_PKTSTS_SETUP_DATA:
+            usb_setup.words[0] = USB_OTG_FS_FIFO(0);
+            usb_setup.words[1] = USB_OTG_FS_FIFO(0);
+            break;
+        case USB_OTG_GRXSTSP_PKTSTS_OUT_DATA: {
+            if (!length || endpoint >= USB_ENDPOINT_COUNT) {
+                USB_Read_FIFO(0, length, 0);
+                break;
+            }
+            USB_Endpoint_State_t *state = &usb_out[endpoint];
+            uint16_t space = (state->length > state->count) ? (uint16_t) (state->length - state->count) : 0;
+            USB_Read_FIFO(state->rx_buffer ? &state->rx_buffer[state->count] : 0, length, space);
+            state->count = (uint16_t) (state->count + ((length < space) ? length : space));
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+static void USB_OUT_Interrupt(void) {
+    uint32_t endpoints = ((USB_OTG_FS_DEVICE->DAINT & USB_OTG_FS_DEVICE->DAINTMSK) >> USB_OTG_DAINT_OEPINT_Pos);
+
+    for (uint8_t endpoint = 0; endpoint < USB_ENDPOINT_COUNT; endpoint++) {
+        if (!(endpoints & (SET_ONE << endpoint))) {
+            continue;
+        }
+        USB_OTG_OUT_Endpoint_t *out_ep = USB_OTG_FS_OUT_EP(endpoint);
+        uint32_t flags = out_ep->DOEPINT;
+        out_ep->DOEPINT = flags;
+        flags &= USB_OTG_FS_DEVICE->DOEPMSK;
+
+        if (flags & USB_OTG_DOEPINT_XFRC) {
+            if (!endpoint) {
+                USB_EP0_OUT_Complete();
+            } else {
+                usb_out[endpoint].length = 0;
+                usb_config->out_complete(endpoint, usb_out[endpoint].count);
+            }
+        }
+        if (flags & USB_OTG_DOEPINT_STUP) {
+            USB_Setup_Request();
+        }
+    }
+}
+
+static void USB_IN_Interrupt(void) {
+    uint32_t endpoints = (USB_OTG_FS_DEVICE->DAINT & USB_OTG_FS_DEVICE->DAINTMSK & USB_OTG_DAINT_IEPINT);
+
+    for (uint8_t endpoint = 0; endpoint < USB_ENDPOINT_COUNT; endpoint++) {
+        if (!(endpoints & (SET_ONE << endpoint))) {
+            continue;
+        }
+        USB_OTG_IN_Endpoint_t *in_ep = USB_OTG_FS_IN_EP(endpoint);
+        uint32_t mask  = (USB_OTG_FS_DEVICE->DIEPMSK
+                          | ((USB_OTG_FS_DEVICE->DIEPEMPMSK & (SET_ONE << endpoint)) ? USB_OTG_DIEPINT_TXFE : 0));
+        uint32_t flags = (in_ep->DIEPINT & mask);
+
+        if (flags & USB_OTG_DIEPINT_XFRC) {
+            in_ep->DIEPINT = USB_OTG_DIEPINT_XFRC;
+            USB_OTG_FS_DEVICE->DIEPEMPMSK &= ~(SET_ONE << endpoint);
+            if (!endpoint) {
+                USB_EP0_IN_Complete();
+            } else {
+                usb_in[endpoint].length = 0;
+                usb_config->in_complete(endpoint);
+            }
+        }
+        if (flags & USB_OTG_DIEPINT_TXFE) {
+            USB_Fill_TX_FIFO(endpoint);
+        }
+    }
+}
+
+
+/**********************************************************************************/
+/*                               USB Core Functions                               */
+/**********************************************************************************/
+
+/**
+ * @brief  Initialises the USB OTG FS peripheral as a full-speed device and connects to the bus
+ * @note   Requires the PLL to be running, as its Q output supplies the 48MHz USB clock (see
+ *         @ref System_Clock_Init). D- and D+ are PA11 and PA12. VBUS sensing is disabled as
+ *         the Black Pill does not route VBUS to PA9, so the device is treated as always powered
+ * @note   The core answers the standard requests itself from the descriptors in the config,
+ *         which must stay valid while in use. Class and vendor requests, endpoint completions
+ *         and configuration changes are passed to the callbacks from interrupt context
+ * @note   The turnaround time is set for an AHB clock of at least 32MHz, so the system
+ *         clock must be running from the PLL, with the AHB undivided, at USB_MIN_AHB_FREQ or
+ *         more
+ * @param  init_config: Pointer to USB_Init_Config structure
+ * @retval Status indicating success, invalid parameters, or error if the PLL is not running
+ *         or not the system clock, the AHB clock is too slow, the interrupt is taken or the
+ *         core did not come out of reset
+ */
+Status USB_Init(USB_Init_Config_t *init_config) {
+    //validate config struct pointer, descriptors and callbacks
+    if (!init_config || !init_config->device_descriptor || !init_config->configuration_descriptor
+        || (init_config->string_count && !init_config->string_descriptors) || !init_config->configured
+        || !init_config->out_complete || !init_config->in_complete) {
+        return INVALID_PARAM;
+    }
+
+    //validate FIFO layout
+    uint32_t fifo_words = USB_RX_FIFO_WORDS;
+    for (uint8_t endpoint = 0; endpoint < USB_ENDPOINT_COUNT; endpoint++) {
+        if (usb_tx_fifo_words[endpoint] < (USB_EP0_PACKET_SIZE / 4U)) {
+            return INVALID_PARAM;
+        }
+        fifo_words += usb_tx_fifo_words[endpoint];
+    }
+    if (fifo_words > USB_FIFO_WORDS) {
+        return INVALID_PARAM;
+    }
+
+    //the USB clock is PLL Q, and the turnaround time assumes the AHB clock is the PLL output
+    if (!(RCC->CR & RCC_CR_PLLRDY) || (RCC->CFGR & RCC_CFGR_SWS) != RCC_CFGR_SWS_PLL
+        || (RCC->CFGR & RCC_CFGR_HPRE) != RCC_CFGR_HPRE_DIV1 || g_sys_clk_freq < USB_MIN_AHB_FREQ) {
+        return ERROR;
+    }
+
+    //claim interrupt
+    NVIC_Latency_Class latency_class = init_config->interrupt_class ? init_config->interrupt_class
+                                                                    : NVIC_CLASS_COMMS;
+    if (NVIC_Request_IRQ(OTG_FS_IRQn, latency_class, USB_OTG_FS) != SUCCESS) {
+        return ERROR;
+    }
+
+    //configure D- and D+
+    GPIO_Config_t pin_gpio = {
+        .port         = GPIOA,
+        .pin          = GPIO_PIN_11,
+        .mode         = GPIO_MODE_AF,
+        .output_type  = GPIO_OUTPUT_PUSH_PULL,
+        .output_speed = GPIO_OUTPUT_SPEED_HIGH,
+        .alt_function = GPIO_AF_10
+    };
+    if (GPIO_Init(&pin_gpio) != SUCCESS) {
+        return INVALID_PARAM;
+    }
+    pin_gpio.pin = GPIO_PIN_12;
+    if (GPIO_Init(&pin_gpio) != SUCCESS) {
+        return INVALID_PARAM;
+    }
+
+    //enable OTG FS clock, and the cycle counter used to time the core reset
+    RCC->AHB2ENR |= RCC_AHB2ENR_OTGFSEN;
+    DSB();
+    if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA)) {
+        Cycle_Counter_Init();
+    }
+
+    //reset the core once the AHB master is idle
+    if (USB_Wait_Flag(&USB_OTG_FS->GRSTCTL, USB_OTG_GRSTCTL_AHBIDL, 1U, 1000U) != SUCCESS) {
+        return ERROR;
+    }
+    USB_OTG_FS->GRSTCTL |= USB_OTG_GRSTCTL_CSRST;
+    if (USB_Wait_Flag(&USB_OTG_FS->GRSTCTL, USB_OTG_GRSTCTL_CSRST, 0, 1000U) != SUCCESS) {
+        return ERROR;
+    }
+
+    //force device mode with the internal PHY, the turnaround time suits an AHB clock above 32MHz
+    USB_OTG_FS->GUSBCFG = (USB_OTG_GUSBCFG_PHYSEL | USB_OTG_GUSBCFG_FDMOD | (6UL << USB_OTG_GUSBCFG_TRDT_Pos));
+    USB_Delay_Us(25000U);
+    USB_OTG_FS->GCCFG  = (USB_OTG_GCCFG_PWRDWN | USB_OTG_GCCFG_NOVBUSSENS);
+    USB_OTG_FS_PCGCCTL = 0;
+
+    //stay disconnected until configured
+    USB_OTG_FS_DEVICE->DCFG = USB_OTG_DCFG_DSPD_FULL;
+    USB_OTG_FS_DEVICE->DCTL = USB_OTG_DCTL_SDIS;
+
+    //lay out the receive FIFO, then a transmit FIFO per IN endpoint
+    uint32_t address = USB_RX_FIFO_WORDS;
+    USB_OTG_FS->GRXFSIZ  = USB_RX_FIFO_WORDS;
+    USB_OTG_FS->DIEPTXF0 = (((uint32_t) usb_tx_fifo_words[0] << USB_OTG_DIEPTXF_INEPTXFD_Pos) | address);
+    address += usb_tx_fifo_words[0];
+    for (uint8_t endpoint = 1U; endpoint < USB_ENDPOINT_COUNT; endpoint++) {
+        USB_OTG_FS->DIEPTXF[endpoint - 1U] = (((uint32_t) usb_tx_fifo_words[endpoint]
+                                               << USB_OTG_DIEPTXF_INEPTXFD_Pos) | address);
+        address += usb_tx_fifo_words[endpoint];
+    }
+    if (USB_Flush_FIFOs() != SUCCESS) {
+        return ERROR;
+    }
+
+    //completions on every endpoint, SETUP on OUT endpoints
+    USB_OTG_FS_DEVICE->DIEPMSK    = USB_OTG_DIEPMSK_XFRCM;
+    USB_OTG_FS_DEVICE->DOEPMSK    = (USB_OTG_DOEPMSK_XFRCM | USB_OTG_DOEPMSK_STUPM);
+    USB_OTG_FS_DEVICE->DAINTMSK   = 0;
+    USB_OTG_FS_DEVICE->DIEPEMPMSK = 0;
+    for (uint8_t endpoint = 0; endpoint < USB_ENDPOINT_COUNT; endpoint++) {
+        USB_OTG_FS_IN_EP(endpoint)->DIEPINT  = 0xFFU;
+        USB_OTG_FS_OUT_EP(endpoint)->DOEPINT = 0xFFU;
+        usb_in[endpoint].length  = 0;
+        usb_out[endpoint].length = 0;
+    }
+
+    usb_config        = init_config;
+    usb_state         = USB_STATE_DETACHED;
+    usb_configuration = 0;
+    usb_ep0_stage     = USB_EP0_IDLE;
+
+    //transmit FIFO interrupts fire when completely empty, so a partial packet never stalls them
+    USB_OTG_FS->GINTSTS = 0xFFFFFFFFUL;
+    USB_OTG_FS->GINTMSK = (USB_OTG_GINTSTS_USBRST | USB_OTG_GINTSTS_ENUMDNE | USB_OTG_GINTSTS_RXFLVL
+                           | USB_OTG_GINTSTS_IEPINT | USB_OTG_GINTSTS_OEPINT | USB_OTG_GINTSTS_USBSUSP
+                           | USB_OTG_GINTSTS_WKUPINT | USB_OTG_GINTSTS_MMIS);
+    USB_OTG_FS->GAHBCFG = (USB_OTG_GAHBCFG_GINT | USB_OTG_GAHBCFG_TXFELVL);
+    NVIC_Enable_IRQ(OTG_FS_IRQn);
+
+    //connect the D+ pull-up
+    USB_OTG_FS_DEVICE->DCTL &= ~(USB_OTG_DCTL_SDIS);
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Activates a non-control endpoint, normally from the configured callback
+ * @param  address:    Endpoint number, with USB_ENDPOINT_IN set for IN endpoints
+ * @param  type:       Bulk, interrupt or isochronous
+ * @param  max_packet: Maximum packet size in bytes (1 - 64)
+ * @retval Status indicating success or invalid parameters
+ */
+Status USB_Endpoint_Open(uint8_t address, USB_Endpoint_Type type, uint16_t max_packet) {
+    //validate endpoint, type and packet size
+    uint8_t endpoint = (address & 0x0FU);
+    if (!endpoint || endpoint >= USB_ENDPOINT_COUNT || type < USB_ENDPOINT_ISOCHRONOUS
+        || type > USB_ENDPOINT_INTERRUPT || !max_packet || max_packet > 64U) {
+        return INVALID_PARAM;
+    }
+
+    //start from DATA0 with the endpoint NAKing until a transfer is armed
+    uint32_t control = ((uint32_t) max_packet | ((uint32_t) type << USB_OTG_DIEPCTL_EPTYP_Pos)
+                        | USB_OTG_DIEPCTL_USBAEP | USB_OTG_DIEPCTL_SD0PID | USB_OTG_DIEPCTL_SNAK);
+    if (address & USB_ENDPOINT_IN) {
+        usb_in[endpoint].max_packet = max_packet;
+        usb_in[endpoint].length     = 0;
+        USB_OTG_FS_IN_EP(endpoint)->DIEPCTL = (control | ((uint32_t) endpoint << USB_OTG_DIEPCTL_TXFNUM_Pos));
+        USB_OTG_FS_DEVICE->DAINTMSK |= (SET_ONE << (USB_OTG_DAINT_IEPINT_Pos + endpoint));
+    } else {
+        usb_out[endpoint].max_packet = max_packet;
+        usb_out[endpoint].length     = 0;
+        USB_OTG_FS_OUT_EP(endpoint)->DOEPCTL = control;
+        USB_OTG_FS_DEVICE->DAINTMSK |= (SET_ONE << (USB_OTG_DAINT_OEPINT_Pos + endpoint));
+    }
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Arms an OUT endpoint to receive directly into a buffer
+ * @note   Packets are popped from the receive FIFO straight into the buffer, so the data is
+ *         never copied again before the out_complete callback hands it over. The transfer ends
+ *         when the buffer is full or the host sends a short packet, and until the endpoint is
+ *         armed again the host is NAKed, which throttles it to the consumer's pace
+ * @param  endpoint: OUT endpoint number
+ * @param  buffer:   Destination, 4 byte aligned for whole word FIFO reads
+ * @param  length:   Buffer size, a multiple of the endpoint's packet size
+ * @retval Status indicating success, invalid parameters, or error if the endpoint is not open
+ *         or already armed
+ */
+Status USB_Endpoint_Receive(uint8_t endpoint, uint8_t *buffer, uint16_t length) {
+    //validate endpoint and buffer
+    if (!endpoint || endpoint >= USB_ENDPOINT_COUNT || !buffer || !length) {
+        return INVALID_PARAM;
+    }
+    USB_Endpoint_State_t   *state  = &usb_out[endpoint];
+    USB_OTG_OUT_Endpoint_t *out_ep = USB_OTG_FS_OUT_EP(endpoint);
+    if (!(out_ep->DOEPCTL & USB_OTG_DOEPCTL_USBAEP) || (out_ep->DOEPCTL & USB_OTG_DOEPCTL_EPENA)) {
+        return ERROR;
+    }
+    if (length % state->max_packet) {
+        return INVALID_PARAM;
+    }
+
+    state->rx_buffer = buffer;
+    state->length    = length;
+    state->count     = 0;
+
+    uint32_t packets = (length / state->max_packet);
+    out_ep->DOEPTSIZ = ((packets << USB_OTG_DOEPTSIZ_PKTCNT_Pos) | length);
+    out_ep->DOEPCTL |= (USB_OTG_DOEPCTL_CNAK | USB_OTG_DOEPCTL_EPENA);
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Starts sending a buffer on an IN endpoint
+ * @note   The buffer is loaded into the endpoint's FIFO as space frees up, so it must stay
+ *         valid until the in_complete callback. A transfer that is a multiple of the packet
+ *         size is not followed by a zero length packet; send one with length 0 if needed
+ * @param  endpoint: IN endpoint number
+ * @param  buffer:   Data to send, may be NULL if length is 0
+ * @param  length:   Number of bytes
+ * @retval Status indicating success, invalid parameters, or error if the endpoint is not open
+ *         or still busy
+ */
+Status USB_Endpoint_Transmit(uint8_t endpoint, const uint8_t *buffer, uint16_t length) {
+    //validate endpoint and buffer
+    if (!endpoint || endpoint >= USB_ENDPOINT_COUNT || (length && !buffer)) {
+        return INVALID_PARAM;
+    }
+    USB_OTG_IN_Endpoint_t *in_ep = USB_OTG_FS_IN_EP(endpoint);
+    if (!(in_ep->DIEPCTL & USB_OTG_DIEPCTL_USBAEP) || (in_ep->DIEPCTL & USB_OTG_DIEPCTL_EPENA)) {
+        return ERROR;
+    }
+
+    USB_Start_IN(endpoint, buffer, length);
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Halts an endpoint until the host clears the halt feature
+ * @param  address: Endpoint number, with USB_ENDPOINT_IN set for IN endpoints. Endpoint 0
+ *                  stalls the current control transfer only
+ * @retval Status indicating success or invalid parameters
+ */
+Status USB_Endpoint_Stall(uint8_t address) {
+    //validate endpoint
+    uint8_t endpoint = (address & 0x0FU);
+    if (endpoint >= USB_ENDPOINT_COUNT) {
+        return INVALID_PARAM;
+    }
+
+    if (!endpoint) {
+        USB_EP0_Stall();
+    } else {
+        USB_Set_Stall(address, 1U);
+    }
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Reads the device state
+ * @retval USB_State of the device
+ */
+USB_State USB_Get_State(void) {
+    return (USB_State) usb_state;
+}
+
+
+/**********************************************************************************/
+/*                             USB Interrupt Handlers                             */
+/**********************************************************************************/
+
+/** @brief  Handles bus events, received packets and endpoint completions */
+void OTG_FS_IRQHandler(void) {
+    uint32_t status = (USB_OTG_FS->GINTSTS & USB_OTG_FS->GINTMSK);
+
+    if (status & USB_OTG_GINTSTS_USBRST) {
+        USB_OTG_FS->GINTSTS = USB_OTG_GINTSTS_USBRST;
+        USB_Bus_Reset();
+    }
+
+    //endpoint 0 packets are 64 bytes at full speed
+    if (status & USB_OTG_GINTSTS_ENUMDNE) {
+        USB_OTG_FS->GINTSTS = USB_OTG_GINTSTS_ENUMDNE;
+        USB_OTG_FS_IN_EP(0)->DIEPCTL &= ~(USB_OTG_DIEPCTL_MPSIZ);
+        USB_OTG_FS_DEVICE->DCTL      |= USB_OTG_DCTL_CGINAK;
+        usb_state = USB_STATE_DEFAULT;
+    }
+
+    //every queued packet is popped in one pass
+    if (status & USB_OTG_GINTSTS_RXFLVL) {
+        while (USB_OTG_FS->GINTSTS & USB_OTG_GINTSTS_RXFLVL) {
+            USB_Receive_Packet();
+        }
+    }
+
+    if (status & USB_OTG_GINTSTS_OEPINT) {
+        USB_OUT_Interrupt();
+    }
+
+    if (status & USB_OTG_GINTSTS_IEPINT) {
+        USB_IN_Interrupt();
+    }
+
+    if (status & USB_OTG_GINTSTS_USBSUSP) {
+        USB_OTG_FS->GINTSTS = USB_OTG_GINTSTS_USBSUSP;
+        if (usb_state != USB_STATE_DETACHED && usb_state != USB_STATE_SUSPENDED) {
+            usb_resume_state = usb_state;
+            usb_state        = USB_STATE_SUSPENDED;
+        }
+    }
+
+    if (status & USB_OTG_GINTSTS_WKUPINT) {
+        USB_OTG_FS->GINTSTS = USB_OTG_GINTSTS_WKUPINT;
+        if (usb_state == USB_STATE_SUSPENDED) {
+            usb_state = usb_resume_state;
+        }
+    }
+
+    if (status & USB_OTG_GINTSTS_MMIS) {
+        USB_OTG_FS->GINTSTS = USB_OTG_GINTSTS_MMIS;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,146 @@
+#ifndef __USB_H
+#define __USB_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../../utils/utils.h"
+#include "../gpio/gpio.h"
+
+
+/**********************************************************************************/
+/*                                     Defines                                    */
+/**********************************************************************************/
+
+#define USB_ENDPOINT_COUNT          4U
+#define USB_EP0_PACKET_SIZE         64U
+#define USB_ENDPOINT_IN             0x80U
+
+/* slowest AHB clock the USB turnaround time of 6 is valid for */
+#define USB_MIN_AHB_FREQ            32000000UL
+
+/* FIFO RAM in words: shared receive FIFO, then one transmit FIFO per IN endpoint */
+#define USB_FIFO_WORDS              320U
+#ifndef USB_RX_FIFO_WORDS
+#define USB_RX_FIFO_WORDS           128U
+#endif
+#ifndef USB_TX_FIFO_WORDS
+#define USB_TX_FIFO_WORDS           {16U, 128U, 16U, 16U}
+#endif
+
+/* standard requests */
+#define USB_REQUEST_GET_STATUS          0x00U
+#define USB_REQUEST_CLEAR_FEATURE       0x01U
+#define USB_REQUEST_SET_FEATURE         0x03U
+#define USB_REQUEST_SET_ADDRESS         0x05U
+#define USB_REQUEST_GET_DESCRIPTOR      0x06U
+#define USB_REQUEST_GET_CONFIGURATION   0x08U
+#define USB_REQUEST_SET_CONFIGURATION   0x09U
+#define USB_REQUEST_GET_INTERFACE       0x0AU
+#define USB_REQUEST_SET_INTERFACE       0x0BU
+
+/* bmRequestType fields */
+#define USB_REQUEST_DIRECTION_IN        0x80U
+#define USB_REQUEST_TYPE_MASK           0x60U
+#define USB_REQUEST_TYPE_STANDARD       0x00U
+#define USB_REQUEST_TYPE_CLASS          0x20U
+#define USB_REQUEST_RECIPIENT_MASK      0x1FU
+#define USB_REQUEST_RECIPIENT_ENDPOINT  0x02U
+
+/* descriptor types */
+#define USB_DESCRIPTOR_DEVICE           0x01U
+#define USB_DESCRIPTOR_CONFIGURATION    0x02U
+#define USB_DESCRIPTOR_STRING           0x03U
+#define USB_DESCRIPTOR_INTERFACE        0x04U
+#define USB_DESCRIPTOR_ENDPOINT         0x05U
+
+#define USB_FEATURE_ENDPOINT_HALT       0x00U
+
+
+/**********************************************************************************/
+/*                                      Enums                                     */
+/**********************************************************************************/
+
+typedef enum {
+    USB_ENDPOINT_CONTROL = 0,
+    USB_ENDPOINT_ISOCHRONOUS,
+    USB_ENDPOINT_BULK,
+    USB_ENDPOINT_INTERRUPT
+} USB_Endpoint_Type;
+
+typedef enum {
+    USB_STATE_DETACHED = 0,
+    USB_STATE_DEFAULT,
+    USB_STATE_ADDRESSED,
+    USB_STATE_CONFIGURED,
+    USB_STATE_SUSPENDED
+} USB_State;
+
+typedef enum {
+    USB_EP0_IDLE = 0,
+    USB_EP0_DATA_IN,
+    USB_EP0_DATA_OUT,
+    USB_EP0_STATUS_IN,
+    USB_EP0_STATUS_OUT
+} USB_EP0_Stage;
+
+
+/**********************************************************************************/
+/*                                 Callback Types                                 */
+/**********************************************************************************/
+
+struct USB_Setup;
+
+/* returns the data stage buffer: sent for IN requests, received into for OUT requests */
+typedef Status (*USB_Setup_Callback_t)(const struct USB_Setup *setup, uint8_t **data, uint16_t *length);
+typedef void   (*USB_Configured_Callback_t)(uint8_t configuration);
+typedef void   (*USB_OUT_Callback_t)(uint8_t endpoint, uint16_t length);
+typedef void   (*USB_IN_Callback_t)(uint8_t endpoint);
+
+
+/**********************************************************************************/
+/*                              Configuration Structs                             */
+/**********************************************************************************/
+
+typedef struct __attribute__((packed)) USB_Setup {
+    uint8_t  bmRequestType;
+    uint8_t  bRequest;
+    uint16_t wValue;
+    uint16_t wIndex;
+    uint16_t wLength;
+} USB_Setup_t;
+
+typedef struct {
+/************************************ Required ************************************/
+    const uint8_t             *device_descriptor;
+    const uint8_t             *configuration_descriptor;
+    const uint8_t *const      *string_descriptors;
+    uint8_t                   string_count;
+    USB_Configured_Callback_t configured;
+    USB_OUT_Callback_t        out_complete;
+    USB_IN_Callback_t         in_complete;
+/************************************ Optional ************************************/
+    USB_Setup_Callback_t      setup;
+    NVIC_Latency_Class        interrupt_class;
+} USB_Init_Config_t;
+
+
+/**********************************************************************************/
+/*                               Function Prototypes                              */
+/**********************************************************************************/
+
+Status    USB_Init                (USB_Init_Config_t *init_config);
+Status    USB_Endpoint_Open       (uint8_t address, USB_Endpoint_Type type, uint16_t max_packet);
+Status    USB_Endpoint_Receive    (uint8_t endpoint, uint8_t *buffer, uint16_t length);
+Status    USB_Endpoint_Transmit   (uint8_t endpoint, const uint8_t *buffer, uint16_t length);
+Status    USB_Endpoint_Stall      (uint8_t address);
+USB_State USB_Get_State           (void);
+void      OTG_FS_IRQHandler       (void);
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
\ No newline at end of file
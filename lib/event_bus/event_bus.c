@@ -0,0 +1,221 @@
+#include "event_bus.h"
+
+/**********************************************************************************/
+/*                                Static Functions                                */
+/**********************************************************************************/
+
+static void Event_Bus_Copy(void *destination, const void *source, uint32_t size) {
+    uint8_t       *to   = destination;
+    const uint8_t *from = source;
+    while (size--) {
+        *to++ = *from++;
+    }
+}
+
+/**
+ * @brief  Delivers every new event of a topic to its callback subscribers
+ * @note   Runs as deferred work in PendSV, so callbacks never run in the publishing interrupt
+ * @param  argument: Pointer to the topic
+ */
+static void Event_Bus_Dispatch(uint32_t argument) {
+    Event_Bus_Topic_t *topic = (Event_Bus_Topic_t *) (uintptr_t) argument;
+    uint32_t event[(EVENT_BUS_MAX_EVENT_SIZE + 3U) / 4U];
+    uint32_t sequence;
+
+    //publishes from here on post a new dispatch
+    topic->dispatch_pending = 0;
+
+    for (Event_Bus_Reader_t *reader = topic->subscribers; reader; reader = reader->next) {
+        while (Event_Bus_Read(reader, event, &sequence) == SUCCESS) {
+            reader->callback(event, sequence, reader->context);
+        }
+    }
+}
+
+
+/**********************************************************************************/
+/*                             Event Bus Core Functions                           */
+/**********************************************************************************/
+
+/**
+ * @brief  Initialises a topic over caller-provided storage
+ * @note   The topic keeps the last capacity events. Every reader has its own position, so a
+ *         slow reader loses the oldest events, counted in its drop counter, and never holds
+ *         up producers or other readers
+ * @param  topic:      Pointer to the topic
+ * @param  storage:    Pointer to EVENT_BUS_STORAGE_WORDS(event_size, capacity) words
+ * @param  event_size: Size of each event in bytes, at most EVENT_BUS_MAX_EVENT_SIZE
+ * @param  capacity:   Number of events kept, a power of two
+ * @retval Status indicating success or invalid parameters
+ */
+Status Event_Bus_Topic_Init(Event_Bus_Topic_t *topic, uint32_t *storage, uint32_t event_size,
+                            uint32_t capacity) {
+    //validate topic, storage and sizes
+    if (!topic || !storage || !event_size || event_size > EVENT_BUS_MAX_EVENT_SIZE
+        || capacity < 2U || (capacity & (capacity - 1U))) {
+        return INVALID_PARAM;
+    }
+
+    topic->storage          = storage;
+    topic->event_size       = event_size;
+    topic->slot_words       = EVENT_BUS_SLOT_WORDS(event_size);
+    topic->mask             = (capacity - 1U);
+    topic->head             = 0;
+    topic->dispatch_pending = 0;
+    topic->subscribers      = 0;
+
+    //a stamp of 0 marks a slot that holds no complete event
+    for (uint32_t i = 0; i < capacity; i++) {
+        storage[i * topic->slot_words] = 0;
+    }
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Publishes an event to every reader of a topic
+ * @note   Lock-free and callable from any interrupt. The slot is claimed by advancing the
+ *         head with LDREX/STREX, and stamped with its sequence number once the event has been
+ *         copied in, so readers never see a torn event. Callback subscribers are run from
+ *         PendSV via @ref Deferred_Post
+ * @param  topic: Pointer to the topic
+ * @param  event: Pointer to event_size bytes to copy in
+ * @retval Status indicating success, invalid parameters, or error if the dispatch of callback
+ *         subscribers could not be queued
+ */
+Status Event_Bus_Publish(Event_Bus_Topic_t *topic, const void *event) {
+    //validate topic and event
+    if (!topic || !event) {
+        return INVALID_PARAM;
+    }
+
+    //claim the next sequence number and its slot
+    uint32_t sequence = (ATOMIC_ADD(&topic->head, 1U) - 1U);
+    volatile uint32_t *slot = &topic->storage[(sequence & topic->mask) * topic->slot_words];
+
+    //invalidate, fill, then stamp the slot
+    slot[0] = 0;
+    DMB();
+    Event_Bus_Copy((void *) &slot[1], event, topic->event_size);
+    DMB();
+    slot[0] = (sequence + 1U);
+
+    if (topic->subscribers && !ATOMIC_EXCHANGE(&topic->dispatch_pending, 1U)) {
+        if (Deferred_Post(Event_Bus_Dispatch, (uint32_t) (uintptr_t) topic) != SUCCESS) {
+            topic->dispatch_pending = 0;
+            return ERROR;
+        }
+    }
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Attaches a reader to a topic, starting after the newest event
+ * @note   With a callback the reader is a subscriber, and events are delivered from PendSV.
+ *         Without one the reader is polled with @ref Event_Bus_Read. Subscribing with a
+ *         callback claims PendSV via @ref Deferred_Init
+ * @param  topic:    Pointer to the topic
+ * @param  reader:   Pointer to the reader, which must stay valid while subscribed
+ * @param  callback: Function called with each event, or NULL for a polled reader
+ * @param  context:  Pointer passed to the callback
+ * @retval Status indicating success, invalid parameters, or error if PendSV is unavailable
+ */
+Status Event_Bus_Subscribe(Event_Bus_Topic_t *topic, Event_Bus_Reader_t *reader,
+                           Event_Bus_Callback_t callback, void *context) {
+    //validate topic and reader
+    if (!topic || !reader) {
+        return INVALID_PARAM;
+    }
+
+    //subscribers are dispatched from PendSV
+    if (callback && Deferred_Init() != SUCCESS) {
+        return ERROR;
+    }
+
+    reader->topic         = topic;
+    reader->next_sequence = topic->head;
+    reader->dropped       = 0;
+    reader->callback      = callback;
+    reader->context       = context;
+    reader->next          = 0;
+
+    if (callback) {
+        uint32_t primask = ENTER_CRITICAL();
+        reader->next       = topic->subscribers;
+        topic->subscribers = reader;
+        EXIT_CRITICAL(primask);
+    }
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Reads the oldest event a reader has not yet seen
+ * @note   Each reader must only be read from one context. Sequence numbers count every event
+ *         published to the topic, so a gap shows exactly how many were missed. An event
+ *         overwritten before or while it is copied out counts as dropped and is skipped
+ * @param  reader:   Pointer to the reader
+ * @param  event:    Pointer to event_size bytes to copy the event to
+ * @param  sequence: Pointer to store the event's sequence number, may be NULL
+ * @retval Status indicating success, invalid parameters, or error if there is no new event
+ */
+Status Event_Bus_Read(Event_Bus_Reader_t *reader, void *event, uint32_t *sequence) {
+    //validate reader and event
+    if (!reader || !reader->topic || !event) {
+        return INVALID_PARAM;
+    }
+
+    Event_Bus_Topic_t *topic = reader->topic;
+    while (1) {
+        uint32_t head = topic->head;
+        if (reader->next_sequence == head) {
+            return ERROR;
+        }
+
+        //skip the events that have already been overwritten
+        uint32_t capacity = (topic->mask + 1U);
+        if ((head - reader->next_sequence) > capacity) {
+            reader->dropped      += ((head - reader->next_sequence) - capacity);
+            reader->next_sequence = (head - capacity);
+        }
+
+        //an unexpected stamp is a producer still writing the next event, unless the reader
+        //has been lapped since the head was read
+        volatile uint32_t *slot = &topic->storage[(reader->next_sequence & topic->mask) * topic->slot_words];
+        uint32_t stamp = slot[0];
+        if (stamp != (reader->next_sequence + 1U)) {
+            if ((topic->head - reader->next_sequence) <= capacity) {
+                return ERROR;
+            }
+            reader->dropped++;
+            reader->next_sequence++;
+            continue;
+        }
+
+        //keep the copy only if the slot was not reused while copying
+        DMB();
+        Event_Bus_Copy(event, (const void *) &slot[1], topic->event_size);
+        DMB();
+        if (slot[0] == stamp) {
+            if (sequence) {
+                *sequence = reader->next_sequence;
+            }
+            reader->next_sequence++;
+            return SUCCESS;
+        }
+
+        //lapped while copying, so the event is lost
+        reader->dropped++;
+        reader->next_sequence++;
+    }
+}
+
+/**
+ * @brief  Reads the number of events a reader has missed by falling behind
+ * @param  reader: Pointer to the reader
+ * @retval Number of dropped events since @ref Event_Bus_Subscribe
+ */
+uint32_t Event_Bus_Get_Dropped(const Event_Bus_Reader_t *reader) {
+    return reader ? reader->dropped : 0;
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+#ifndef __EVENT_BUS_H
+#define __EVENT_BUS_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../utils/utils.h"
+
+
+/**********************************************************************************/
+/*                                     Defines                                    */
+/**********************************************************************************/
+
+#ifndef EVENT_BUS_MAX_EVENT_SIZE
+#define EVENT_BUS_MAX_EVENT_SIZE    32U
+#endif
+
+/* words of topic storage for a ring of capacity events, each slot holds a stamp and the event */
+#define EVENT_BUS_SLOT_WORDS(event_size)            (1U + (((event_size) + 3U) / 4U))
+#define EVENT_BUS_STORAGE_WORDS(event_size, capacity) ((capacity) * EVENT_BUS_SLOT_WORDS(event_size))
+
+
+/**********************************************************************************/
+/*                                 Callback Types                                 */
+/**********************************************************************************/
+
+typedef void (*Event_Bus_Callback_t)(const void *event, uint32_t sequence, void *context);
+
+
+/**********************************************************************************/
+/*                                  Bus Objects                                   */
+/**********************************************************************************/
+
+struct Event_Bus_Reader;
+
+typedef struct {
+    uint32_t                *storage;
+    uint32_t                event_size;
+    uint32_t                slot_words;
+    uint32_t                mask;
+    volatile uint32_t       head;
+    volatile uint32_t       dispatch_pending;
+    struct Event_Bus_Reader *subscribers;
+} Event_Bus_Topic_t;
+
+typedef struct Event_Bus_Reader {
+    Event_Bus_Topic_t       *topic;
+    uint32_t                next_sequence;
+    uint32_t                dropped;
+    Event_Bus_Callback_t    callback;
+    void                    *context;
+    struct Event_Bus_Reader *next;
+} Event_Bus_Reader_t;
+
+
+/**********************************************************************************/
+/*                               Function Prototypes                              */
+/**********************************************************************************/
+
+Status   Event_Bus_Topic_Init       (Event_Bus_Topic_t *topic, uint32_t *storage, uint32_t event_size,
+                                     uint32_t capacity);
+Status   Event_Bus_Publish          (Event_Bus_Topic_t *topic, const void *event);
+Status   Event_Bus_Subscribe        (Event_Bus_Topic_t *topic, Event_Bus_Reader_t *reader,
+                                     Event_Bus_Callback_t callback, void *context);
+Status   Event_Bus_Read             (Event_Bus_Reader_t *reader, void *event, uint32_t *sequence);
+uint32_t Event_Bus_Get_Dropped      (const Event_Bus_Reader_t *reader);
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
\ No newline at end of file
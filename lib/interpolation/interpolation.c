@@ -0,0 +1,236 @@
+#include "interpolation.h"
+
+/**********************************************************************************/
+/*                          Interpolation Core Functions                          */
+/**********************************************************************************/
+
+/**
+ * @brief  Initialises an interpolator to hold every axis at zero
+ * @param  interpolation: Pointer to Interpolation structure
+ * @param  axis_count:    Number of axes evaluated per step
+ * @retval Status indicating success or invalid parameters
+ */
+Status Interpolation_Init(Interpolation_t *interpolation, uint8_t axis_count) {
+    //validate interpolation struct pointer and axes
+    if (!interpolation || !axis_count || axis_count > INTERPOLATION_MAX_AXES) {
+        return INVALID_PARAM;
+    }
+
+    for (uint8_t i = 0; i < INTERPOLATION_MAX_AXES; i++) {
+        interpolation->a[i]       = 0;
+        interpolation->b[i]       = 0;
+        interpolation->c[i]       = 0;
+        interpolation->d[i]       = 0;
+        interpolation->value[i]   = 0;
+        interpolation->delta_1[i] = 0;
+        interpolation->delta_2[i] = 0;
+        interpolation->delta_3[i] = 0;
+    }
+    interpolation->axis_count = axis_count;
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Loads a cubic Hermite segment per axis
+ * @note   Tangents are in position per segment, so a tangent in position per second is
+ *         multiplied by the segment duration in seconds. Call @ref Interpolation_Start before
+ *         stepping
+ * @param  interpolation: Pointer to Interpolation structure
+ * @param  p0:            Array of start positions, one per axis
+ * @param  p1:            Array of end positions, one per axis
+ * @param  m0:            Array of start tangents, one per axis
+ * @param  m1:            Array of end tangents, one per axis
+ * @retval Status indicating success or invalid parameters
+ */
+Status Interpolation_Set_Hermite(Interpolation_t *interpolation, const float *p0, const float *p1,
+                                 const float *m0, const float *m1) {
+    //validate pointers
+    if (!interpolation || !p0 || !p1 || !m0 || !m1) {
+        return INVALID_PARAM;
+    }
+
+    for (uint8_t i = 0; i < interpolation->axis_count; i++) {
+        interpolation->a[i] = ((2.0f * p0[i]) - (2.0f * p1[i]) + m0[i] + m1[i]);
+        interpolation->b[i] = ((3.0f * p1[i]) - (3.0f * p0[i]) - (2.0f * m0[i]) - m1[i]);
+        interpolation->c[i] = m0[i];
+        interpolation->d[i] = p0[i];
+    }
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Loads a uniform Catmull-Rom segment per axis, passing through p0 and p1
+ * @note   Tangents are taken from the neighbouring points, so consecutive segments of a
+ *         sequence of evenly spaced points join with continuous velocity. Call
+ *         @ref Interpolation_Start before stepping
+ * @param  interpolation: Pointer to Interpolation structure
+ * @param  p_prev:        Array of points before p0, one per axis
+ * @param  p0:            Array of start positions, one per axis
+ * @param  p1:            Array of end positions, one per axis
+ * @param  p_next:        Array of points after p1, one per axis
+ * @retval Status indicating success or invalid parameters
+ */
+Status Interpolation_Set_Catmull_Rom(Interpolation_t *interpolation, const float *p_prev, const float *p0,
+                                     const float *p1, const float *p_next) {
+    //validate pointers
+    if (!interpolation || !p_prev || !p0 || !p1 || !p_next) {
+        return INVALID_PARAM;
+    }
+
+    for (uint8_t i = 0; i < interpolation->axis_count; i++) {
+        float m0 = ((p1[i] - p_prev[i]) * 0.5f);
+        float m1 = ((p_next[i] - p0[i]) * 0.5f);
+        interpolation->a[i] = ((2.0f * p0[i]) - (2.0f * p1[i]) + m0 + m1);
+        interpolation->b[i] = ((3.0f * p1[i]) - (3.0f * p0[i]) - (2.0f * m0) - m1);
+        interpolation->c[i] = m0;
+        interpolation->d[i] = p0[i];
+    }
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Loads a cubic Bezier segment per axis
+ * @note   The curve passes through p0 and p1 and leaves and arrives along the control points.
+ *         Call @ref Interpolation_Start before stepping
+ * @param  interpolation: Pointer to Interpolation structure
+ * @param  p0:            Array of start positions, one per axis
+ * @param  c0:            Array of first control points, one per axis
+ * @param  c1:            Array of second control points, one per axis
+ * @param  p1:            Array of end positions, one per axis
+ * @retval Status indicating success or invalid parameters
+ */
+Status Interpolation_Set_Bezier(Interpolation_t *interpolation, const float *p0, const float *c0,
+                                const float *c1, const float *p1) {
+    //validate pointers
+    if (!interpolation || !p0 || !c0 || !c1 || !p1) {
+        return INVALID_PARAM;
+    }
+
+    for (uint8_t i = 0; i < interpolation->axis_count; i++) {
+        interpolation->a[i] = (p1[i] - p0[i] + (3.0f * (c0[i] - c1[i])));
+        interpolation->b[i] = (3.0f * (p0[i] - (2.0f * c0[i]) + c1[i]));
+        interpolation->c[i] = (3.0f * (c0[i] - p0[i]));
+        interpolation->d[i] = p0[i];
+    }
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Prepares forward differencing of the loaded segment from a point in it
+ * @note   The next @ref Interpolation_Step returns the positions at start, and each one after
+ *         advances by step. Starting part way through lets a segment begin between frames,
+ *         and stepping 1 / n from 0 returns the start of the segment and n - 1 points before
+ *         its end, which is where the following segment starts
+ * @param  interpolation: Pointer to Interpolation structure
+ * @param  start:         Segment parameter of the first step (0 - 1)
+ * @param  step:          Segment parameter advanced by each step
+ * @retval Status indicating success or invalid parameters
+ */
+Status Interpolation_Start(Interpolation_t *interpolation, float start, float step) {
+    //validate interpolation struct pointer and step
+    if (!interpolation || step <= 0) {
+        return INVALID_PARAM;
+    }
+
+    //differences of a cubic one step before start, as each step advances before returning
+    float h   = step;
+    float u   = (start - h);
+    float h_2 = (h * h);
+    float h_3 = (h_2 * h);
+    for (uint8_t i = 0; i < interpolation->axis_count; i++) {
+        float a = interpolation->a[i];
+        float b = interpolation->b[i];
+        float c = interpolation->c[i];
+        interpolation->value[i]   = ((((a * u) + b) * u + c) * u + interpolation->d[i]);
+        interpolation->delta_1[i] = ((a * ((3.0f * u * u * h) + (3.0f * u * h_2) + h_3))
+                                     + (b * ((2.0f * u * h) + h_2)) + (c * h));
+        interpolation->delta_2[i] = ((a * ((6.0f * u * h_2) + (6.0f * h_3))) + (2.0f * b * h_2));
+        interpolation->delta_3[i] = (6.0f * a * h_3);
+    }
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Returns the positions at the current point and advances every axis by one step
+ * @note   Forward differencing costs three additions per axis and no multiplications. Error
+ *         accumulates with the number of steps, so segments are restarted via
+ *         @ref Interpolation_Start rather than stepped past their end
+ * @note   The output array must not overlap the interpolator. Each axis is read into locals
+ *         and written back once, so no store forces a reload of the state or axis count, and
+ *         the output is the advanced position rather than a copy the compiler would split
+ *         out into a call to memcpy
+ * @param  interpolation: Pointer to Interpolation structure
+ * @param  output:        Array receiving one position per axis
+ * @retval Status indicating success or invalid parameters
+ */
+Status Interpolation_Step(Interpolation_t *restrict interpolation, float *restrict output) {
+    //validate pointers
+    if (!interpolation || !output) {
+        return INVALID_PARAM;
+    }
+
+    //the arrays sit at fixed offsets in one struct, so every axis is addressed from one base
+    uint8_t count = interpolation->axis_count;
+    for (uint8_t i = 0; i < count; i++) {
+        float first    = interpolation->delta_1[i];
+        float second   = interpolation->delta_2[i];
+        float position = (interpolation->value[i] + first);
+        interpolation->value[i]   = position;
+        interpolation->delta_1[i] = (first + second);
+        interpolation->delta_2[i] = (second + interpolation->delta_3[i]);
+        output[i]                 = position;
+    }
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Evaluates the loaded segment directly at a point
+ * @note   Does not disturb stepping. Costs three multiply-adds per axis, so is meant for
+ *         random access and for checking @ref Interpolation_Step
+ * @param  interpolation: Pointer to Interpolation structure
+ * @param  u:             Segment parameter (0 - 1)
+ * @param  output:        Array receiving one position per axis
+ * @retval Status indicating success or invalid parameters
+ */
+Status Interpolation_Evaluate(const Interpolation_t *interpolation, float u, float *output) {
+    //validate pointers
+    if (!interpolation || !output) {
+        return INVALID_PARAM;
+    }
+
+    for (uint8_t i = 0; i < interpolation->axis_count; i++) {
+        output[i] = ((((interpolation->a[i] * u) + interpolation->b[i]) * u + interpolation->c[i]) * u
+                     + interpolation->d[i]);
+    }
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Evaluates the tangent of the loaded segment directly at a point
+ * @note   Tangents are in position per segment, as for @ref Interpolation_Set_Hermite, so
+ *         the tangent at a point can seed a Hermite segment that continues from it
+ * @param  interpolation: Pointer to Interpolation structure
+ * @param  u:             Segment parameter (0 - 1)
+ * @param  output:        Array receiving one tangent per axis
+ * @retval Status indicating success or invalid parameters
+ */
+Status Interpolation_Evaluate_Tangent(const Interpolation_t *interpolation, float u, float *output) {
+    //validate pointers
+    if (!interpolation || !output) {
+        return INVALID_PARAM;
+    }
+
+    for (uint8_t i = 0; i < interpolation->axis_count; i++) {
+        output[i] = ((((3.0f * interpolation->a[i] * u) + (2.0f * interpolation->b[i])) * u)
+                     + interpolation->c[i]);
+    }
+
+    return SUCCESS;
+}
\ No newline at end of file
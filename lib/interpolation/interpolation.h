@@ -0,0 +1,63 @@
+#ifndef __INTERPOLATION_H
+#define __INTERPOLATION_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../utils/utils.h"
+
+
+/**********************************************************************************/
+/*                                     Defines                                    */
+/**********************************************************************************/
+
+#ifndef INTERPOLATION_MAX_AXES
+#define INTERPOLATION_MAX_AXES      16U
+#endif
+
+
+/**********************************************************************************/
+/*                              Configuration Structs                             */
+/**********************************************************************************/
+
+/*
+ * one cubic segment per axis, p(u) = a u^3 + b u^2 + c u + d for u in [0, 1]. Each field is
+ * an array over axes so a step walks every array linearly in a single loop
+ */
+typedef struct {
+/********************************** Driver Owned **********************************/
+    float   a[INTERPOLATION_MAX_AXES];
+    float   b[INTERPOLATION_MAX_AXES];
+    float   c[INTERPOLATION_MAX_AXES];
+    float   d[INTERPOLATION_MAX_AXES];
+    float   value[INTERPOLATION_MAX_AXES];
+    float   delta_1[INTERPOLATION_MAX_AXES];
+    float   delta_2[INTERPOLATION_MAX_AXES];
+    float   delta_3[INTERPOLATION_MAX_AXES];
+    uint8_t axis_count;
+} Interpolation_t;
+
+
+/**********************************************************************************/
+/*                               Function Prototypes                              */
+/**********************************************************************************/
+
+Status Interpolation_Init            (Interpolation_t *interpolation, uint8_t axis_count);
+Status Interpolation_Set_Hermite     (Interpolation_t *interpolation, const float *p0, const float *p1,
+                                      const float *m0, const float *m1);
+Status Interpolation_Set_Catmull_Rom (Interpolation_t *interpolation, const float *p_prev, const float *p0,
+                                      const float *p1, const float *p_next);
+Status Interpolation_Set_Bezier      (Interpolation_t *interpolation, const float *p0, const float *c0,
+                                      const float *c1, const float *p1);
+Status Interpolation_Start           (Interpolation_t *interpolation, float start, float step);
+Status Interpolation_Step            (Interpolation_t *restrict interpolation, float *restrict output);
+Status Interpolation_Evaluate        (const Interpolation_t *interpolation, float u, float *output);
+Status Interpolation_Evaluate_Tangent(const Interpolation_t *interpolation, float u, float *output);
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
\ No newline at end of file
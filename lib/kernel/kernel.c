@@ -0,0 +1,811 @@
+#include "kernel.h"
+
+/**********************************************************************************/
+/*                                     Defines                                    */
+/**********************************************************************************/
+
+#define KERNEL_EXC_RETURN_THREAD    0xFFFFFFFDUL
+#define KERNEL_XPSR_THUMB           0x01000000UL
+#define KERNEL_READY_BIT(priority)  (0x80000000UL >> (priority))
+
+/* callee-saved FPU registers, only present in the frame when EXC_RETURN bit 4 is clear */
+#if defined(__ARM_FP)
+#define KERNEL_SAVE_FPU_FRAME       "tst      lr, #0x10         \n" \
+                                    "it       eq                \n" \
+                                    "vstmdbeq r3!, {s16-s31}    \n"
+#define KERNEL_LOAD_FPU_FRAME       "tst      lr, #0x10         \n" \
+                                    "it       eq                \n" \
+                                    "vldmiaeq r3!, {s16-s31}    \n"
+#else
+#define KERNEL_SAVE_FPU_FRAME       ""
+#define KERNEL_LOAD_FPU_FRAME       ""
+#endif
+
+
+/**********************************************************************************/
+/*                                 Static Variables                               */
+/**********************************************************************************/
+
+static Kernel_List_t     kernel_ready[KERNEL_PRIORITY_COUNT];
+static uint32_t          kernel_ready_mask;
+static uint32_t          kernel_basepri;
+static uint8_t           kernel_running;
+static Kernel_Thread_t   kernel_idle_thread;
+static uint32_t          kernel_idle_stack[KERNEL_IDLE_STACK_WORDS] __attribute__((aligned(8)));
+
+/* read and written by PendSV_Handler */
+__attribute__((used)) static Kernel_Thread_t *volatile kernel_current;
+__attribute__((used)) static Kernel_Thread_t *volatile kernel_next;
+
+
+/**********************************************************************************/
+/*                                Static Functions                                */
+/**********************************************************************************/
+
+static void Kernel_List_Init(Kernel_List_t *list) {
+    list->head = 0;
+    list->tail = &list->head;
+}
+
+static void Kernel_List_Append(Kernel_List_t *list, Kernel_Thread_t *thread) {
+    thread->next  = 0;
+    thread->pprev = list->tail;
+    *(list->tail) = thread;
+    list->tail    = &thread->next;
+    thread->list  = list;
+}
+
+static void Kernel_List_Prepend(Kernel_List_t *list, Kernel_Thread_t *thread) {
+    thread->next  = list->head;
+    thread->pprev = &list->head;
+    if (list->head) {
+        list->head->pprev = &thread->next;
+    } else {
+        list->tail = &thread->next;
+    }
+    list->head   = thread;
+    thread->list = list;
+}
+
+/**
+ * @brief  Queues a thread behind every waiter of the same or higher priority
+ * @note   O(n) in the number of waiters, so the head is always the next to be woken
+ */
+static void Kernel_List_Insert(Kernel_List_t *list, Kernel_Thread_t *thread) {
+    Kernel_Thread_t **link = &list->head;
+    while (*link && (*link)->priority <= thread->priority) {
+        link = &(*link)->next;
+    }
+
+    thread->next  = *link;
+    thread->pprev = link;
+    if (*link) {
+        (*link)->pprev = &thread->next;
+    } else {
+        list->tail = &thread->next;
+    }
+    *link        = thread;
+    thread->list = list;
+}
+
+static void Kernel_List_Remove(Kernel_Thread_t *thread) {
+    *(thread->pprev) = thread->next;
+    if (thread->next) {
+        thread->next->pprev = thread->pprev;
+    } else {
+        thread->list->tail = thread->pprev;
+    }
+    thread->list = 0;
+}
+
+/**
+ * @brief  Makes a thread ready at its current priority
+ * @note   The running thread goes to the front of its queue so that a priority change does
+ *         not cost it its turn, any other thread to the back
+ */
+static void Kernel_Ready_Add(Kernel_Thread_t *thread) {
+    thread->state = KERNEL_THREAD_READY;
+    if (thread == kernel_current) {
+        Kernel_List_Prepend(&kernel_ready[thread->priority], thread);
+    } else {
+        Kernel_List_Append(&kernel_ready[thread->priority], thread);
+    }
+    kernel_ready_mask |= KERNEL_READY_BIT(thread->priority);
+}
+
+static void Kernel_Ready_Remove(Kernel_Thread_t *thread) {
+    Kernel_List_Remove(thread);
+    if (!kernel_ready[thread->priority].head) {
+        kernel_ready_mask &= ~(KERNEL_READY_BIT(thread->priority));
+    }
+}
+
+/**
+ * @brief  Selects the highest priority ready thread and pends PendSV if it is not running
+ * @note   Called inside a kernel critical section. O(1), the idle thread keeps the ready
+ *         mask non-zero
+ */
+static void Kernel_Schedule(void) {
+    if (!kernel_running) {
+        return;
+    }
+
+    kernel_next = kernel_ready[CLZ(kernel_ready_mask)].head;
+    if (kernel_next != kernel_current) {
+        SCB->ICSR = SCB_ICSR_PENDSVSET;
+    }
+}
+
+/**
+ * @brief  Moves a thread to a new priority, keeping ready queues and wait lists ordered
+ */
+static void Kernel_Set_Priority(Kernel_Thread_t *thread, uint8_t priority) {
+    if (thread->state == KERNEL_THREAD_READY) {
+        Kernel_Ready_Remove(thread);
+        thread->priority = priority;
+        Kernel_Ready_Add(thread);
+    } else if (thread->list) {
+        Kernel_List_t *list = thread->list;
+        Kernel_List_Remove(thread);
+        thread->priority = priority;
+        Kernel_List_Insert(list, thread);
+    } else {
+        thread->priority = priority;
+    }
+}
+
+/**
+ * @brief  Applies priority inheritance from the waiters of every mutex a thread holds
+ * @note   Called inside a kernel critical section. A thread runs at the highest of its base
+ *         priority and the head waiter of each held mutex. When the thread is itself blocked
+ *         on a mutex the change is passed on to that mutex's owner
+ * @param  thread: Pointer to the thread whose mutexes have changed, may be NULL
+ */
+static void Kernel_Update_Priority(Kernel_Thread_t *thread) {
+    while (thread) {
+        uint8_t priority = thread->base_priority;
+        for (Kernel_Mutex_t *mutex = thread->held_mutexes; mutex; mutex = mutex->next_held) {
+            if (mutex->waiters.head && mutex->waiters.head->priority < priority) {
+                priority = mutex->waiters.head->priority;
+            }
+        }
+
+        if (priority == thread->priority) {
+            return;
+        }
+        Kernel_Set_Priority(thread, priority);
+        thread = thread->blocked_mutex ? thread->blocked_mutex->owner : 0;
+    }
+}
+
+/**
+ * @brief  Readies a blocked thread with the result of its wait
+ * @note   Called inside a kernel critical section
+ */
+static void Kernel_Wake(Kernel_Thread_t *thread, Status status) {
+    if (thread->list) {
+        Kernel_List_Remove(thread);
+    }
+    if (thread->timeout != TIMER_WHEEL_INVALID_HANDLE) {
+        Timer_Wheel_Cancel(thread->timeout);
+        thread->timeout = TIMER_WHEEL_INVALID_HANDLE;
+    }
+    thread->blocked_mutex = 0;
+    thread->wait_status   = status;
+    Kernel_Ready_Add(thread);
+}
+
+/**
+ * @brief  Ends a wait that has run out of time
+ * @note   Runs from the timer wheel in PendSV. A wake that raced the expiry has already
+ *         readied the thread, which cannot block again until PendSV has returned
+ * @param  context: Pointer to the waiting thread
+ */
+static void Kernel_Timeout(void *context) {
+    Kernel_Thread_t *thread = context;
+
+    uint32_t basepri = ENTER_CRITICAL_BASEPRI(kernel_basepri);
+    if (thread->state == KERNEL_THREAD_BLOCKED) {
+        Kernel_Mutex_t *mutex = thread->blocked_mutex;
+        thread->timeout = TIMER_WHEEL_INVALID_HANDLE;
+        Kernel_Wake(thread, ERROR);
+
+        //the owner may have been running at this thread's priority
+        if (mutex) {
+            Kernel_Update_Priority(mutex->owner);
+        }
+        Kernel_Schedule();
+    }
+    EXIT_CRITICAL_BASEPRI(basepri);
+}
+
+/**
+ * @brief  Takes the running thread off the ready queues to wait on a list
+ * @note   Called inside a kernel critical section. The switch happens in @ref Kernel_Switch
+ * @param  list:          Wait list ordered by priority, or NULL to only wait for the timeout
+ * @param  timeout_ticks: Systick ticks before the wait fails, or KERNEL_WAIT_FOREVER
+ * @retval Status indicating success, or error if the timer wheel is full
+ */
+static Status Kernel_Wait(Kernel_List_t *list, uint32_t timeout_ticks) {
+    Kernel_Thread_t *thread = kernel_current;
+    Kernel_Ready_Remove(thread);
+    thread->state       = KERNEL_THREAD_BLOCKED;
+    thread->wait_status = ERROR;
+    thread->timeout     = TIMER_WHEEL_INVALID_HANDLE;
+    if (list) {
+        Kernel_List_Insert(list, thread);
+    }
+
+    if (timeout_ticks != KERNEL_WAIT_FOREVER
+        && Timer_Wheel_Start(timeout_ticks, 0, Kernel_Timeout, thread, &thread->timeout) != SUCCESS) {
+        if (list) {
+            Kernel_List_Remove(thread);
+        }
+        Kernel_Ready_Add(thread);
+        return ERROR;
+    }
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Leaves the kernel critical section of a blocking call and waits to be woken
+ * @note   PendSV is taken as soon as BASEPRI is restored, and returns here once the thread
+ *         has been woken and scheduled again
+ * @param  basepri: BASEPRI value from entering the critical section
+ * @retval Status the thread was woken with, error on timeout
+ */
+static Status Kernel_Switch(uint32_t basepri) {
+    Kernel_Thread_t *thread = kernel_current;
+    Kernel_Schedule();
+    EXIT_CRITICAL_BASEPRI(basepri);
+
+    return (Status) thread->wait_status;
+}
+
+/**
+ * @brief  Reports whether the caller is a started thread, which may block
+ */
+static uint8_t Kernel_Can_Block(void) {
+    return (kernel_running && !(SCB->ICSR & SCB_ICSR_VECTACTIVE));
+}
+
+static void Kernel_Copy(void *destination, const void *source, uint32_t size) {
+    uint8_t       *to   = destination;
+    const uint8_t *from = source;
+    while (size--) {
+        *to++ = *from++;
+    }
+}
+
+/**
+ * @brief  Retires a thread whose entry function has returned
+ * @note   Mutexes still held by the thread are not released
+ */
+static void Kernel_Thread_Exit(void) {
+    uint32_t basepri = ENTER_CRITICAL_BASEPRI(kernel_basepri);
+    Kernel_Ready_Remove(kernel_current);
+    kernel_current->state = KERNEL_THREAD_DORMANT;
+    Kernel_Schedule();
+    EXIT_CRITICAL_BASEPRI(basepri);
+
+    while (1) {}
+}
+
+static void Kernel_Idle(void *argument) {
+    (void) argument;
+
+    while (1) {
+        WFI();
+    }
+}
+
+
+/**********************************************************************************/
+/*                             Scheduler Core Functions                           */
+/**********************************************************************************/
+
+/**
+ * @brief  Initialises the scheduler and creates the idle thread
+ * @note   Claims PendSV via @ref Deferred_Init, deferred work still runs ahead of every
+ *         context switch. Blocking with a timeout assumes the timer wheel has been started
+ *         via @ref Timer_Wheel_Init, so the timeout unit is the Systick period
+ * @note   Kernel critical sections raise BASEPRI to KERNEL_INTERRUPT_CLASS, so safety and
+ *         servo interrupts are never held off by the scheduler. Those interrupts must not
+ *         call kernel functions, and can hand work to threads via @ref Deferred_Post
+ * @retval Status indicating success, or error if PendSV is owned by another module
+ */
+Status Kernel_Init(void) {
+    //context switches run in PendSV at the lowest priority
+    if (Deferred_Init() != SUCCESS) {
+        return ERROR;
+    }
+
+#if defined(__ARM_FP)
+    //stack the FPU state only for threads that have used it, and only when the handler does
+    FPU->FPCCR |= (FPU_FPCCR_ASPEN | FPU_FPCCR_LSPEN);
+#endif
+
+    kernel_basepri = NVIC_Class_To_BASEPRI(KERNEL_INTERRUPT_CLASS);
+    for (uint32_t i = 0; i < KERNEL_PRIORITY_COUNT; i++) {
+        Kernel_List_Init(&kernel_ready[i]);
+    }
+    kernel_ready_mask = 0;
+    kernel_running    = 0;
+    kernel_current    = 0;
+    kernel_next       = 0;
+
+    return Kernel_Thread_Create(&kernel_idle_thread, Kernel_Idle, 0, kernel_idle_stack,
+                                KERNEL_IDLE_STACK_WORDS, KERNEL_PRIORITY_IDLE);
+}
+
+/**
+ * @brief  Starts the highest priority thread and never returns
+ * @note   Threads run in thread mode on the process stack, interrupts stay on the main stack
+ */
+void Kernel_Start(void) {
+    uint32_t basepri = ENTER_CRITICAL_BASEPRI(kernel_basepri);
+    kernel_running = 1;
+    Kernel_Schedule();
+    EXIT_CRITICAL_BASEPRI(basepri);
+
+    //PendSV loads the first thread
+    while (1) {}
+}
+
+/**
+ * @brief  Creates a thread on a statically allocated stack and makes it ready
+ * @note   Callable before or after @ref Kernel_Start. Threads of equal priority run in turn
+ *         only when one blocks or calls @ref Kernel_Yield. Returning from the entry function
+ *         retires the thread
+ * @param  thread:      Pointer to the thread control block, which must outlive the thread
+ * @param  entry:       Function run by the thread
+ * @param  argument:    Argument passed to the entry function
+ * @param  stack:       Pointer to the stack memory
+ * @param  stack_words: Size of the stack in words, at least KERNEL_STACK_MIN_WORDS
+ * @param  priority:    Priority from KERNEL_PRIORITY_HIGHEST (0) to KERNEL_PRIORITY_IDLE
+ * @retval Status indicating success or invalid parameters
+ */
+Status Kernel_Thread_Create(Kernel_Thread_t *thread, Kernel_Entry_t entry, void *argument,
+                            uint32_t *stack, uint32_t stack_words, uint8_t priority) {
+    //validate thread, entry, stack and priority
+    if (!thread || !entry || !stack || stack_words < KERNEL_STACK_MIN_WORDS
+        || priority >= KERNEL_PRIORITY_COUNT) {
+        return INVALID_PARAM;
+    }
+
+    //build the frame PendSV unstacks, the hardware frame returns into the entry function
+    uint32_t *stack_pointer = (uint32_t *) (((uintptr_t) (stack + stack_words)) & ~((uintptr_t) 7U));
+    *(--stack_pointer) = KERNEL_XPSR_THUMB;
+    *(--stack_pointer) = ((uint32_t) (uintptr_t) entry) & ~(1UL);
+    *(--stack_pointer) = (uint32_t) (uintptr_t) Kernel_Thread_Exit;
+    for (uint32_t i = 0; i < 4U; i++) {
+        *(--stack_pointer) = 0;
+    }
+    *(--stack_pointer) = (uint32_t) (uintptr_t) argument;
+    *(--stack_pointer) = KERNEL_EXC_RETURN_THREAD;
+    for (uint32_t i = 0; i < 8U; i++) {
+        *(--stack_pointer) = 0;
+    }
+
+    thread->stack_pointer = stack_pointer;
+    thread->list          = 0;
+    thread->blocked_mutex = 0;
+    thread->held_mutexes  = 0;
+    thread->message       = 0;
+    thread->timeout       = TIMER_WHEEL_INVALID_HANDLE;
+    thread->priority      = priority;
+    thread->base_priority = priority;
+    thread->wait_status   = SUCCESS;
+
+    uint32_t basepri = ENTER_CRITICAL_BASEPRI(kernel_basepri);
+    Kernel_Ready_Add(thread);
+    Kernel_Schedule();
+    EXIT_CRITICAL_BASEPRI(basepri);
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Returns the running thread
+ * @retval Pointer to the running thread, or NULL before @ref Kernel_Start
+ */
+Kernel_Thread_t *Kernel_Thread_Self(void) {
+    return kernel_current;
+}
+
+/**
+ * @brief  Lets the other ready threads of the same priority run first
+ */
+void Kernel_Yield(void) {
+    if (!Kernel_Can_Block()) {
+        return;
+    }
+
+    uint32_t basepri = ENTER_CRITICAL_BASEPRI(kernel_basepri);
+    Kernel_Thread_t *thread = kernel_current;
+    Kernel_List_Remove(thread);
+    Kernel_List_Append(&kernel_ready[thread->priority], thread);
+    Kernel_Schedule();
+    EXIT_CRITICAL_BASEPRI(basepri);
+}
+
+/**
+ * @brief  Blocks the running thread for a number of Systick ticks
+ * @param  ticks: Ticks to sleep for, 0 yields, KERNEL_WAIT_FOREVER never wakes
+ * @retval Status indicating success, invalid parameters outside a thread, or error if the
+ *         timer wheel is full
+ */
+Status Kernel_Sleep(uint32_t ticks) {
+    if (!Kernel_Can_Block()) {
+        return INVALID_PARAM;
+    }
+
+    if (!ticks) {
+        Kernel_Yield();
+        return SUCCESS;
+    }
+
+    uint32_t basepri = ENTER_CRITICAL_BASEPRI(kernel_basepri);
+    if (Kernel_Wait(0, ticks) != SUCCESS) {
+        EXIT_CRITICAL_BASEPRI(basepri);
+        return ERROR;
+    }
+    Kernel_Switch(basepri);
+
+    return SUCCESS;
+}
+
+
+/**********************************************************************************/
+/*                             Semaphore Core Functions                           */
+/**********************************************************************************/
+
+/**
+ * @brief  Initialises a counting semaphore
+ * @param  semaphore:     Pointer to the semaphore
+ * @param  initial_count: Starting count, at most max_count
+ * @param  max_count:     Highest count, 1 for a binary semaphore
+ * @retval Status indicating success or invalid parameters
+ */
+Status Kernel_Semaphore_Init(Kernel_Semaphore_t *semaphore, uint32_t initial_count, uint32_t max_count) {
+    //validate semaphore and counts
+    if (!semaphore || !max_count || initial_count > max_count) {
+        return INVALID_PARAM;
+    }
+
+    Kernel_List_Init(&semaphore->waiters);
+    semaphore->count     = initial_count;
+    semaphore->max_count = max_count;
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Decrements a semaphore, waiting while it is zero
+ * @note   Callable from interrupts at or below KERNEL_INTERRUPT_CLASS with KERNEL_NO_WAIT
+ * @param  semaphore:     Pointer to the semaphore
+ * @param  timeout_ticks: Systick ticks to wait, KERNEL_NO_WAIT or KERNEL_WAIT_FOREVER
+ * @retval Status indicating success, invalid parameters, or error on timeout
+ */
+Status Kernel_Semaphore_Take(Kernel_Semaphore_t *semaphore, uint32_t timeout_ticks) {
+    //validate semaphore, only threads may wait
+    if (!semaphore || (timeout_ticks != KERNEL_NO_WAIT && !Kernel_Can_Block())) {
+        return INVALID_PARAM;
+    }
+
+    uint32_t basepri = ENTER_CRITICAL_BASEPRI(kernel_basepri);
+    if (semaphore->count) {
+        semaphore->count--;
+        EXIT_CRITICAL_BASEPRI(basepri);
+        return SUCCESS;
+    }
+
+    if (timeout_ticks == KERNEL_NO_WAIT || Kernel_Wait(&semaphore->waiters, timeout_ticks) != SUCCESS) {
+        EXIT_CRITICAL_BASEPRI(basepri);
+        return ERROR;
+    }
+
+    return Kernel_Switch(basepri);
+}
+
+/**
+ * @brief  Wakes the highest priority waiter, or increments the semaphore if there is none
+ * @note   Callable from interrupts at or below KERNEL_INTERRUPT_CLASS
+ * @param  semaphore: Pointer to the semaphore
+ * @retval Status indicating success, invalid parameters, or error if already at max_count
+ */
+Status Kernel_Semaphore_Give(Kernel_Semaphore_t *semaphore) {
+    //validate semaphore
+    if (!semaphore) {
+        return INVALID_PARAM;
+    }
+
+    Status status = SUCCESS;
+
+    uint32_t basepri = ENTER_CRITICAL_BASEPRI(kernel_basepri);
+    if (semaphore->waiters.head) {
+        Kernel_Wake(semaphore->waiters.head, SUCCESS);
+        Kernel_Schedule();
+    } else if (semaphore->count < semaphore->max_count) {
+        semaphore->count++;
+    } else {
+        status = ERROR;
+    }
+    EXIT_CRITICAL_BASEPRI(basepri);
+
+    return status;
+}
+
+
+/**********************************************************************************/
+/*                               Mutex Core Functions                             */
+/**********************************************************************************/
+
+/**
+ * @brief  Initialises an unlocked mutex
+ * @param  mutex: Pointer to the mutex
+ * @retval Status indicating success or invalid parameters
+ */
+Status Kernel_Mutex_Init(Kernel_Mutex_t *mutex) {
+    //validate mutex
+    if (!mutex) {
+        return INVALID_PARAM;
+    }
+
+    Kernel_List_Init(&mutex->waiters);
+    mutex->owner     = 0;
+    mutex->next_held = 0;
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Locks a mutex, waiting while another thread owns it
+ * @note   Threads only, and not recursive. While waiting, the owner inherits the priority of
+ *         the caller if it is higher, so a low priority owner cannot be held off by threads
+ *         between the two
+ * @param  mutex:         Pointer to the mutex
+ * @param  timeout_ticks: Systick ticks to wait, KERNEL_NO_WAIT or KERNEL_WAIT_FOREVER
+ * @retval Status indicating success, invalid parameters, or error on timeout or if the caller
+ *         already owns the mutex
+ */
+Status Kernel_Mutex_Lock(Kernel_Mutex_t *mutex, uint32_t timeout_ticks) {
+    //validate mutex, only threads may own a mutex
+    if (!mutex || !Kernel_Can_Block()) {
+        return INVALID_PARAM;
+    }
+
+    Kernel_Thread_t *thread = kernel_current;
+
+    uint32_t basepri = ENTER_CRITICAL_BASEPRI(kernel_basepri);
+    if (!mutex->owner) {
+        mutex->owner         = thread;
+        mutex->next_held     = thread->held_mutexes;
+        thread->held_mutexes = mutex;
+        EXIT_CRITICAL_BASEPRI(basepri);
+        return SUCCESS;
+    }
+
+    if (mutex->owner == thread || timeout_ticks == KERNEL_NO_WAIT
+        || Kernel_Wait(&mutex->waiters, timeout_ticks) != SUCCESS) {
+        EXIT_CRITICAL_BASEPRI(basepri);
+        return ERROR;
+    }
+
+    //lend the caller's priority to the owner, and on down the chain it is waiting on
+    thread->blocked_mutex = mutex;
+    Kernel_Update_Priority(mutex->owner);
+
+    //ownership is handed over by the unlocking thread
+    return Kernel_Switch(basepri);
+}
+
+/**
+ * @brief  Unlocks a mutex, handing it to the highest priority waiter
+ * @note   Threads only. The caller drops back to the highest priority it still inherits
+ * @param  mutex: Pointer to the mutex
+ * @retval Status indicating success, invalid parameters, or error if the caller is not the owner
+ */
+Status Kernel_Mutex_Unlock(Kernel_Mutex_t *mutex) {
+    //validate mutex and ownership
+    if (!mutex || !Kernel_Can_Block()) {
+        return INVALID_PARAM;
+    }
+
+    Kernel_Thread_t *thread = kernel_current;
+    if (mutex->owner != thread) {
+        return ERROR;
+    }
+
+    uint32_t basepri = ENTER_CRITICAL_BASEPRI(kernel_basepri);
+    Kernel_Mutex_t **link = &thread->held_mutexes;
+    while (*link != mutex) {
+        link = &(*link)->next_held;
+    }
+    *link = mutex->next_held;
+
+    Kernel_Thread_t *waiter = mutex->waiters.head;
+    mutex->owner = waiter;
+    if (waiter) {
+        Kernel_Wake(waiter, SUCCESS);
+        mutex->next_held     = waiter->held_mutexes;
+        waiter->held_mutexes = mutex;
+        Kernel_Update_Priority(waiter);
+    }
+    Kernel_Update_Priority(thread);
+    Kernel_Schedule();
+    EXIT_CRITICAL_BASEPRI(basepri);
+
+    return SUCCESS;
+}
+
+
+/**********************************************************************************/
+/*                           Message Queue Core Functions                         */
+/**********************************************************************************/
+
+/**
+ * @brief  Initialises a message queue of fixed size items
+ * @note   Items are copied in and out inside a kernel critical section, so keep them to a
+ *         few words and pass pointers for anything larger
+ * @param  queue:     Pointer to the queue
+ * @param  buffer:    Pointer to storage for capacity items
+ * @param  item_size: Size of each item in bytes
+ * @param  capacity:  Number of items the buffer holds
+ * @retval Status indicating success or invalid parameters
+ */
+Status Kernel_Queue_Init(Kernel_Queue_t *queue, void *buffer, uint32_t item_size, uint32_t capacity) {
+    //validate queue, buffer and sizes
+    if (!queue || !buffer || !item_size || !capacity) {
+        return INVALID_PARAM;
+    }
+
+    Kernel_List_Init(&queue->senders);
+    Kernel_List_Init(&queue->receivers);
+    queue->buffer    = buffer;
+    queue->item_size = item_size;
+    queue->capacity  = capacity;
+    queue->count     = 0;
+    queue->head      = 0;
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Sends an item, waiting while the queue is full
+ * @note   An item sent while a thread is waiting to receive is copied straight to it.
+ *         Callable from interrupts at or below KERNEL_INTERRUPT_CLASS with KERNEL_NO_WAIT
+ * @param  queue:         Pointer to the queue
+ * @param  item:          Pointer to the item to copy in
+ * @param  timeout_ticks: Systick ticks to wait, KERNEL_NO_WAIT or KERNEL_WAIT_FOREVER
+ * @retval Status indicating success, invalid parameters, or error on timeout
+ */
+Status Kernel_Queue_Send(Kernel_Queue_t *queue, const void *item, uint32_t timeout_ticks) {
+    //validate queue and item, only threads may wait
+    if (!queue || !item || (timeout_ticks != KERNEL_NO_WAIT && !Kernel_Can_Block())) {
+        return INVALID_PARAM;
+    }
+
+    uint32_t basepri = ENTER_CRITICAL_BASEPRI(kernel_basepri);
+    Kernel_Thread_t *receiver = queue->receivers.head;
+    if (receiver) {
+        Kernel_Copy(receiver->message, item, queue->item_size);
+        Kernel_Wake(receiver, SUCCESS);
+        Kernel_Schedule();
+        EXIT_CRITICAL_BASEPRI(basepri);
+        return SUCCESS;
+    }
+
+    if (queue->count < queue->capacity) {
+        uint32_t index = (queue->head + queue->count);
+        if (index >= queue->capacity) {
+            index -= queue->capacity;
+        }
+        Kernel_Copy(&queue->buffer[index * queue->item_size], item, queue->item_size);
+        queue->count++;
+        EXIT_CRITICAL_BASEPRI(basepri);
+        return SUCCESS;
+    }
+
+    //the receiver that frees a slot copies the item in on this thread's behalf
+    kernel_current->message = (void *) item;
+    if (timeout_ticks == KERNEL_NO_WAIT || Kernel_Wait(&queue->senders, timeout_ticks) != SUCCESS) {
+        EXIT_CRITICAL_BASEPRI(basepri);
+        return ERROR;
+    }
+
+    return Kernel_Switch(basepri);
+}
+
+/**
+ * @brief  Receives the oldest item, waiting while the queue is empty
+ * @note   Callable from interrupts at or below KERNEL_INTERRUPT_CLASS with KERNEL_NO_WAIT
+ * @param  queue:         Pointer to the queue
+ * @param  item:          Pointer to copy the item out to
+ * @param  timeout_ticks: Systick ticks to wait, KERNEL_NO_WAIT or KERNEL_WAIT_FOREVER
+ * @retval Status indicating success, invalid parameters, or error on timeout
+ */
+Status Kernel_Queue_Receive(Kernel_Queue_t *queue, void *item, uint32_t timeout_ticks) {
+    //validate queue and item, only threads may wait
+    if (!queue || !item || (timeout_ticks != KERNEL_NO_WAIT && !Kernel_Can_Block())) {
+        return INVALID_PARAM;
+    }
+
+    uint32_t basepri = ENTER_CRITICAL_BASEPRI(kernel_basepri);
+    if (queue->count) {
+        Kernel_Copy(item, &queue->buffer[queue->head * queue->item_size], queue->item_size);
+        if (++queue->head >= queue->capacity) {
+            queue->head = 0;
+        }
+        queue->count--;
+
+        //senders only wait on a full queue, move the first one into the freed slot
+        Kernel_Thread_t *sender = queue->senders.head;
+        if (sender) {
+            uint32_t index = (queue->head + queue->count);
+            if (index >= queue->capacity) {
+                index -= queue->capacity;
+            }
+            Kernel_Copy(&queue->buffer[index * queue->item_size], sender->message, queue->item_size);
+            queue->count++;
+            Kernel_Wake(sender, SUCCESS);
+            Kernel_Schedule();
+        }
+        EXIT_CRITICAL_BASEPRI(basepri);
+        return SUCCESS;
+    }
+
+    //a sender copies its item straight to this thread
+    kernel_current->message = item;
+    if (timeout_ticks == KERNEL_NO_WAIT || Kernel_Wait(&queue->receivers, timeout_ticks) != SUCCESS) {
+        EXIT_CRITICAL_BASEPRI(basepri);
+        return ERROR;
+    }
+
+    return Kernel_Switch(basepri);
+}
+
+
+/**********************************************************************************/
+/*                            Kernel Interrupt Handlers                           */
+/**********************************************************************************/
+
+/**
+ * @brief  Runs deferred work, then switches to kernel_next if it is not the running thread
+ * @note   Overrides the weak handler in utils. Deferred work runs first so that anything it
+ *         wakes is scheduled by this same exception. r4 - r11, EXC_RETURN and, for threads
+ *         with an FPU frame, s16 - s31 are stacked on the outgoing thread's process stack.
+ *         Stacking s16 - s31 also completes any pending lazy FPU stacking of s0 - s15, so
+ *         threads that never touch the FPU never pay for it
+ */
+__attribute__((naked)) void PendSV_Handler(void) {
+    __asm__ volatile(
+        "push     {r4, lr}                      \n"
+        "bl       Deferred_Run                  \n"
+        "pop      {r4, lr}                      \n"
+        "cpsid    i                             \n"
+        "movw     r2, #:lower16:kernel_current  \n"
+        "movt     r2, #:upper16:kernel_current  \n"
+        "movw     r1, #:lower16:kernel_next     \n"
+        "movt     r1, #:upper16:kernel_next     \n"
+        "ldr      r0, [r2]                      \n"
+        "ldr      r1, [r1]                      \n"
+        "cmp      r0, r1                        \n"
+        "beq      2f                            \n"
+        "cbz      r0, 1f                        \n"
+        "mrs      r3, psp                       \n"
+        KERNEL_SAVE_FPU_FRAME
+        "stmdb    r3!, {r4-r11, lr}             \n"
+        "str      r3, [r0]                      \n"
+        "1:                                     \n"
+        "str      r1, [r2]                      \n"
+        "ldr      r3, [r1]                      \n"
+        "ldmia    r3!, {r4-r11, lr}             \n"
+        KERNEL_LOAD_FPU_FRAME
+        "msr      psp, r3                       \n"
+        "2:                                     \n"
+        "cpsie    i                             \n"
+        "bx       lr                            \n"
+    );
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+#ifndef __KERNEL_H
+#define __KERNEL_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../utils/utils.h"
+#include "../timer_wheel/timer_wheel.h"
+
+
+/**********************************************************************************/
+/*                                     Defines                                    */
+/**********************************************************************************/
+
+#define KERNEL_PRIORITY_COUNT       32U
+#define KERNEL_PRIORITY_HIGHEST     0U
+#define KERNEL_PRIORITY_IDLE        (KERNEL_PRIORITY_COUNT - 1U)
+
+#define KERNEL_NO_WAIT              0UL
+#define KERNEL_WAIT_FOREVER         0xFFFFFFFFUL
+
+/* interrupts in this class and below may call kernel functions, higher classes are never masked */
+#ifndef KERNEL_INTERRUPT_CLASS
+#define KERNEL_INTERRUPT_CLASS      NVIC_CLASS_FEEDBACK
+#endif
+
+#ifndef KERNEL_IDLE_STACK_WORDS
+#define KERNEL_IDLE_STACK_WORDS     128U
+#endif
+
+/* hardware frame, r4 - r11 and EXC_RETURN, with room for an FPU frame and one call */
+#define KERNEL_STACK_MIN_WORDS      96U
+
+
+/**********************************************************************************/
+/*                                      Enums                                     */
+/**********************************************************************************/
+
+typedef enum {
+    KERNEL_THREAD_DORMANT = 0,
+    KERNEL_THREAD_READY,
+    KERNEL_THREAD_BLOCKED
+} Kernel_Thread_State;
+
+
+/**********************************************************************************/
+/*                                 Callback Types                                 */
+/**********************************************************************************/
+
+typedef void (*Kernel_Entry_t)(void *argument);
+
+
+/**********************************************************************************/
+/*                                 Kernel Objects                                 */
+/**********************************************************************************/
+
+struct Kernel_Thread;
+struct Kernel_Mutex;
+
+typedef struct {
+    struct Kernel_Thread  *head;
+    struct Kernel_Thread  **tail;
+} Kernel_List_t;
+
+typedef struct Kernel_Thread {
+    uint32_t              *stack_pointer;       /* must stay first, saved and loaded by PendSV */
+    struct Kernel_Thread  *next;
+    struct Kernel_Thread  **pprev;
+    Kernel_List_t         *list;
+    struct Kernel_Mutex   *blocked_mutex;
+    struct Kernel_Mutex   *held_mutexes;
+    void                  *message;
+    Timer_Wheel_Handle_t  timeout;
+    uint8_t               priority;
+    uint8_t               base_priority;
+    uint8_t               state;
+    uint8_t               wait_status;
+} Kernel_Thread_t;
+
+typedef struct {
+    Kernel_List_t         waiters;
+    uint32_t              count;
+    uint32_t              max_count;
+} Kernel_Semaphore_t;
+
+typedef struct Kernel_Mutex {
+    Kernel_List_t         waiters;
+    Kernel_Thread_t       *owner;
+    struct Kernel_Mutex   *next_held;
+} Kernel_Mutex_t;
+
+typedef struct {
+    Kernel_List_t         senders;
+    Kernel_List_t         receivers;
+    uint8_t               *buffer;
+    uint32_t              item_size;
+    uint32_t              capacity;
+    uint32_t              count;
+    uint32_t              head;
+} Kernel_Queue_t;
+
+
+/**********************************************************************************/
+/*                               Function Prototypes                              */
+/**********************************************************************************/
+
+/*********************************** Scheduler ************************************/
+Status           Kernel_Init                (void);
+void             Kernel_Start               (void);
+Status           Kernel_Thread_Create       (Kernel_Thread_t *thread, Kernel_Entry_t entry, void *argument,
+                                             uint32_t *stack, uint32_t stack_words, uint8_t priority);
+Kernel_Thread_t *Kernel_Thread_Self         (void);
+void             Kernel_Yield               (void);
+Status           Kernel_Sleep               (uint32_t ticks);
+
+/*********************************** Semaphores ***********************************/
+Status           Kernel_Semaphore_Init      (Kernel_Semaphore_t *semaphore, uint32_t initial_count,
+                                             uint32_t max_count);
+Status           Kernel_Semaphore_Take      (Kernel_Semaphore_t *semaphore, uint32_t timeout_ticks);
+Status           Kernel_Semaphore_Give      (Kernel_Semaphore_t *semaphore);
+
+/************************************ Mutexes *************************************/
+Status           Kernel_Mutex_Init          (Kernel_Mutex_t *mutex);
+Status           Kernel_Mutex_Lock          (Kernel_Mutex_t *mutex, uint32_t timeout_ticks);
+Status           Kernel_Mutex_Unlock        (Kernel_Mutex_t *mutex);
+
+/********************************* Message Queues *********************************/
+Status           Kernel_Queue_Init          (Kernel_Queue_t *queue, void *buffer, uint32_t item_size,
+                                             uint32_t capacity);
+Status           Kernel_Queue_Send          (Kernel_Queue_t *queue, const void *item, uint32_t timeout_ticks);
+Status           Kernel_Queue_Receive       (Kernel_Queue_t *queue, void *item, uint32_t timeout_ticks);
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
\ No newline at end of file
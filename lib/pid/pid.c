@@ -0,0 +1,293 @@
+#include "pid.h"
+
+/**********************************************************************************/
+/*                                 Static Variables                               */
+/**********************************************************************************/
+
+static PID_Config_t *pid_configs;
+static PID_Axis_t   pid_axes[PID_MAX_AXES] = {0};
+static uint8_t      pid_axis_count         = 0;
+static uint32_t     pid_last_frame;
+
+
+/**********************************************************************************/
+/*                                Static Functions                                */
+/**********************************************************************************/
+
+/**
+ * @brief  Limits an axis's output to the calibrated pulse range of its channel
+ * @note   The range is the channel's calibrated min and max pulse (see
+ *         @ref TIM1_Servo_Set_Calibration) converted to compare ticks, as
+ *         @ref TIM1_Servo_Set_Pulse does
+ */
+static void PID_Load_Range(PID_Axis_t *axis, TIM1_Channel channel) {
+    TIM1_Servo_Calibration_t calibration;
+    TIM1_Servo_Get_Calibration(channel, &calibration);
+
+    axis->ccr_min = (int32_t) ((((uint32_t) calibration.min_pulse) * (TIM1->ARR + 1U)) / TIM1_SERVO_FRAME_US);
+    axis->ccr_max = (int32_t) ((((uint32_t) calibration.max_pulse) * (TIM1->ARR + 1U)) / TIM1_SERVO_FRAME_US);
+}
+
+/**
+ * @brief  Runs one controller step for every enabled axis
+ * @note   Called from the TIM1 update interrupt once per PWM frame. Axes are stored in a
+ *         single array so the loop walks memory linearly with fixed offsets. Each step is
+ *         skipped unless the ADC has completed a new frame, so stale feedback is never
+ *         integrated twice
+ * @note   The output is feedforward plus correction: the compare value written by
+ *         @ref TIM1_Servo_Set_Position is the base, and the controller adds a Q16.16
+ *         correction to it. Preload is enabled so the new value applies from the next frame
+ * @note   An axis whose output the supervisor has gated by clearing its CCxE bit holds its
+ *         integrator at zero, so it does not wind up against a servo that is not driven
+ */
+static void PID_Update(void) {
+    //hold integrators at zero while outputs are disabled by the safety subsystem
+    if (!(TIM1->BDTR & TIM_BDTR_MOE)) {
+        for (PID_Axis_t *axis = pid_axes; axis < (pid_axes + pid_axis_count); axis++) {
+            axis->integral = 0;
+        }
+        return;
+    }
+
+    //only run on fresh feedback
+    uint32_t frame = ADC_Get_Frame_Count();
+    if (frame == pid_last_frame) {
+        return;
+    }
+    pid_last_frame = frame;
+
+    uint32_t ccer = TIM1->CCER;
+    for (PID_Axis_t *axis = pid_axes; axis < (pid_axes + pid_axis_count); axis++) {
+        if (!(axis->enabled)) {
+            continue;
+        }
+
+        //hold a gated axis at rest, tracking feedback so re-enabling does not kick
+        if (!(ccer & axis->ccer_enable)) {
+            uint16_t feedback;
+            if (ADC_Read(axis->feedback_index, &feedback) == SUCCESS) {
+                axis->prev_feedback = feedback;
+            }
+            axis->integral = 0;
+            continue;
+        }
+
+        //unpack target feedback and base compare value from a single atomic word
+        uint32_t setpoint = axis->setpoint;
+        int32_t  target   = (int32_t) (setpoint >> 16U);
+        int32_t  base     = (int32_t) (setpoint & 0xFFFFUL);
+
+        uint16_t feedback;
+        ADC_Read(axis->feedback_index, &feedback);
+
+        //calculate error with deadband
+        int32_t error = (target - (int32_t) feedback);
+        if (error <= (int32_t) axis->deadband && error >= -((int32_t) axis->deadband)) {
+            error = 0;
+        }
+
+        //derivative on measurement avoids a kick when the target changes
+        int64_t proportional = ((int64_t) axis->kp * error);
+        int64_t derivative   = ((int64_t) axis->kd * ((int32_t) axis->prev_feedback - (int32_t) feedback));
+        axis->prev_feedback  = feedback;
+
+        //clamp integrator to its limit
+        int64_t integral = (axis->integral + ((int64_t) axis->ki * error));
+        if (integral > axis->integral_limit) {
+            integral = axis->integral_limit;
+        } else if (integral < -(axis->integral_limit)) {
+            integral = -(axis->integral_limit);
+        }
+
+        //sum terms and saturate to the calibrated pulse range
+        int64_t output = (proportional + integral + derivative);
+        int32_t ccr    = (base + (int32_t) (output >> PID_Q16_SHIFT));
+        uint8_t saturated_high = 0, saturated_low = 0;
+        if (ccr > axis->ccr_max) {
+            ccr = axis->ccr_max;
+            saturated_high = 1U;
+        } else if (ccr < axis->ccr_min) {
+            ccr = axis->ccr_min;
+            saturated_low = 1U;
+        }
+
+        //only commit integration that does not drive further into saturation
+        if (!((saturated_high && integral > axis->integral) || (saturated_low && integral < axis->integral))) {
+            axis->integral = (int32_t) integral;
+        }
+
+        *(axis->ccr) = (uint32_t) ccr;
+    }
+}
+
+
+/**********************************************************************************/
+/*                               PID Core Functions                               */
+/**********************************************************************************/
+
+/**
+ * @brief  Initialises closed-loop position control for a set of servo axes
+ * @note   Assumes each channel has been configured via @ref TIM1_Servo_Init and the ADC
+ *         via @ref ADC_Init with a TIM1 trigger, so one feedback frame arrives per PWM frame
+ * @note   Gains are Q16.16 compare ticks per feedback count (see @ref PID_Q16) and are
+ *         applied once per PWM frame, so the sample period is folded into ki and kd. A
+ *         feedback_max below feedback_min reverses the sensor direction
+ * @note   Axes start disabled; call @ref PID_Set_Target then @ref PID_Enable_Axis
+ * @param  configs:    Array of PID_Config structures, one per axis
+ * @param  axis_count: Number of axes in the array
+ * @retval Status indicating success or invalid parameters
+ */
+Status PID_Init(PID_Config_t *configs, uint8_t axis_count) {
+    //validate config array
+    if (!configs || axis_count < 1 || axis_count > PID_MAX_AXES) {
+        return INVALID_PARAM;
+    }
+
+    //validate axes
+    for (uint8_t i = 0; i < axis_count; i++) {
+        if (Validate_TIM1_Channel(configs[i].channel) != SUCCESS
+            || configs[i].feedback_min == configs[i].feedback_max || configs[i].integral_limit < 0) {
+            return INVALID_PARAM;
+        }
+    }
+
+    //claim update interrupt at the servo latency class
+    if (NVIC_Request_IRQ(TIM1_UP_TIM10_IRQn, NVIC_CLASS_SERVO, TIM1) != SUCCESS) {
+        return INVALID_PARAM;
+    }
+
+    //build per-axis state, reversing gains for reversed sensors
+    pid_axis_count = 0;
+    for (uint8_t i = 0; i < axis_count; i++) {
+        PID_Config_t *config = &configs[i];
+        PID_Axis_t   *axis   = &pid_axes[i];
+        int32_t      sign    = (config->feedback_max > config->feedback_min) ? 1 : -1;
+
+        axis->enabled        = 0;
+        axis->ccr            = (&TIM1->CCR1 + (config->channel - TIM1_CHANNEL_1));
+        axis->ccer_enable    = (TIM_CCER_CC1E << ((config->channel - TIM1_CHANNEL_1) * 4U));
+        axis->setpoint       = 0;
+        axis->kp             = (sign * config->kp);
+        axis->ki             = (sign * config->ki);
+        axis->kd             = (sign * config->kd);
+        axis->integral       = 0;
+        PID_Load_Range(axis, config->channel);
+        axis->integral_limit = config->integral_limit ? config->integral_limit
+                                                      : (((axis->ccr_max - axis->ccr_min) / 2) << PID_Q16_SHIFT);
+        axis->prev_feedback  = 0;
+        axis->deadband       = config->deadband;
+        axis->feedback_index = config->feedback_index;
+    }
+    pid_configs    = configs;
+    pid_axis_count = axis_count;
+    pid_last_frame = ADC_Get_Frame_Count();
+
+    //run controller from the update interrupt
+    TIM1_Register_Update_Callback(PID_Update);
+    TIM1->SR   &= ~(TIM_SR_UIF);
+    TIM1->DIER |= TIM_DIER_UIE;
+    NVIC_Enable_IRQ(TIM1_UP_TIM10_IRQn);
+
+    DSB();
+    return SUCCESS;
+}
+
+/**
+ * @brief  Sets the target position of an axis
+ * @note   The open-loop compare value is written immediately via @ref TIM1_Servo_Set_Position
+ *         and becomes the feedforward term of the controller. The output range is reloaded
+ *         from the channel's calibration, so a recalibrated servo is clamped to its new range
+ * @param  axis:    Index of the axis in the array passed to @ref PID_Init
+ * @param  degrees: Target position in degrees (0 - 180)
+ * @retval Status indicating success or invalid parameters
+ */
+Status PID_Set_Target(uint8_t axis, float degrees) {
+    //validate axis
+    if (axis >= pid_axis_count) {
+        return INVALID_PARAM;
+    }
+
+    //map degrees onto the feedback range
+    PID_Config_t *config = &pid_configs[axis];
+    int32_t span   = ((int32_t) config->feedback_max - (int32_t) config->feedback_min);
+    int32_t target = ((int32_t) config->feedback_min + (int32_t) ((degrees / 180.0f) * (float) span));
+
+    //write open-loop position and read it back before the controller can overwrite it
+    uint32_t basepri = ENTER_CRITICAL_BASEPRI(NVIC_Class_To_BASEPRI(NVIC_CLASS_SERVO));
+    if (TIM1_Servo_Set_Position(config->channel, degrees) != SUCCESS) {
+        EXIT_CRITICAL_BASEPRI(basepri);
+        return INVALID_PARAM;
+    }
+    uint32_t base = (*(pid_axes[axis].ccr) & 0xFFFFUL);
+    PID_Load_Range(&pid_axes[axis], config->channel);
+
+    //publish target and base together so the controller never sees a mismatched pair
+    pid_axes[axis].setpoint = ((((uint32_t) target) << 16U) | base);
+    EXIT_CRITICAL_BASEPRI(basepri);
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Starts closing the loop on an axis
+ * @param  axis: Index of the axis in the array passed to @ref PID_Init
+ * @retval Status indicating success, invalid parameters, or error if no target has been set
+ */
+Status PID_Enable_Axis(uint8_t axis) {
+    //validate axis and target
+    if (axis >= pid_axis_count) {
+        return INVALID_PARAM;
+    }
+    if (!(pid_axes[axis].setpoint)) {
+        return ERROR;
+    }
+
+    //seed derivative term with current feedback to avoid a kick on the first step
+    uint16_t feedback;
+    if (ADC_Read(pid_axes[axis].feedback_index, &feedback) != SUCCESS) {
+        return ERROR;
+    }
+    pid_axes[axis].prev_feedback = feedback;
+    pid_axes[axis].integral      = 0;
+    pid_axes[axis].enabled       = 1U;
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Stops closing the loop on an axis and restores its open-loop position
+ * @param  axis: Index of the axis in the array passed to @ref PID_Init
+ * @retval Status indicating success or invalid parameters
+ */
+Status PID_Disable_Axis(uint8_t axis) {
+    //validate axis
+    if (axis >= pid_axis_count) {
+        return INVALID_PARAM;
+    }
+
+    pid_axes[axis].enabled = 0;
+    if (pid_axes[axis].setpoint) {
+        *(pid_axes[axis].ccr) = (pid_axes[axis].setpoint & 0xFFFFUL);
+    }
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Reads the integrator of an axis
+ * @note   A value held at the integral limit indicates the axis cannot reach its target,
+ *         e.g. because of a mechanical stop or excessive load
+ * @param  axis:     Index of the axis in the array passed to @ref PID_Init
+ * @param  integral: Pointer to store the Q16.16 integrator value in compare ticks
+ * @retval Status indicating success or invalid parameters
+ */
+Status PID_Get_Integral(uint8_t axis, int32_t *integral) {
+    //validate axis and integral pointer
+    if (axis >= pid_axis_count || !integral) {
+        return INVALID_PARAM;
+    }
+
+    *integral = pid_axes[axis].integral;
+
+    return SUCCESS;
+}
\ No newline at end of file
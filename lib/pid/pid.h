@@ -0,0 +1,73 @@
+#ifndef __PID_H
+#define __PID_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../utils/utils.h"
+#include "../drivers/tim1/tim1.h"
+#include "../drivers/adc/adc.h"
+
+
+/**********************************************************************************/
+/*                                     Defines                                    */
+/**********************************************************************************/
+
+#define PID_MAX_AXES            4U
+#define PID_Q16_SHIFT           16U
+#define PID_Q16(value)          ((int32_t) ((value) * 65536.0f))
+
+
+/**********************************************************************************/
+/*                              Configuration Structs                             */
+/**********************************************************************************/
+
+typedef struct {
+/************************************ Required ************************************/
+    TIM1_Channel channel;
+    uint8_t      feedback_index;
+    uint16_t     feedback_min;
+    uint16_t     feedback_max;
+    int32_t      kp;
+    int32_t      ki;
+/************************************ Optional ************************************/
+    int32_t      kd;
+    int32_t      integral_limit;
+    uint16_t     deadband;
+} PID_Config_t;
+
+typedef struct {
+    volatile uint32_t *ccr;
+    volatile uint32_t setpoint;
+    int32_t           kp;
+    int32_t           ki;
+    int32_t           kd;
+    int32_t           integral;
+    int32_t           integral_limit;
+    int32_t           ccr_min;
+    int32_t           ccr_max;
+    uint32_t          ccer_enable;
+    uint16_t          prev_feedback;
+    uint16_t          deadband;
+    uint8_t           feedback_index;
+    volatile uint8_t  enabled;
+} PID_Axis_t;
+
+
+/**********************************************************************************/
+/*                               Function Prototypes                              */
+/**********************************************************************************/
+
+Status PID_Init                  (PID_Config_t *pid_configs, uint8_t axis_count);
+Status PID_Set_Target            (uint8_t axis, float degrees);
+Status PID_Enable_Axis           (uint8_t axis);
+Status PID_Disable_Axis          (uint8_t axis);
+Status PID_Get_Integral          (uint8_t axis, int32_t *integral);
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
\ No newline at end of file
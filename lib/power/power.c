@@ -0,0 +1,162 @@
+#include "power.h"
+
+/**********************************************************************************/
+/*                                 Static Variables                               */
+/**********************************************************************************/
+
+static Power_Mode        power_mode          = POWER_MODE_WFI;
+static uint32_t          power_start_cycles  = 0;
+static uint64_t          power_start_wall    = 0;
+static volatile uint32_t power_sleeps        = 0;
+
+/* sleep clocks gated by the previous call, so a later call can hand them back */
+static uint32_t          power_gates[4]      = {0};
+
+
+/**********************************************************************************/
+/*                                Static Functions                                */
+/**********************************************************************************/
+
+/**
+ * @brief  Reads wall time from the TIM1 frame count and counter, in core clock cycles
+ * @note   TIM1 keeps counting while the core sleeps. An update that has happened but not yet
+ *         been counted by its interrupt is added here
+ * @retval Core clock cycles since TIM1 started
+ */
+static uint64_t Power_Get_Wall_Cycles(void) {
+    uint32_t frames, count, pending;
+    do {
+        frames  = g_tim1_time;
+        count   = TIM1->CNT;
+        pending = (TIM1->SR & TIM_SR_UIF);
+    } while (frames != g_tim1_time);
+
+    //the counter has wrapped but the update interrupt has not run yet
+    if (pending && count < (TIM1->ARR / 2U)) {
+        frames++;
+    }
+
+    return ((((uint64_t) frames * (TIM1->ARR + 1UL)) + count) * (TIM1->PSC + 1UL));
+}
+
+
+/**********************************************************************************/
+/*                              Power Core Functions                              */
+/**********************************************************************************/
+
+/**
+ * @brief  Configures sleep behaviour and which peripheral clocks run while the core sleeps
+ * @note   Every peripheral keeps its clock in sleep except those listed in the gate masks
+ *         (RCC_xxxENR bit positions), so drivers initialised after this call are not stopped
+ *         by WFI. Only list peripherals the application never uses while sleeping. SRAM1
+ *         and the flash interface stay clocked unless both DMA controllers are gated. A
+ *         later call replaces the gate masks of the previous one
+ * @note   Assumes TIM1 is running with its update interrupt enabled, as the servo frame
+ *         timer is the wall clock for @ref Power_Get_Stats
+ * @param  power_config: Pointer to Power_Config structure containing power settings, may be
+ *                       NULL for WFI idle with no extra gating
+ * @retval Status indicating success, invalid parameters, or error if TIM1 is not running
+ */
+Status Power_Init(const Power_Config_t *power_config) {
+    Power_Config_t config = {0};
+    if (power_config) {
+        config = *power_config;
+    }
+
+    //validate mode and wall clock
+    if (config.mode < POWER_MODE_WFI || config.mode > POWER_MODE_SLEEP_ON_EXIT) {
+        return INVALID_PARAM;
+    }
+    if (!(TIM1->CR1 & TIM_CR1_CEN) || !(TIM1->DIER & TIM_DIER_UIE)) {
+        return ERROR;
+    }
+
+    //DMA transfers during sleep need SRAM1 and the flash interface
+    if ((config.ahb1_gate & (RCC_AHB1ENR_DMA1EN | RCC_AHB1ENR_DMA2EN)) != (RCC_AHB1ENR_DMA1EN | RCC_AHB1ENR_DMA2EN)) {
+        config.ahb1_gate &= ~(RCC_AHB1LPENR_SRAM1LPEN | RCC_AHB1LPENR_FLITFLPEN);
+    }
+
+    //gate only the listed peripheral clocks during sleep, restoring those gated before
+    RCC->AHB1LPENR = ((RCC->AHB1LPENR | power_gates[0]) & ~(config.ahb1_gate));
+    RCC->AHB2LPENR = ((RCC->AHB2LPENR | power_gates[1]) & ~(config.ahb2_gate));
+    RCC->APB1LPENR = ((RCC->APB1LPENR | power_gates[2]) & ~(config.apb1_gate));
+    RCC->APB2LPENR = ((RCC->APB2LPENR | power_gates[3]) & ~(config.apb2_gate));
+    power_gates[0] = config.ahb1_gate;
+    power_gates[1] = config.ahb2_gate;
+    power_gates[2] = config.apb1_gate;
+    power_gates[3] = config.apb2_gate;
+
+    //sleep, not stop, on WFI
+    SCB->SCR &= ~(SCB_SCR_SLEEPDEEP | SCB_SCR_SLEEPONEXIT);
+    power_mode = config.mode;
+
+    //start the first measurement window
+    if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA)) {
+        Cycle_Counter_Init();
+    }
+    power_sleeps       = 0;
+    power_start_cycles = Cycle_Counter_Get();
+    power_start_wall   = Power_Get_Wall_Cycles();
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Sleeps until the next interrupt
+ * @note   In WFI mode this returns after the interrupt has been handled, so call it in the
+ *         main loop between checks of the work to do
+ * @note   In sleep-on-exit mode the core goes straight back to sleep after every interrupt
+ *         without returning to thread mode, until an interrupt calls @ref Power_Wake
+ */
+void Power_Idle(void) {
+    power_sleeps++;
+    if (power_mode == POWER_MODE_SLEEP_ON_EXIT) {
+        SCB->SCR |= SCB_SCR_SLEEPONEXIT;
+    }
+    DSB();
+    WFI();
+}
+
+/**
+ * @brief  Returns to thread mode at the end of the current interrupt in sleep-on-exit mode
+ * @note   Called from an interrupt that leaves work for the main loop
+ */
+void Power_Wake(void) {
+    SCB->SCR &= ~(SCB_SCR_SLEEPONEXIT);
+}
+
+/**
+ * @brief  Measures how busy the core has been since the previous call
+ * @note   Active time is read from the DWT cycle counter, which stops while the core sleeps,
+ *         and elapsed time from TIM1. A debugger that keeps the core clock running in sleep
+ *         (DBGMCU DBG_SLEEP) makes the core look fully busy. Call at least every 40s at
+ *         96MHz, before the cycle counter wraps
+ * @param  stats: Pointer to store the active and elapsed core cycles, the number of idle
+ *                calls, and the CPU duty cycle in tenths of a percent
+ * @retval Status indicating success or invalid parameters
+ */
+Status Power_Get_Stats(Power_Stats_t *stats) {
+    //validate stats pointer
+    if (!stats) {
+        return INVALID_PARAM;
+    }
+
+    uint32_t cycles  = Cycle_Counter_Get();
+    uint64_t wall    = Power_Get_Wall_Cycles();
+    uint64_t active  = (uint32_t) (cycles - power_start_cycles);
+    uint64_t elapsed = (wall - power_start_wall);
+
+    //start the next measurement window
+    power_start_cycles = cycles;
+    power_start_wall   = wall;
+
+    stats->active_cycles  = (uint32_t) active;
+    stats->elapsed_cycles = (uint32_t) elapsed;
+    stats->sleeps         = ATOMIC_EXCHANGE(&power_sleeps, 0);
+    stats->duty_permille  = 1000U;
+    if (elapsed > active) {
+        stats->duty_permille = (uint16_t) ((active * 1000U) / elapsed);
+    }
+
+    return SUCCESS;
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#ifndef __POWER_H
+#define __POWER_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../utils/utils.h"
+
+
+/**********************************************************************************/
+/*                                      Enums                                     */
+/**********************************************************************************/
+
+typedef enum {
+    POWER_MODE_WFI = 0,
+    POWER_MODE_SLEEP_ON_EXIT
+} Power_Mode;
+
+
+/**********************************************************************************/
+/*                              Configuration Structs                             */
+/**********************************************************************************/
+
+typedef struct {
+/************************************ Optional ************************************/
+    Power_Mode mode;
+    uint32_t   ahb1_gate;
+    uint32_t   ahb2_gate;
+    uint32_t   apb1_gate;
+    uint32_t   apb2_gate;
+} Power_Config_t;
+
+typedef struct {
+    uint32_t active_cycles;
+    uint32_t elapsed_cycles;
+    uint32_t sleeps;
+    uint16_t duty_permille;
+} Power_Stats_t;
+
+
+/**********************************************************************************/
+/*                               Function Prototypes                              */
+/**********************************************************************************/
+
+Status Power_Init                (const Power_Config_t *power_config);
+void   Power_Idle                (void);
+void   Power_Wake                (void);
+Status Power_Get_Stats           (Power_Stats_t *stats);
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
\ No newline at end of file
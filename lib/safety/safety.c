@@ -0,0 +1,335 @@
+#include "safety.h"
+
+/**********************************************************************************/
+/*                                 Static Variables                               */
+/**********************************************************************************/
+
+static Safety_Config_t          *safety_config;
+static Safety_Input_t           *safety_inputs_by_line[16] = {0};
+static volatile Safety_Status_t  safety_status             = {0};
+
+
+/**********************************************************************************/
+/*                                Static Functions                                */
+/**********************************************************************************/
+
+/**
+ * @brief  Determines whether a pin is currently at its active level
+ * @param  port:         Pointer to GPIO_t structure containing the GPIO port
+ * @param  pin:          Number of the pin to be read
+ * @param  active_level: Level at which the pin signals a fault
+ * @retval 1 if the pin is active, otherwise 0
+ */
+static uint8_t Safety_Pin_Active(GPIO_t *port, GPIO_Pin pin, Safety_Active_Level active_level) {
+    Bit_State state = GPIO_Read_Pin(port, pin);
+    if (active_level == SAFETY_ACTIVE_HIGH) {
+        return (state == BIT_SET) ? 1U : 0U;
+    } else {
+        return (state == BIT_RESET) ? 1U : 0U;
+    }
+}
+
+/**
+ * @brief  Determines whether any safety input or the break pin is at its active level
+ * @retval 1 if an input is active, otherwise 0
+ */
+static uint8_t Safety_Any_Input_Active(void) {
+    for (uint8_t i = 0; i < safety_config->input_count; i++) {
+        Safety_Input_t *input = &safety_config->inputs[i];
+        if (Safety_Pin_Active(input->port, input->pin, input->active_level)) {
+            return 1U;
+        }
+    }
+    if (safety_config->break_pin == SAFETY_BREAK_PA6
+        && Safety_Pin_Active(GPIOA, GPIO_PIN_6, safety_config->break_polarity)) {
+        return 1U;
+    }
+    if (safety_config->break_pin == SAFETY_BREAK_PB12
+        && Safety_Pin_Active(GPIOB, GPIO_PIN_12, safety_config->break_polarity)) {
+        return 1U;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief  Forces all TIM1 outputs to their safe state and latches a fault
+ * @note   Latency is measured from entry_cycles until MOE reads back as cleared, so it covers
+ *         the dispatch as well as the break event itself
+ * @note   The break event sets BIF, so interrupts are masked until the fault is latched.
+ *         Otherwise the break handler preempts a caller below the safety class and latches
+ *         the trip as a break input fault of its own
+ * @param  fault:        Fault code to be latched
+ * @param  pin:          Input pin responsible for the fault
+ * @param  entry_cycles: Cycle counter value when the trip was first detected
+ */
+static void Safety_Trip_From(Safety_Fault fault, GPIO_Pin pin, uint32_t entry_cycles) {
+    uint32_t primask = ENTER_CRITICAL();
+
+    //generate break event and wait for the outputs to be disabled
+    TIM1->EGR = TIM_EGR_BG;
+    TIM1_Set_Output_Lock(1U);
+    for (uint8_t i = 0; i < SAFETY_MOE_POLL_LIMIT && (TIM1->BDTR & TIM_BDTR_MOE); i++) {}
+
+    uint32_t safe_cycles = Cycle_Counter_Get();
+
+    //latch first fault before the break handler can run
+    if (safety_status.fault == SAFETY_FAULT_NONE) {
+        safety_status.fault          = fault;
+        safety_status.pin            = pin;
+        safety_status.latency_cycles = (safe_cycles - entry_cycles);
+    }
+    safety_status.trip_count++;
+
+    EXIT_CRITICAL(primask);
+}
+
+/**
+ * @brief  Trips the subsystem from an EXTI line linked to a safety input
+ * @note   Latency is timed from entry to the EXTI handler
+ * @param  pin: EXTI line that triggered
+ */
+static void Safety_EXTI_Callback(GPIO_Pin pin) {
+    Safety_Input_t *input = safety_inputs_by_line[pin];
+    Safety_Fault   fault  = (input && input->type == SAFETY_INPUT_ESTOP) ? SAFETY_FAULT_ESTOP
+                                                                         : SAFETY_FAULT_LIMIT_SWITCH;
+    Safety_Trip_From(fault, pin, EXTI_Get_Entry_Cycles());
+}
+
+
+/**********************************************************************************/
+/*                              Safety Core Functions                             */
+/**********************************************************************************/
+
+/**
+ * @brief  Initialises the limit switch and e-stop inputs and the TIM1 break function
+ * @note   Assumes TIM1 outputs have been configured via @ref TIM1_Servo_Init or
+ *         @ref TIM1_OC_Init. A trip clears TIM1 MOE in hardware, driving every channel to
+ *         its idle (low) level. Automatic output enable is disabled so outputs stay off
+ *         until @ref Safety_Clear_Fault is called, and @ref TIM1_OC_Init leaves MOE cleared
+ *         while a fault is latched
+ * @note   Inputs trip on their first active edge; debouncing is applied on recovery only,
+ *         so contact bounce can never re-enable the outputs
+ * @param  config: Pointer to Safety_Config structure containing safety settings
+ * @retval Status indicating success or invalid parameters
+ */
+Status Safety_Init(Safety_Config_t *config) {
+    //validate config struct pointer and inputs
+    if (!config || (config->input_count && !(config->inputs)) || config->input_count > 16) {
+        return INVALID_PARAM;
+    }
+
+    //validate break pin and polarity
+    if (config->break_pin < SAFETY_BREAK_DISABLED || config->break_pin > SAFETY_BREAK_PB12
+        || config->break_polarity < SAFETY_ACTIVE_HIGH || config->break_polarity > SAFETY_ACTIVE_LOW) {
+        return INVALID_PARAM;
+    }
+
+    //validate inputs, each needs an EXTI line of its own
+    uint32_t lines = 0;
+    for (uint8_t i = 0; i < config->input_count; i++) {
+        Safety_Input_t *input = &config->inputs[i];
+        if (input->pin < GPIO_PIN_0 || input->pin > GPIO_PIN_15 || (lines & (SET_ONE << input->pin))
+            || input->type < SAFETY_INPUT_LIMIT_SWITCH || input->type > SAFETY_INPUT_ESTOP
+            || input->active_level < SAFETY_ACTIVE_HIGH || input->active_level > SAFETY_ACTIVE_LOW) {
+            return INVALID_PARAM;
+        }
+        lines |= (SET_ONE << input->pin);
+    }
+
+    //claim break interrupt at the highest latency class
+    if (NVIC_Request_IRQ(TIM1_BRK_TIM9_IRQn, NVIC_CLASS_SAFETY, TIM1) != SUCCESS) {
+        return INVALID_PARAM;
+    }
+
+    safety_config = config;
+    safety_status.fault          = SAFETY_FAULT_NONE;
+    safety_status.trip_count     = 0;
+    safety_status.latency_cycles = 0;
+
+    //enable cycle counter for trip latency measurement, without resetting it for other users
+    if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA)) {
+        Cycle_Counter_Init();
+    }
+
+    //enable TIM1 clock
+    RCC->APB2ENR |= RCC_APB2ENR_TIM1EN;
+
+    //drive all channels low when the main output is disabled
+    TIM1->CR2 &= ~(TIM_CR2_OIS1 | TIM_CR2_OIS2 | TIM_CR2_OIS3 | TIM_CR2_OIS4);
+
+    //configure break input, off-state selection and disable automatic output enable
+    uint32_t bdtr = (TIM1->BDTR & (TIM_BDTR_DTG | TIM_BDTR_MOE));
+    bdtr |= (TIM_BDTR_OSSR | TIM_BDTR_OSSI);
+    if (config->break_pin != SAFETY_BREAK_DISABLED) {
+        GPIO_Config_t break_gpio = {
+            .port         = (config->break_pin == SAFETY_BREAK_PA6) ? GPIOA : GPIOB,
+            .pin          = (config->break_pin == SAFETY_BREAK_PA6) ? GPIO_PIN_6 : GPIO_PIN_12,
+            .mode         = GPIO_MODE_AF,
+            .alt_function = GPIO_AF_1,
+            .pupd         = (config->break_polarity == SAFETY_ACTIVE_HIGH) ? GPIO_PUPD_PULLDOWN
+                                                                            : GPIO_PUPD_PULLUP
+        };
+        if (GPIO_Init(&break_gpio) != SUCCESS) {
+            return INVALID_PARAM;
+        }
+        bdtr |= TIM_BDTR_BKE;
+        if (config->break_polarity == SAFETY_ACTIVE_HIGH) {
+            bdtr |= TIM_BDTR_BKP;
+        }
+    }
+    TIM1->BDTR = bdtr;
+
+    //configure limit switch and e-stop inputs
+    for (uint8_t i = 0; i < 16U; i++) {
+        safety_inputs_by_line[i] = 0;
+    }
+    for (uint8_t i = 0; i < config->input_count; i++) {
+        Safety_Input_t *input = &config->inputs[i];
+        GPIO_Config_t input_gpio = {
+            .port = input->port,
+            .pin  = input->pin,
+            .mode = GPIO_MODE_INPUT,
+            .pupd = (input->active_level == SAFETY_ACTIVE_HIGH) ? GPIO_PUPD_PULLDOWN : GPIO_PUPD_PULLUP
+        };
+        if (GPIO_Init(&input_gpio) != SUCCESS) {
+            return INVALID_PARAM;
+        }
+
+        safety_inputs_by_line[input->pin] = input;
+
+        EXTI_Config_t input_exti = {
+            .port               = input->port,
+            .pin                = input->pin,
+            .trigger            = (input->active_level == SAFETY_ACTIVE_HIGH) ? EXTI_TRIGGER_RISING
+                                                                               : EXTI_TRIGGER_FALLING,
+            .callback           = Safety_EXTI_Callback,
+            .interrupt_class    = NVIC_CLASS_SAFETY
+        };
+        if (EXTI_Init(&input_exti) != SUCCESS) {
+            return INVALID_PARAM;
+        }
+    }
+
+    //configure break interrupt
+    TIM1->SR &= ~(TIM_SR_BIF);
+    TIM1->DIER |= TIM_DIER_BIE;
+    NVIC_Enable_IRQ(TIM1_BRK_TIM9_IRQn);
+
+    DSB();
+    return SUCCESS;
+}
+
+/**
+ * @brief  Forces all TIM1 outputs to their safe state and latches a fault
+ * @note   Generates a TIM1 break event so MOE is cleared by the same hardware path as the
+ *         break input. Only the first fault is latched; later trips increment the trip count
+ * @note   A software trip is timed from this call until MOE reads back as cleared
+ * @param  fault: Fault code to be latched
+ * @param  pin:   Input pin responsible for the fault
+ */
+void Safety_Trip(Safety_Fault fault, GPIO_Pin pin) {
+    Safety_Trip_From(fault, pin, Cycle_Counter_Get());
+}
+
+/**
+ * @brief  Returns the latched fault code
+ * @retval Safety_Fault latched since the last call to @ref Safety_Clear_Fault
+ */
+Safety_Fault Safety_Get_Fault(void) {
+    return safety_status.fault;
+}
+
+/**
+ * @brief  Copies the latched fault, trip count and trip latency
+ * @note   latency_cycles is measured from entry to the EXTI or break handler, or from the
+ *         @ref Safety_Trip call, until MOE reads back as cleared. Exception entry from the
+ *         input edge adds a fixed 12 cycles plus two cycles of EXTI synchronisation. The break
+ *         input clears MOE in hardware before its handler runs, so its latency only covers
+ *         the read back. Use @ref Cycles_To_Nanoseconds to convert
+ * @param  status: Pointer to Safety_Status structure to be filled
+ * @retval Status indicating success or invalid parameters
+ */
+Status Safety_Get_Status(Safety_Status_t *status) {
+    //validate status struct pointer
+    if (!status) {
+        return INVALID_PARAM;
+    }
+
+    status->fault          = safety_status.fault;
+    status->pin            = safety_status.pin;
+    status->trip_count     = safety_status.trip_count;
+    status->latency_cycles = safety_status.latency_cycles;
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Clears the latched fault and re-enables TIM1 outputs
+ * @note   Every input is sampled recovery_samples times, recovery_interval_us apart, and must
+ *         read inactive on each sample before outputs are re-enabled. Blocks for the whole
+ *         debounce period, timed with the cycle counter
+ * @note   The fault stays latched unless MOE is confirmed set afterwards
+ * @retval Status indicating success, or error if an input is still active or MOE stays cleared
+ */
+Status Safety_Clear_Fault(void) {
+    //validate initialisation
+    if (!safety_config) {
+        return ERROR;
+    }
+
+    //confirm all inputs are stably inactive over the debounce period
+    uint32_t samples  = safety_config->recovery_samples ? safety_config->recovery_samples : 1U;
+    uint32_t interval = safety_config->recovery_interval_us ? safety_config->recovery_interval_us
+                                                            : SAFETY_RECOVERY_INTERVAL_US;
+    uint32_t interval_cycles = (interval * (g_sys_clk_freq / SEC_TO_MICRO));
+    for (uint32_t sample = 0; sample < samples; sample++) {
+        if (sample) {
+            uint32_t start = Cycle_Counter_Get();
+            while ((Cycle_Counter_Get() - start) < interval_cycles) {}
+        }
+        if (Safety_Any_Input_Active()) {
+            return ERROR;
+        }
+    }
+
+    //re-enable main output, hardware keeps MOE cleared while the break input is active
+    TIM1->SR &= ~(TIM_SR_BIF);
+    TIM1->BDTR |= TIM_BDTR_MOE;
+    DSB();
+    if (!(TIM1->BDTR & TIM_BDTR_MOE)) {
+        return ERROR;
+    }
+
+    //clear fault, let channel initialisation enable outputs again and re-arm break interrupt
+    safety_status.fault = SAFETY_FAULT_NONE;
+    TIM1_Set_Output_Lock(0);
+    TIM1->DIER |= TIM_DIER_BIE;
+
+    return SUCCESS;
+}
+
+
+/**********************************************************************************/
+/*                            Safety Interrupt Handlers                           */
+/**********************************************************************************/
+
+/** @brief  Handles TIM1 break and TIM9 global interrupts */
+void TIM1_BRK_TIM9_IRQHandler(void) {
+    uint32_t entry_cycles = Cycle_Counter_Get();
+
+    if (TIM1->SR & TIM_SR_BIF) {
+        //disable break interrupt until recovery so an active input cannot storm the CPU
+        TIM1->DIER &= ~(TIM_DIER_BIE);
+        TIM1->SR   &= ~(TIM_SR_BIF);
+
+        //outputs are already safe; latch break input fault if no software trip preceded it
+        TIM1_Set_Output_Lock(1U);
+        if (safety_status.fault == SAFETY_FAULT_NONE) {
+            for (uint8_t i = 0; i < SAFETY_MOE_POLL_LIMIT && (TIM1->BDTR & TIM_BDTR_MOE); i++) {}
+            safety_status.latency_cycles = (Cycle_Counter_Get() - entry_cycles);
+            safety_status.fault          = SAFETY_FAULT_BREAK_INPUT;
+            safety_status.trip_count++;
+        }
+    }
+}
@@ -0,0 +1,103 @@
+#ifndef __SAFETY_H
+#define __SAFETY_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../utils/utils.h"
+#include "../drivers/gpio/gpio.h"
+#include "../drivers/exti/exti.h"
+#include "../drivers/tim1/tim1.h"
+
+
+/**********************************************************************************/
+/*                                     Defines                                    */
+/**********************************************************************************/
+
+/* reads of MOE after a break event before the trip gives up waiting for it to clear */
+#define SAFETY_MOE_POLL_LIMIT       16U
+
+/* default spacing of the recovery samples taken by Safety_Clear_Fault */
+#ifndef SAFETY_RECOVERY_INTERVAL_US
+#define SAFETY_RECOVERY_INTERVAL_US 1000U
+#endif
+
+
+/**********************************************************************************/
+/*                                      Enums                                     */
+/**********************************************************************************/
+
+typedef enum {
+    SAFETY_FAULT_NONE = 0,
+    SAFETY_FAULT_BREAK_INPUT,
+    SAFETY_FAULT_LIMIT_SWITCH,
+    SAFETY_FAULT_ESTOP
+} Safety_Fault;
+
+typedef enum {
+    SAFETY_INPUT_LIMIT_SWITCH = 0,
+    SAFETY_INPUT_ESTOP
+} Safety_Input_Type;
+
+typedef enum {
+    SAFETY_ACTIVE_HIGH = 0,
+    SAFETY_ACTIVE_LOW
+} Safety_Active_Level;
+
+typedef enum {
+    SAFETY_BREAK_DISABLED = 0,
+    SAFETY_BREAK_PA6,
+    SAFETY_BREAK_PB12
+} Safety_Break_Pin;
+
+
+/**********************************************************************************/
+/*                              Configuration Structs                             */
+/**********************************************************************************/
+
+typedef struct {
+/************************************ Required ************************************/
+    GPIO_t              *port;
+    GPIO_Pin            pin;
+    Safety_Input_Type   type;
+/************************************ Optional ************************************/
+    Safety_Active_Level active_level;
+} Safety_Input_t;
+
+typedef struct {
+/************************************ Required ************************************/
+    Safety_Input_t      *inputs;
+    uint8_t             input_count;
+/************************************ Optional ************************************/
+    Safety_Break_Pin    break_pin;
+    Safety_Active_Level break_polarity;
+    uint32_t            recovery_samples;
+    uint32_t            recovery_interval_us;
+} Safety_Config_t;
+
+typedef struct {
+    Safety_Fault fault;
+    GPIO_Pin     pin;
+    uint32_t     trip_count;
+    uint32_t     latency_cycles;
+} Safety_Status_t;
+
+
+/**********************************************************************************/
+/*                               Function Prototypes                              */
+/**********************************************************************************/
+
+Status       Safety_Init                 (Safety_Config_t *safety_config);
+void         Safety_Trip                 (Safety_Fault fault, GPIO_Pin pin);
+Safety_Fault Safety_Get_Fault            (void);
+Status       Safety_Get_Status           (Safety_Status_t *status);
+Status       Safety_Clear_Fault          (void);
+void         TIM1_BRK_TIM9_IRQHandler    (void);
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
\ No newline at end of file
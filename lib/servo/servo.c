@@ -0,0 +1,459 @@
+#include "servo.h"
+
+/**********************************************************************************/
+/*                                 Static Variables                               */
+/**********************************************************************************/
+
+typedef struct {
+    Servo_Backend            backend;
+    TIM1_Channel             tim1_channel;
+    GPIO_t                   *port;
+    uint32_t                 pin_mask;
+    PCA9685_t                *expander;
+    uint8_t                  expander_channel;
+    uint8_t                  expander_index;
+    TIM1_Servo_Calibration_t calibration;
+    uint16_t                 pulse_us;
+} Servo_Axis_t;
+
+/* falling edges are merged per port and time, rising edges per port */
+typedef struct {
+    GPIO_t   *port;
+    uint32_t mask;
+    uint16_t offset_us;
+} Servo_Mux_Edge_t;
+
+typedef struct {
+    Servo_Mux_Edge_t rise[SERVO_MAX_AXES];
+    Servo_Mux_Edge_t fall[SERVO_MAX_AXES];
+    uint8_t          rise_count;
+    uint8_t          fall_count;
+} Servo_Mux_Schedule_t;
+
+static Servo_Axis_t         servo_axes[SERVO_MAX_AXES];
+static uint8_t              servo_axis_count       = 0;
+
+/* an expander stays pending from a staged change until one of its flushes is accepted */
+static PCA9685_t            *servo_expanders[SERVO_MAX_AXES];
+static uint8_t              servo_expander_pending[SERVO_MAX_AXES];
+static uint8_t              servo_expander_count   = 0;
+
+/* the alarm reads the active schedule while the next one is built in the other */
+static Servo_Mux_Schedule_t servo_mux_schedules[2];
+static volatile uint32_t    servo_mux_active       = 0;
+static volatile uint32_t    servo_mux_pending      = 0;
+static uint64_t             servo_mux_frame_start  = 0;
+static uint8_t              servo_mux_next_edge    = 0;
+static uint8_t              servo_mux_in_frame     = 0;
+static uint8_t              servo_mux_running      = 0;
+
+
+/**********************************************************************************/
+/*                                Static Functions                                */
+/**********************************************************************************/
+
+static uint16_t Servo_Degrees_To_Pulse(const TIM1_Servo_Calibration_t *calibration, float degrees) {
+    float pulse_us;
+    if (degrees <= 90.0f) {
+        pulse_us = ((float) calibration->min_pulse
+                    + ((float) (calibration->centre_pulse - calibration->min_pulse) * (degrees / 90.0f)));
+    } else {
+        pulse_us = ((float) calibration->centre_pulse
+                    + ((float) (calibration->max_pulse - calibration->centre_pulse) * ((degrees - 90.0f) / 90.0f)));
+    }
+
+    return (uint16_t) (pulse_us + 0.5f);
+}
+
+/**
+ * @brief  Generates the software pulses of one frame from the TIM5 alarm
+ * @note   Every pin rises at the frame start, then each falling edge is released when due.
+ *         The frame stays open from the rising edges until the last falling edge, so an alarm
+ *         for the first falling edge never restarts the frame or swaps the schedule.
+ *         Edges within SERVO_MUX_SPIN_US of each other are released from the same interrupt
+ *         by spinning, rather than paying another interrupt entry per edge. Frame starts
+ *         advance by exactly TIM1_SERVO_FRAME_US from the previous deadline so the frame
+ *         rate does not drift with interrupt latency
+ * @param  now_us: Time the alarm was dispatched
+ */
+static void Servo_Mux_Alarm(uint64_t now_us) {
+    //start a new frame, taking the latest schedule if one is waiting
+    if (!servo_mux_in_frame) {
+        if (servo_mux_pending) {
+            servo_mux_active ^= 1U;
+            servo_mux_pending = 0;
+        }
+        const Servo_Mux_Schedule_t *schedule = &servo_mux_schedules[servo_mux_active];
+        for (uint8_t i = 0; i < schedule->rise_count; i++) {
+            schedule->rise[i].port->BSRR = schedule->rise[i].mask;
+        }
+        servo_mux_in_frame = 1U;
+    }
+
+    //release every falling edge that is due or about to be
+    const Servo_Mux_Schedule_t *schedule = &servo_mux_schedules[servo_mux_active];
+    while (servo_mux_next_edge < schedule->fall_count) {
+        const Servo_Mux_Edge_t *edge = &schedule->fall[servo_mux_next_edge];
+        uint64_t deadline = (servo_mux_frame_start + edge->offset_us);
+        if (deadline > (now_us + SERVO_MUX_SPIN_US)) {
+            TIM5_Set_Alarm(deadline);
+            return;
+        }
+        while (now_us < deadline) {
+            now_us = TIM5_Time_Get_Us();
+        }
+        edge->port->BSRR = edge->mask;
+        servo_mux_next_edge++;
+    }
+
+    //every pin is low until the next frame
+    servo_mux_in_frame     = 0;
+    servo_mux_next_edge    = 0;
+    servo_mux_frame_start += TIM1_SERVO_FRAME_US;
+    TIM5_Set_Alarm(servo_mux_frame_start);
+}
+
+/**
+ * @brief  Rebuilds the software pulse schedule from the staged pulse widths
+ * @note   Claiming the pending flag first stops the alarm swapping schedules, so the
+ *         inactive schedule is private until the flag is raised again. The new schedule is
+ *         taken at the next frame start, so a frame never mixes old and new edges
+ */
+static void Servo_Mux_Flush(void) {
+    ATOMIC_EXCHANGE(&servo_mux_pending, 0);
+    Servo_Mux_Schedule_t *schedule = &servo_mux_schedules[servo_mux_active ^ 1U];
+    schedule->rise_count = 0;
+    schedule->fall_count = 0;
+
+    for (uint8_t i = 0; i < servo_axis_count; i++) {
+        const Servo_Axis_t *axis = &servo_axes[i];
+        if (axis->backend != SERVO_BACKEND_GPIO_MUX || !axis->pulse_us) {
+            continue;
+        }
+
+        //merge the rising edge into its port
+        uint8_t j = 0;
+        while (j < schedule->rise_count && schedule->rise[j].port != axis->port) {
+            j++;
+        }
+        if (j == schedule->rise_count) {
+            schedule->rise[j].port = axis->port;
+            schedule->rise[j].mask = 0;
+            schedule->rise_count++;
+        }
+        schedule->rise[j].mask |= axis->pin_mask;
+
+        //merge the falling edge into an equal one, otherwise insert it in time order
+        uint32_t reset_mask = (axis->pin_mask << 16U);
+        j = 0;
+        while (j < schedule->fall_count && schedule->fall[j].offset_us < axis->pulse_us) {
+            j++;
+        }
+        uint8_t k = j;
+        while (k < schedule->fall_count && schedule->fall[k].offset_us == axis->pulse_us
+               && schedule->fall[k].port != axis->port) {
+            k++;
+        }
+        if (k < schedule->fall_count && schedule->fall[k].offset_us == axis->pulse_us) {
+            schedule->fall[k].mask |= reset_mask;
+            continue;
+        }
+        for (k = schedule->fall_count; k > j; k--) {
+            schedule->fall[k] = schedule->fall[k - 1U];
+        }
+        schedule->fall[j].port      = axis->port;
+        schedule->fall[j].mask      = reset_mask;
+        schedule->fall[j].offset_us = axis->pulse_us;
+        schedule->fall_count++;
+    }
+
+    DMB();
+    servo_mux_pending = 1U;
+}
+
+/**
+ * @brief  Applies staged pulse widths, touching each backend once
+ * @note   TIM1 compare registers are preloaded, so writes from one batch are latched together
+ *         at the next update event. Each expander is sent as one I2C frame however many of
+ *         its channels changed, and the software schedule is rebuilt once
+ * @note   Every pending expander is flushed, not only those changed by this batch, so a frame
+ *         refused because the bus was busy goes out on a later flush even if the same pulse
+ *         widths are set again
+ * @param  tim1_axes:  Changed TIM1 axes
+ * @param  tim1_count: Number of axes in the array
+ * @param  mux_dirty:  Nonzero if a software pulse axis changed
+ * @retval Status indicating success, or error if an expander was still busy with its
+ *         previous frame, in which case it stays pending for the next flush
+ */
+static Status Servo_Flush(const uint8_t *tim1_axes, uint8_t tim1_count, uint8_t mux_dirty) {
+    Status status = SUCCESS;
+
+    //write compare values back to back so they land in the same PWM frame
+    if (tim1_count) {
+        uint32_t primask = ENTER_CRITICAL();
+        for (uint8_t i = 0; i < tim1_count; i++) {
+            const Servo_Axis_t *axis = &servo_axes[tim1_axes[i]];
+            TIM1_Servo_Set_Pulse(axis->tim1_channel, axis->pulse_us);
+        }
+        EXIT_CRITICAL(primask);
+    }
+
+    if (mux_dirty) {
+        Servo_Mux_Flush();
+    }
+
+    for (uint8_t i = 0; i < servo_expander_count; i++) {
+        if (!servo_expander_pending[i]) {
+            continue;
+        }
+        if (PCA9685_Flush(servo_expanders[i]) == SUCCESS) {
+            servo_expander_pending[i] = 0;
+        } else {
+            status = ERROR;
+        }
+    }
+
+    return status;
+}
+
+
+/**********************************************************************************/
+/*                               Servo Core Functions                             */
+/**********************************************************************************/
+
+/**
+ * @brief  Registers a logical servo axis on one of the output backends
+ * @note   TIM1 axes assume the channel has been configured via @ref TIM1_Servo_Init, and
+ *         expander axes assume the device has been initialised via @ref PCA9685_Init.
+ *         Software pulse axes configure their pin as an output and are timed by the TIM5
+ *         alarm, so TIM5 must have been initialised via @ref TIM5_Time_Init and its alarm is
+ *         owned by this module from the first such axis
+ * @note   Without a calibration, TIM1 axes take the channel's calibration and other axes the
+ *         nominal 500us - 1500us - 2500us table. Outputs stay unchanged until the first set
+ * @param  config: Pointer to Servo_Axis_Config structure
+ * @param  axis:   Pointer to store the axis number used by the set functions
+ * @retval Status indicating success, invalid parameters, or error if the registry is full,
+ *         TIM5 is not running or its alarm is owned by another module
+ */
+Status Servo_Register(const Servo_Axis_Config_t *config, uint8_t *axis) {
+    //validate config and registry space
+    if (!config || !axis) {
+        return INVALID_PARAM;
+    }
+    if (servo_axis_count >= SERVO_MAX_AXES) {
+        return ERROR;
+    }
+
+    //validate backend target
+    switch (config->backend) {
+        case SERVO_BACKEND_TIM1:
+            if (Validate_TIM1_Channel(config->tim1_channel) != SUCCESS) {
+                return INVALID_PARAM;
+            }
+            break;
+        case SERVO_BACKEND_GPIO_MUX:
+            if (!config->port || config->pin > GPIO_PIN_15) {
+                return INVALID_PARAM;
+            }
+            if (!(RCC->APB1ENR & RCC_APB1ENR_TIM5EN)) {
+                return ERROR;
+            }
+            break;
+        case SERVO_BACKEND_PCA9685:
+            if (!config->expander || config->expander_channel >= PCA9685_CHANNEL_COUNT) {
+                return INVALID_PARAM;
+            }
+            break;
+        default:
+            return INVALID_PARAM;
+    }
+
+    //validate or default calibration
+    TIM1_Servo_Calibration_t calibration = config->calibration;
+    if (!calibration.max_pulse) {
+        if (config->backend == SERVO_BACKEND_TIM1) {
+            TIM1_Servo_Get_Calibration(config->tim1_channel, &calibration);
+        } else {
+            calibration.min_pulse    = TIM1_SERVO_DEFAULT_MIN_US;
+            calibration.centre_pulse = TIM1_SERVO_DEFAULT_CENTRE_US;
+            calibration.max_pulse    = TIM1_SERVO_DEFAULT_MAX_US;
+        }
+    }
+    if (calibration.min_pulse >= calibration.centre_pulse || calibration.centre_pulse >= calibration.max_pulse
+        || calibration.max_pulse >= TIM1_SERVO_FRAME_US) {
+        return INVALID_PARAM;
+    }
+
+    //find or add the expander, whose flush state is shared by all of its axes
+    uint8_t expander_index = 0;
+    if (config->backend == SERVO_BACKEND_PCA9685) {
+        while (expander_index < servo_expander_count && servo_expanders[expander_index] != config->expander) {
+            expander_index++;
+        }
+        if (expander_index == servo_expander_count) {
+            servo_expanders[expander_index]        = config->expander;
+            servo_expander_pending[expander_index] = 0;
+            servo_expander_count++;
+        }
+    }
+
+    //software pulse pins idle low between frames
+    if (config->backend == SERVO_BACKEND_GPIO_MUX) {
+        GPIO_Config_t pin_config = {
+            .port         = config->port,
+            .pin          = config->pin,
+            .mode         = GPIO_MODE_OUTPUT,
+            .output_type  = GPIO_OUTPUT_PUSH_PULL,
+            .output_speed = GPIO_OUTPUT_SPEED_MED
+        };
+        config->port->BSRR = SET_ONE << (config->pin + 16U);
+        if (GPIO_Init(&pin_config) != SUCCESS) {
+            return INVALID_PARAM;
+        }
+    }
+
+    //claim the alarm and start the software frame on the first software pulse axis
+    if (config->backend == SERVO_BACKEND_GPIO_MUX && !servo_mux_running) {
+        if (TIM5_Register_Alarm_Callback(Servo_Mux_Alarm) != SUCCESS) {
+            return ERROR;
+        }
+        servo_mux_running     = 1U;
+        servo_mux_in_frame    = 0;
+        servo_mux_next_edge   = 0;
+        servo_mux_frame_start = (TIM5_Time_Get_Us() + TIM1_SERVO_FRAME_US);
+        TIM5_Set_Alarm(servo_mux_frame_start);
+    }
+
+    Servo_Axis_t *entry     = &servo_axes[servo_axis_count];
+    entry->backend          = config->backend;
+    entry->tim1_channel     = config->tim1_channel;
+    entry->port             = config->port;
+    entry->pin_mask         = (config->backend == SERVO_BACKEND_GPIO_MUX) ? (SET_ONE << config->pin) : 0;
+    entry->expander         = config->expander;
+    entry->expander_channel = config->expander_channel;
+    entry->expander_index   = expander_index;
+    entry->calibration      = calibration;
+    entry->pulse_us         = 0;
+    *axis = servo_axis_count;
+    servo_axis_count++;
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Sets the pulse widths of several axes as one batch
+ * @note   The whole batch is validated before anything is staged, then each backend is
+ *         flushed once, so axes on the same backend move in the same frame. Expanders left
+ *         pending by an earlier refused flush are retried even if nothing in the batch changed
+ * @param  axes:      Array of axis numbers from @ref Servo_Register
+ * @param  pulses_us: Array of pulse widths in microseconds, one per axis, 0 for no pulse
+ * @param  count:     Number of axes in the arrays
+ * @retval Status indicating success, invalid parameters, or error if an expander frame was
+ *         skipped because its bus was busy
+ */
+Status Servo_Set_Pulses(const uint8_t *axes, const uint16_t *pulses_us, uint8_t count) {
+    //validate arrays
+    if (!axes || !pulses_us || !count) {
+        return INVALID_PARAM;
+    }
+    for (uint8_t i = 0; i < count; i++) {
+        if (axes[i] >= servo_axis_count || pulses_us[i] >= TIM1_SERVO_FRAME_US) {
+            return INVALID_PARAM;
+        }
+    }
+
+    //stage changed axes, collecting each backend that needs a flush
+    uint8_t tim1_axes[SERVO_MAX_AXES];
+    uint8_t tim1_count = 0;
+    uint8_t mux_dirty  = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        Servo_Axis_t *axis = &servo_axes[axes[i]];
+        if (axis->pulse_us == pulses_us[i]) {
+            continue;
+        }
+        axis->pulse_us = pulses_us[i];
+
+        switch (axis->backend) {
+            case SERVO_BACKEND_TIM1:
+                if (tim1_count < SERVO_MAX_AXES) {
+                    tim1_axes[tim1_count++] = axes[i];
+                }
+                break;
+            case SERVO_BACKEND_GPIO_MUX:
+                mux_dirty = 1U;
+                break;
+            case SERVO_BACKEND_PCA9685:
+                PCA9685_Set_Pulse_Width(axis->expander, axis->expander_channel, (float) axis->pulse_us);
+                servo_expander_pending[axis->expander_index] = 1U;
+                break;
+            default:
+                break;
+        }
+    }
+
+    return Servo_Flush(tim1_axes, tim1_count, mux_dirty);
+}
+
+/**
+ * @brief  Moves several axes as one batch using each axis's calibration table
+ * @note   0, 90 and 180 degrees map to the calibrated min, centre and max pulses, with linear
+ *         interpolation either side of centre, as @ref TIM1_Servo_Set_Position
+ * @param  axes:    Array of axis numbers from @ref Servo_Register
+ * @param  degrees: Array of target positions in degrees (0 - 180), one per axis
+ * @param  count:   Number of axes in the arrays
+ * @retval Status indicating success, invalid parameters, or error if an expander frame was
+ *         skipped because its bus was busy
+ */
+Status Servo_Set_Positions(const uint8_t *axes, const float *degrees, uint8_t count) {
+    //validate arrays
+    if (!axes || !degrees || !count || count > SERVO_MAX_AXES) {
+        return INVALID_PARAM;
+    }
+
+    //convert every position before staging any of them
+    uint16_t pulses_us[SERVO_MAX_AXES];
+    for (uint8_t i = 0; i < count; i++) {
+        if (axes[i] >= servo_axis_count || degrees[i] < 0 || degrees[i] > 180) {
+            return INVALID_PARAM;
+        }
+        pulses_us[i] = Servo_Degrees_To_Pulse(&servo_axes[axes[i]].calibration, degrees[i]);
+    }
+
+    return Servo_Set_Pulses(axes, pulses_us, count);
+}
+
+/**
+ * @brief  Moves a single axis using its calibration table
+ * @param  axis:    Axis number from @ref Servo_Register
+ * @param  degrees: Target position in degrees (0 - 180)
+ * @retval Status indicating success, invalid parameters, or error if an expander frame was
+ *         skipped because its bus was busy
+ */
+Status Servo_Set_Position(uint8_t axis, float degrees) {
+    return Servo_Set_Positions(&axis, &degrees, 1U);
+}
+
+/**
+ * @brief  Reads the last pulse width set on an axis
+ * @param  axis:     Axis number from @ref Servo_Register
+ * @param  pulse_us: Pointer to store the pulse width in microseconds, 0 if never set
+ * @retval Status indicating success or invalid parameters
+ */
+Status Servo_Get_Pulse(uint8_t axis, uint16_t *pulse_us) {
+    //validate axis and pulse pointer
+    if (axis >= servo_axis_count || !pulse_us) {
+        return INVALID_PARAM;
+    }
+
+    *pulse_us = servo_axes[axis].pulse_us;
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Reads the number of registered axes
+ * @retval Number of axes, which are numbered from 0
+ */
+uint8_t Servo_Get_Axis_Count(void) {
+    return servo_axis_count;
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+#ifndef __SERVO_H
+#define __SERVO_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../utils/utils.h"
+#include "../drivers/gpio/gpio.h"
+#include "../drivers/tim1/tim1.h"
+#include "../drivers/tim5/tim5.h"
+#include "../drivers/pca9685/pca9685.h"
+
+
+/**********************************************************************************/
+/*                                     Defines                                    */
+/**********************************************************************************/
+
+#ifndef SERVO_MAX_AXES
+#define SERVO_MAX_AXES              16U
+#endif
+
+/* software pulse edges closer together than this are released in one interrupt */
+#ifndef SERVO_MUX_SPIN_US
+#define SERVO_MUX_SPIN_US           3U
+#endif
+
+
+/**********************************************************************************/
+/*                                      Enums                                     */
+/**********************************************************************************/
+
+typedef enum {
+    SERVO_BACKEND_TIM1 = 0,
+    SERVO_BACKEND_GPIO_MUX,
+    SERVO_BACKEND_PCA9685
+} Servo_Backend;
+
+
+/**********************************************************************************/
+/*                              Configuration Structs                             */
+/**********************************************************************************/
+
+typedef struct {
+/************************************ Required ************************************/
+    Servo_Backend            backend;
+    TIM1_Channel             tim1_channel;          /* SERVO_BACKEND_TIM1 */
+    GPIO_t                   *port;                 /* SERVO_BACKEND_GPIO_MUX */
+    GPIO_Pin                 pin;
+    PCA9685_t                *expander;             /* SERVO_BACKEND_PCA9685 */
+    uint8_t                  expander_channel;
+/************************************ Optional ************************************/
+    TIM1_Servo_Calibration_t calibration;
+} Servo_Axis_Config_t;
+
+
+/**********************************************************************************/
+/*                               Function Prototypes                              */
+/**********************************************************************************/
+
+Status Servo_Register         (const Servo_Axis_Config_t *config, uint8_t *axis);
+Status Servo_Set_Positions    (const uint8_t *axes, const float *degrees, uint8_t count);
+Status Servo_Set_Pulses       (const uint8_t *axes, const uint16_t *pulses_us, uint8_t count);
+Status Servo_Set_Position     (uint8_t axis, float degrees);
+Status Servo_Get_Pulse        (uint8_t axis, uint16_t *pulse_us);
+uint8_t Servo_Get_Axis_Count  (void);
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,351 @@
+#include "storage.h"
+
+/**********************************************************************************/
+/*                                 Static Variables                               */
+/**********************************************************************************/
+
+static Storage_Index_Entry_t storage_index[STORAGE_MAX_KEYS] = {0};
+static uint8_t               storage_key_count               = 0;
+static FLASH_Sector          storage_active_sector;
+static uint32_t              storage_generation;
+static uint32_t              storage_write_address           = 0;
+static uint32_t              storage_end_address;
+static uint32_t              storage_buffer[(STORAGE_MAX_VALUE + 8U) / 4U];
+
+
+/**********************************************************************************/
+/*                                Static Functions                                */
+/**********************************************************************************/
+
+/**
+ * @brief  Rounds a value length up to a whole number of flash words
+ * @param  length: Value length in bytes
+ * @retval Padded length in bytes
+ */
+static uint32_t Storage_Pad(uint32_t length) {
+    return ((length + 3U) & ~(0x3UL));
+}
+
+/**
+ * @brief  Finds the index slot of a key
+ * @param  key: Key to be found
+ * @retval Index slot of the key, or STORAGE_MAX_KEYS if the key is not stored
+ */
+static uint8_t Storage_Find(uint16_t key) {
+    for (uint8_t i = 0; i < storage_key_count; i++) {
+        if (storage_index[i].key == key) {
+            return i;
+        }
+    }
+
+    return STORAGE_MAX_KEYS;
+}
+
+/**
+ * @brief  Points a key's index entry at a new record, or removes it for a deletion
+ * @param  key:     Key of the record
+ * @param  length:  Value length of the record, 0 for a deletion
+ * @param  address: Flash address of the record
+ * @retval Status indicating success, or error if the index is full
+ */
+static Status Storage_Index_Update(uint16_t key, uint16_t length, uint32_t address) {
+    uint8_t slot = Storage_Find(key);
+
+    //remove deleted key by moving the last entry into its slot
+    if (!length) {
+        if (slot != STORAGE_MAX_KEYS) {
+            storage_index[slot] = storage_index[--storage_key_count];
+        }
+        return SUCCESS;
+    }
+
+    if (slot == STORAGE_MAX_KEYS) {
+        if (storage_key_count >= STORAGE_MAX_KEYS) {
+            return ERROR;
+        }
+        slot = storage_key_count++;
+    }
+    storage_index[slot].key     = key;
+    storage_index[slot].length  = length;
+    storage_index[slot].address = address;
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Builds the index by walking the records of the active sector once
+ * @note   Each record is a header word (key and length), the value padded to a word, and a
+ *         CRC word written last as the commit marker. Records with a missing or bad CRC were
+ *         torn by power loss and are skipped. The walk stops at the first erased word, which
+ *         becomes the write address
+ */
+static void Storage_Build_Index(void) {
+    uint32_t start = FLASH_Get_Sector_Address(storage_active_sector);
+    storage_end_address = (start + FLASH_Get_Sector_Size(storage_active_sector));
+    storage_key_count   = 0;
+
+    uint32_t address = (start + sizeof(Storage_Sector_Header_t));
+    while ((address + 4U) <= storage_end_address) {
+        uint32_t header = *(const volatile uint32_t *) (uintptr_t) address;
+        if (header == FLASH_ERASED_WORD) {
+            break;
+        }
+
+        //a length beyond the maximum can only be corruption, so retire the rest of the sector
+        uint16_t key    = (uint16_t) (header & 0xFFFFUL);
+        uint16_t length = (uint16_t) (header >> 16U);
+        uint32_t padded = Storage_Pad(length);
+        if (length > STORAGE_MAX_VALUE || (address + 8U + padded) > storage_end_address) {
+            address = storage_end_address;
+            break;
+        }
+
+        uint32_t crc = *(const volatile uint32_t *) (uintptr_t) (address + 4U + padded);
+        if (crc == CRC_Calculate((const void *) (uintptr_t) address, (4U + padded))) {
+            Storage_Index_Update(key, length, address);
+        }
+        address += (8U + padded);
+    }
+    storage_write_address = address;
+}
+
+/**
+ * @brief  Appends a record to the active sector and commits it
+ * @param  key:    Key of the record
+ * @param  data:   Pointer to the value, may be NULL when length is 0
+ * @param  length: Value length in bytes, 0 for a deletion
+ * @retval Status indicating success, or error if the sector is full or flash failed
+ */
+static Status Storage_Append(uint16_t key, const void *data, uint16_t length) {
+    uint32_t padded = Storage_Pad(length);
+    if ((storage_write_address + 8U + padded) > storage_end_address) {
+        return ERROR;
+    }
+
+    //assemble header and padded value in RAM
+    uint8_t       *buffer = (uint8_t *) storage_buffer;
+    const uint8_t *source = (const uint8_t *) data;
+    storage_buffer[0] = (((uint32_t) length) << 16U) | key;
+    for (uint32_t i = 0; i < padded; i++) {
+        buffer[4U + i] = (i < length) ? source[i] : 0U;
+    }
+
+    //program record, then its CRC as the commit marker
+    uint32_t address = storage_write_address;
+    uint32_t crc     = CRC_Calculate(storage_buffer, (4U + padded));
+    storage_write_address += (8U + padded);
+    if (FLASH_Program(address, storage_buffer, (4U + padded)) != SUCCESS
+        || FLASH_Program((address + 4U + padded), &crc, 4U) != SUCCESS) {
+        return ERROR;
+    }
+
+    return Storage_Index_Update(key, length, address);
+}
+
+
+/**********************************************************************************/
+/*                             Storage Core Functions                             */
+/**********************************************************************************/
+
+/**
+ * @brief  Mounts the configuration store, formatting it if neither sector is valid
+ * @note   The store is a log of key/value records over two flash sectors. The active sector
+ *         is the valid one with the higher generation. Its records are walked once to build
+ *         a RAM index, after which reads and writes never scan flash
+ * @note   Must be called before any module that loads its configuration from the store
+ * @retval Status indicating success, or error if the store could not be formatted
+ */
+Status Storage_Init(void) {
+    const Storage_Sector_Header_t *header_a =
+        (const Storage_Sector_Header_t *) (uintptr_t) FLASH_Get_Sector_Address(STORAGE_SECTOR_A);
+    const Storage_Sector_Header_t *header_b =
+        (const Storage_Sector_Header_t *) (uintptr_t) FLASH_Get_Sector_Address(STORAGE_SECTOR_B);
+    uint8_t valid_a = (header_a->magic == STORAGE_MAGIC);
+    uint8_t valid_b = (header_b->magic == STORAGE_MAGIC);
+
+    if (valid_a && (!valid_b || (int32_t) (header_a->generation - header_b->generation) > 0)) {
+        storage_active_sector = STORAGE_SECTOR_A;
+        storage_generation    = header_a->generation;
+    } else if (valid_b) {
+        storage_active_sector = STORAGE_SECTOR_B;
+        storage_generation    = header_b->generation;
+    } else {
+        //format first sector
+        Storage_Sector_Header_t header = {STORAGE_MAGIC, 1U};
+        if (FLASH_Erase_Sector(STORAGE_SECTOR_A) != SUCCESS
+            || FLASH_Program(FLASH_Get_Sector_Address(STORAGE_SECTOR_A), &header, sizeof(header)) != SUCCESS) {
+            return ERROR;
+        }
+        storage_active_sector = STORAGE_SECTOR_A;
+        storage_generation    = header.generation;
+    }
+
+    Storage_Build_Index();
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Stores a value under a key, replacing any previous value
+ * @note   Writing a value identical to the stored one does not touch flash. When the active
+ *         sector is full it is compacted first; the erase stalls execution, see
+ *         @ref FLASH_Erase_Sector
+ * @param  key:    Key of the value, any value except STORAGE_KEY_INVALID
+ * @param  data:   Pointer to the value
+ * @param  length: Value length in bytes (1 - STORAGE_MAX_VALUE)
+ * @retval Status indicating success, invalid parameters, or error if flash is full or failed
+ */
+Status Storage_Write(uint16_t key, const void *data, uint16_t length) {
+    //validate mount, key, data and length
+    if (!storage_write_address || key == STORAGE_KEY_INVALID || !data || !length
+        || length > STORAGE_MAX_VALUE) {
+        return INVALID_PARAM;
+    }
+
+    //skip unchanged values to save wear
+    uint8_t slot = Storage_Find(key);
+    if (slot != STORAGE_MAX_KEYS && storage_index[slot].length == length) {
+        const uint8_t *stored = (const uint8_t *) (uintptr_t) (storage_index[slot].address + 4U);
+        const uint8_t *source = (const uint8_t *) data;
+        uint16_t i = 0;
+        while (i < length && stored[i] == source[i]) {
+            i++;
+        }
+        if (i == length) {
+            return SUCCESS;
+        }
+    }
+
+    //reject new keys once the index is full
+    if (slot == STORAGE_MAX_KEYS && storage_key_count >= STORAGE_MAX_KEYS) {
+        return ERROR;
+    }
+
+    //compact when the record does not fit
+    if ((storage_write_address + 8U + Storage_Pad(length)) > storage_end_address) {
+        if (Storage_Compact() != SUCCESS) {
+            return ERROR;
+        }
+    }
+
+    return Storage_Append(key, data, length);
+}
+
+/**
+ * @brief  Copies the value stored under a key
+ * @param  key:      Key of the value
+ * @param  data:     Pointer to store the value
+ * @param  capacity: Size of the destination in bytes
+ * @param  length:   Pointer to store the value length, may be NULL
+ * @retval Status indicating success, invalid parameters, or error if the key is not stored
+ */
+Status Storage_Read(uint16_t key, void *data, uint16_t capacity, uint16_t *length) {
+    //validate mount and data pointer
+    if (!storage_write_address || !data) {
+        return INVALID_PARAM;
+    }
+
+    uint8_t slot = Storage_Find(key);
+    if (slot == STORAGE_MAX_KEYS) {
+        return ERROR;
+    }
+
+    //validate destination size
+    Storage_Index_Entry_t *entry = &storage_index[slot];
+    if (capacity < entry->length) {
+        return INVALID_PARAM;
+    }
+
+    const uint8_t *stored      = (const uint8_t *) (uintptr_t) (entry->address + 4U);
+    uint8_t       *destination = (uint8_t *) data;
+    for (uint16_t i = 0; i < entry->length; i++) {
+        destination[i] = stored[i];
+    }
+    if (length) {
+        *length = entry->length;
+    }
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Removes a key from the store
+ * @param  key: Key to be removed
+ * @retval Status indicating success, invalid parameters, or error if flash is full or failed
+ */
+Status Storage_Delete(uint16_t key) {
+    //validate mount and key
+    if (!storage_write_address || key == STORAGE_KEY_INVALID) {
+        return INVALID_PARAM;
+    }
+
+    if (Storage_Find(key) == STORAGE_MAX_KEYS) {
+        return SUCCESS;
+    }
+
+    //deletions are zero length records
+    if ((storage_write_address + 8U) > storage_end_address) {
+        if (Storage_Compact() != SUCCESS) {
+            return ERROR;
+        }
+    }
+
+    return Storage_Append(key, 0, 0);
+}
+
+/**
+ * @brief  Copies the live record of every key into the inactive sector and switches to it
+ * @note   The new sector's header is written only after every record has been copied, so a
+ *         power loss part way through leaves the old sector active and intact
+ * @retval Status indicating success, or error if flash failed
+ */
+Status Storage_Compact(void) {
+    //validate mount
+    if (!storage_write_address) {
+        return ERROR;
+    }
+
+    FLASH_Sector target = (storage_active_sector == STORAGE_SECTOR_A) ? STORAGE_SECTOR_B : STORAGE_SECTOR_A;
+    uint32_t     start  = FLASH_Get_Sector_Address(target);
+    if (FLASH_Erase_Sector(target) != SUCCESS) {
+        return ERROR;
+    }
+
+    //copy the latest record of each key
+    uint32_t address = (start + sizeof(Storage_Sector_Header_t));
+    for (uint8_t i = 0; i < storage_key_count; i++) {
+        uint32_t size = (8U + Storage_Pad(storage_index[i].length));
+        if (FLASH_Program(address, (const void *) (uintptr_t) storage_index[i].address, size) != SUCCESS) {
+            return ERROR;
+        }
+        address += size;
+    }
+
+    //commit the new sector
+    Storage_Sector_Header_t header = {STORAGE_MAGIC, (storage_generation + 1U)};
+    if (FLASH_Program(start, &header, sizeof(header)) != SUCCESS) {
+        return ERROR;
+    }
+
+    //repoint index at the copied records
+    address = (start + sizeof(Storage_Sector_Header_t));
+    for (uint8_t i = 0; i < storage_key_count; i++) {
+        storage_index[i].address = address;
+        address += (8U + Storage_Pad(storage_index[i].length));
+    }
+
+    storage_active_sector = target;
+    storage_generation    = header.generation;
+    storage_write_address = address;
+    storage_end_address   = (start + FLASH_Get_Sector_Size(target));
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Returns the space left in the active sector before compaction is needed
+ * @retval Free space in bytes, including record overhead
+ */
+uint32_t Storage_Get_Free(void) {
+    return storage_write_address ? (storage_end_address - storage_write_address) : 0;
+}
\ No newline at end of file
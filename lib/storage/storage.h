@@ -0,0 +1,62 @@
+#ifndef __STORAGE_H
+#define __STORAGE_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../utils/utils.h"
+#include "../drivers/flash/flash.h"
+#include "../drivers/crc/crc.h"
+
+
+/**********************************************************************************/
+/*                                     Defines                                    */
+/**********************************************************************************/
+
+#define STORAGE_SECTOR_A                FLASH_SECTOR_6
+#define STORAGE_SECTOR_B                FLASH_SECTOR_7
+#define STORAGE_MAGIC                   0x524F5453UL
+#define STORAGE_MAX_KEYS                32U
+#define STORAGE_MAX_VALUE               256U
+
+/********************************** Reserved Keys *********************************/
+#define STORAGE_KEY_SERVO_CALIBRATION   0x0001U
+#define STORAGE_KEY_USART_BAUD          0x0002U
+#define STORAGE_KEY_MOTION_LIMITS       0x0003U
+#define STORAGE_KEY_INVALID             0xFFFFU
+
+
+/**********************************************************************************/
+/*                                     Structs                                    */
+/**********************************************************************************/
+
+typedef struct {
+    uint32_t magic;
+    uint32_t generation;
+} Storage_Sector_Header_t;
+
+typedef struct {
+    uint16_t key;
+    uint16_t length;
+    uint32_t address;
+} Storage_Index_Entry_t;
+
+
+/**********************************************************************************/
+/*                               Function Prototypes                              */
+/**********************************************************************************/
+
+Status   Storage_Init                (void);
+Status   Storage_Write               (uint16_t key, const void *data, uint16_t length);
+Status   Storage_Read                (uint16_t key, void *data, uint16_t capacity, uint16_t *length);
+Status   Storage_Delete              (uint16_t key);
+Status   Storage_Compact             (void);
+uint32_t Storage_Get_Free            (void);
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
\ No newline at end of file
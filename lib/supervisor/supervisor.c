@@ -0,0 +1,224 @@
+#include "supervisor.h"
+
+/**********************************************************************************/
+/*                                 Static Variables                               */
+/**********************************************************************************/
+
+static Supervisor_Config_t *supervisor_configs;
+static Supervisor_Axis_t   supervisor_axes[SUPERVISOR_MAX_AXES]   = {0};
+static Supervisor_Status_t supervisor_status[SUPERVISOR_MAX_AXES] = {0};
+static uint8_t             supervisor_axis_count                  = 0;
+static ADC_Callback_t      supervisor_next_callback;
+
+
+/**********************************************************************************/
+/*                                Static Functions                                */
+/**********************************************************************************/
+
+/**
+ * @brief  Checks every axis against its current limit once per ADC frame
+ * @note   Runs from the ADC DMA interrupt as soon as a frame of samples is averaged, so an
+ *         axis is disabled before the next PWM frame begins. Excess current above the limit
+ *         is integrated and headroom below it discharges the integrator, so short inrush
+ *         peaks pass while sustained overload trips
+ * @param  results:       Averaged ADC results of the frame
+ * @param  channel_count: Number of results in the frame
+ */
+static void Supervisor_Frame_Callback(const volatile uint16_t *results, uint8_t channel_count) {
+    for (uint8_t i = 0; i < supervisor_axis_count; i++) {
+        Supervisor_Axis_t   *axis   = &supervisor_axes[i];
+        Supervisor_Config_t *config = &supervisor_configs[i];
+        if (axis->current_index >= channel_count) {
+            continue;
+        }
+
+        uint16_t current = results[axis->current_index];
+        if (current > supervisor_status[i].peak_current) {
+            supervisor_status[i].peak_current = current;
+        }
+
+        //outputs stay off until cleared
+        if (axis->state == SUPERVISOR_STATE_TRIPPED) {
+            continue;
+        }
+
+        //re-enable output once the backoff period has elapsed
+        if (axis->state == SUPERVISOR_STATE_BACKOFF) {
+            if (--(axis->backoff_remaining) == 0) {
+                axis->accumulator = 0;
+                axis->stall_count = 0;
+                axis->state       = SUPERVISOR_STATE_OK;
+                TIM1->CCER       |= axis->ccer_enable;
+            }
+            continue;
+        }
+
+        //integrate excess current and discharge with headroom
+        if (current > axis->current_limit) {
+            axis->accumulator += (current - axis->current_limit);
+        } else {
+            uint32_t headroom = (axis->current_limit - current);
+            axis->accumulator = (axis->accumulator > headroom) ? (axis->accumulator - headroom) : 0;
+        }
+        uint8_t overcurrent = (axis->accumulator >= axis->trip_level);
+
+        //a stall is sustained overcurrent with no measurable motion
+        uint8_t stall = 0;
+        if (config->stall_detection == SUPERVISOR_STALL_DETECTION_ENABLED
+            && config->feedback_index < channel_count) {
+            uint16_t feedback = results[config->feedback_index];
+            uint16_t motion   = (feedback > axis->prev_feedback) ? (feedback - axis->prev_feedback)
+                                                                 : (axis->prev_feedback - feedback);
+            axis->prev_feedback = feedback;
+            if (current > axis->current_limit && motion <= (config->stall_motion ? config->stall_motion : 8U)) {
+                axis->stall_count++;
+            } else {
+                axis->stall_count = 0;
+            }
+            stall = (axis->stall_count >= (config->stall_frames ? config->stall_frames : 5U));
+        }
+
+        if (!overcurrent && !stall) {
+            continue;
+        }
+
+        //disable channel output
+        TIM1->CCER &= ~(axis->ccer_enable);
+        if (stall) {
+            supervisor_status[i].stall_events++;
+        } else {
+            supervisor_status[i].overcurrent_events++;
+        }
+
+        if (config->action == SUPERVISOR_ACTION_BACKOFF) {
+            axis->backoff_remaining = config->backoff_frames ? config->backoff_frames : 50U;
+            axis->state             = SUPERVISOR_STATE_BACKOFF;
+        } else {
+            axis->state             = SUPERVISOR_STATE_TRIPPED;
+        }
+    }
+
+    //pass frame on to previously registered callback
+    if (supervisor_next_callback) {
+        supervisor_next_callback(results, channel_count);
+    }
+}
+
+
+/**********************************************************************************/
+/*                           Supervisor Core Functions                            */
+/**********************************************************************************/
+
+/**
+ * @brief  Initialises current limiting and stall detection for a set of servo axes
+ * @note   Assumes the ADC has been configured via @ref ADC_Init with a TIM1 trigger. The
+ *         supervisor chains itself in front of any ADC frame callback already registered
+ * @note   current_limit is in ADC counts and trip_level is in count-frames of integrated
+ *         excess current. A tripped axis has its TIM1 CCxE bit cleared; with
+ *         SUPERVISOR_ACTION_BACKOFF it is re-enabled automatically after backoff_frames
+ *         frames (default 50), otherwise it stays off until @ref Supervisor_Clear
+ * @note   Stall detection counts frames over current_limit in which feedback moves by no
+ *         more than stall_motion ADC counts (default 8, as ADC noise alone exceeds 0), and
+ *         trips after stall_frames of them in a row (default 5)
+ * @param  configs:    Array of Supervisor_Config structures, one per axis
+ * @param  axis_count: Number of axes in the array
+ * @retval Status indicating success, invalid parameters, or error if the ADC is not ready
+ */
+Status Supervisor_Init(Supervisor_Config_t *configs, uint8_t axis_count) {
+    //validate config array
+    if (!configs || axis_count < 1 || axis_count > SUPERVISOR_MAX_AXES) {
+        return INVALID_PARAM;
+    }
+
+    //validate axes
+    for (uint8_t i = 0; i < axis_count; i++) {
+        Supervisor_Config_t *config = &configs[i];
+        if (Validate_TIM1_Channel(config->channel) != SUCCESS || !(config->current_limit)
+            || !(config->trip_level) || config->action < SUPERVISOR_ACTION_DISABLE
+            || config->action > SUPERVISOR_ACTION_BACKOFF
+            || config->stall_detection < SUPERVISOR_STALL_DETECTION_DISABLED
+            || config->stall_detection > SUPERVISOR_STALL_DETECTION_ENABLED) {
+            return INVALID_PARAM;
+        }
+    }
+
+    //build per-axis state
+    for (uint8_t i = 0; i < axis_count; i++) {
+        Supervisor_Config_t *config = &configs[i];
+        Supervisor_Axis_t   *axis   = &supervisor_axes[i];
+
+        axis->accumulator       = 0;
+        axis->trip_level        = config->trip_level;
+        axis->ccer_enable       = (TIM_CCER_CC1E << ((config->channel - TIM1_CHANNEL_1) * 4U));
+        axis->current_limit     = config->current_limit;
+        axis->backoff_remaining = 0;
+        axis->prev_feedback     = 0;
+        axis->stall_count       = 0;
+        axis->current_index     = config->current_index;
+        axis->state             = SUPERVISOR_STATE_OK;
+
+        supervisor_status[i].state              = SUPERVISOR_STATE_OK;
+        supervisor_status[i].overcurrent_events = 0;
+        supervisor_status[i].stall_events       = 0;
+        supervisor_status[i].peak_current       = 0;
+    }
+    supervisor_configs    = configs;
+    supervisor_axis_count = axis_count;
+
+    //insert supervisor into the ADC frame callback chain
+    ADC_Callback_t current_callback = ADC_Get_Callback();
+    if (current_callback != Supervisor_Frame_Callback) {
+        supervisor_next_callback = current_callback;
+    }
+    if (ADC_Register_Callback(Supervisor_Frame_Callback) != SUCCESS) {
+        return ERROR;
+    }
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Copies the state and event counters of an axis
+ * @param  axis:   Index of the axis in the array passed to @ref Supervisor_Init
+ * @param  status: Pointer to Supervisor_Status structure to be filled
+ * @retval Status indicating success or invalid parameters
+ */
+Status Supervisor_Get_Status(uint8_t axis, Supervisor_Status_t *status) {
+    //validate axis and status struct pointer
+    if (axis >= supervisor_axis_count || !status) {
+        return INVALID_PARAM;
+    }
+
+    uint32_t primask = ENTER_CRITICAL();
+    *status       = supervisor_status[axis];
+    status->state = (Supervisor_State) supervisor_axes[axis].state;
+    EXIT_CRITICAL(primask);
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Re-enables a tripped or backed off axis and resets its filters
+ * @note   Event counters and the peak current are kept for diagnostics
+ * @param  axis: Index of the axis in the array passed to @ref Supervisor_Init
+ * @retval Status indicating success or invalid parameters
+ */
+Status Supervisor_Clear(uint8_t axis) {
+    //validate axis
+    if (axis >= supervisor_axis_count) {
+        return INVALID_PARAM;
+    }
+
+    uint32_t primask = ENTER_CRITICAL();
+    Supervisor_Axis_t *state = &supervisor_axes[axis];
+    if (state->state != SUPERVISOR_STATE_OK) {
+        state->accumulator       = 0;
+        state->stall_count       = 0;
+        state->backoff_remaining = 0;
+        state->state             = SUPERVISOR_STATE_OK;
+        TIM1->CCER              |= state->ccer_enable;
+    }
+    EXIT_CRITICAL(primask);
+
+    return SUCCESS;
+}
\ No newline at end of file
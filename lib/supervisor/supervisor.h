@@ -0,0 +1,93 @@
+#ifndef __SUPERVISOR_H
+#define __SUPERVISOR_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../utils/utils.h"
+#include "../drivers/tim1/tim1.h"
+#include "../drivers/adc/adc.h"
+
+
+/**********************************************************************************/
+/*                                     Defines                                    */
+/**********************************************************************************/
+
+#define SUPERVISOR_MAX_AXES     4U
+
+
+/**********************************************************************************/
+/*                                      Enums                                     */
+/**********************************************************************************/
+
+typedef enum {
+    SUPERVISOR_ACTION_DISABLE = 0,
+    SUPERVISOR_ACTION_BACKOFF
+} Supervisor_Action;
+
+typedef enum {
+    SUPERVISOR_STALL_DETECTION_DISABLED = 0,
+    SUPERVISOR_STALL_DETECTION_ENABLED
+} Supervisor_Stall_Detection;
+
+typedef enum {
+    SUPERVISOR_STATE_OK = 0,
+    SUPERVISOR_STATE_BACKOFF,
+    SUPERVISOR_STATE_TRIPPED
+} Supervisor_State;
+
+
+/**********************************************************************************/
+/*                              Configuration Structs                             */
+/**********************************************************************************/
+
+typedef struct {
+/************************************ Required ************************************/
+    TIM1_Channel               channel;
+    uint8_t                    current_index;
+    uint16_t                   current_limit;
+    uint32_t                   trip_level;
+/************************************ Optional ************************************/
+    Supervisor_Action          action;
+    uint16_t                   backoff_frames;
+    Supervisor_Stall_Detection stall_detection;
+    uint8_t                    feedback_index;
+    uint16_t                   stall_motion;
+    uint16_t                   stall_frames;
+} Supervisor_Config_t;
+
+typedef struct {
+    Supervisor_State state;
+    uint32_t         overcurrent_events;
+    uint32_t         stall_events;
+    uint16_t         peak_current;
+} Supervisor_Status_t;
+
+typedef struct {
+    uint32_t         accumulator;
+    uint32_t         trip_level;
+    uint32_t         ccer_enable;
+    uint16_t         current_limit;
+    uint16_t         backoff_remaining;
+    uint16_t         prev_feedback;
+    uint16_t         stall_count;
+    uint8_t          current_index;
+    volatile uint8_t state;
+} Supervisor_Axis_t;
+
+
+/**********************************************************************************/
+/*                               Function Prototypes                              */
+/**********************************************************************************/
+
+Status Supervisor_Init           (Supervisor_Config_t *supervisor_configs, uint8_t axis_count);
+Status Supervisor_Get_Status     (uint8_t axis, Supervisor_Status_t *status);
+Status Supervisor_Clear          (uint8_t axis);
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
\ No newline at end of file
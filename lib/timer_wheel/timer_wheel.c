@@ -0,0 +1,312 @@
+#include "timer_wheel.h"
+
+/**********************************************************************************/
+/*                                     Structs                                    */
+/**********************************************************************************/
+
+typedef enum {
+    TIMER_WHEEL_NODE_FREE = 0,
+    TIMER_WHEEL_NODE_QUEUED,
+    TIMER_WHEEL_NODE_RUNNING,
+    TIMER_WHEEL_NODE_CANCELLED
+} Timer_Wheel_Node_State;
+
+typedef struct Timer_Wheel_Node {
+    struct Timer_Wheel_Node  *next;
+    struct Timer_Wheel_Node **pprev;
+    uint32_t                 expiry;
+    uint32_t                 period;
+    Timer_Wheel_Callback_t   callback;
+    void                     *context;
+    uint16_t                 generation;
+    uint8_t                  state;
+} Timer_Wheel_Node_t;
+
+
+/**********************************************************************************/
+/*                                 Static Variables                               */
+/**********************************************************************************/
+
+static Timer_Wheel_Node_t  wheel_pool[TIMER_WHEEL_POOL_SIZE];
+static Timer_Wheel_Node_t  *wheel_slots[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];
+static Timer_Wheel_Node_t  *wheel_free;
+static uint32_t            wheel_time;
+static uint32_t            wheel_active;
+static volatile uint32_t   wheel_posted;
+
+
+/**********************************************************************************/
+/*                                Static Functions                                */
+/**********************************************************************************/
+
+/**
+ * @brief  Removes a timer from the slot list it is queued in
+ * @note   Called inside a critical section
+ * @param  node: Pointer to the timer node
+ */
+static void Timer_Wheel_Unlink(Timer_Wheel_Node_t *node) {
+    *(node->pprev) = node->next;
+    if (node->next) {
+        node->next->pprev = node->pprev;
+    }
+}
+
+/**
+ * @brief  Queues a timer in the slot matching its expiry relative to the wheel time
+ * @note   Called inside a critical section. Each level covers TIMER_WHEEL_SLOT_BITS more bits
+ *         of the remaining time than the one below it. Timers beyond the top level are parked
+ *         in its furthest slot and placed again when that slot comes round
+ * @param  node: Pointer to the timer node
+ */
+static void Timer_Wheel_Insert(Timer_Wheel_Node_t *node) {
+    uint32_t delta = (node->expiry - wheel_time);
+    uint32_t level = 0;
+    while (level < (TIMER_WHEEL_LEVELS - 1U) && delta >= (1UL << (TIMER_WHEEL_SLOT_BITS * (level + 1U)))) {
+        level++;
+    }
+
+    uint32_t shift = (TIMER_WHEEL_SLOT_BITS * level);
+    uint32_t slot  = ((node->expiry >> shift) & TIMER_WHEEL_SLOT_MASK);
+    if (delta >= (1UL << (TIMER_WHEEL_SLOT_BITS * TIMER_WHEEL_LEVELS))) {
+        slot = (((wheel_time >> shift) - 1UL) & TIMER_WHEEL_SLOT_MASK);
+    }
+
+    Timer_Wheel_Node_t **head = &wheel_slots[level][slot];
+    node->next  = *head;
+    node->pprev = head;
+    if (*head) {
+        (*head)->pprev = &node->next;
+    }
+    *head = node;
+}
+
+/**
+ * @brief  Returns a timer node to the pool
+ * @note   Called inside a critical section. Bumping the generation invalidates old handles
+ * @param  node: Pointer to the timer node
+ */
+static void Timer_Wheel_Free(Timer_Wheel_Node_t *node) {
+    node->state = TIMER_WHEEL_NODE_FREE;
+    node->generation++;
+    node->next  = wheel_free;
+    wheel_free  = node;
+    wheel_active--;
+}
+
+/**
+ * @brief  Moves every timer in the current slot of a level down to the levels below
+ * @note   One timer is moved per critical section, so interrupts are held off for O(1)
+ * @param  level: Wheel level whose lower bits have just wrapped
+ */
+static void Timer_Wheel_Cascade(uint32_t level) {
+    while (1) {
+        uint32_t primask = ENTER_CRITICAL();
+        uint32_t slot    = ((wheel_time >> (TIMER_WHEEL_SLOT_BITS * level)) & TIMER_WHEEL_SLOT_MASK);
+        Timer_Wheel_Node_t *node = wheel_slots[level][slot];
+        if (!node) {
+            EXIT_CRITICAL(primask);
+            return;
+        }
+        Timer_Wheel_Unlink(node);
+        Timer_Wheel_Insert(node);
+        EXIT_CRITICAL(primask);
+    }
+}
+
+/**
+ * @brief  Advances the wheel to the Systick time, running every timer that falls due
+ * @note   Runs as deferred work in PendSV, below every other interrupt. Callbacks run outside
+ *         the critical section. Periodic timers are queued again from their previous expiry,
+ *         so they do not drift with dispatch latency
+ * @param  argument: Unused
+ */
+static void Timer_Wheel_Dispatch(uint32_t argument) {
+    (void) argument;
+
+    //ticks from here on post a new dispatch
+    wheel_posted = 0;
+
+    while (1) {
+        uint32_t primask = ENTER_CRITICAL();
+        if (wheel_time == g_systick_time) {
+            EXIT_CRITICAL(primask);
+            return;
+        }
+        uint32_t now = ++wheel_time;
+        EXIT_CRITICAL(primask);
+
+        //cascade the levels whose lower bits have wrapped, highest first
+        uint32_t level = 1U;
+        while (level < TIMER_WHEEL_LEVELS && !(now & ((1UL << (TIMER_WHEEL_SLOT_BITS * level)) - 1UL))) {
+            level++;
+        }
+        for (; level > 1U; level--) {
+            Timer_Wheel_Cascade(level - 1U);
+        }
+
+        //run the timers due this tick
+        while (1) {
+            primask = ENTER_CRITICAL();
+            Timer_Wheel_Node_t *node = wheel_slots[0][wheel_time & TIMER_WHEEL_SLOT_MASK];
+            if (!node) {
+                EXIT_CRITICAL(primask);
+                break;
+            }
+            Timer_Wheel_Unlink(node);
+            node->state = TIMER_WHEEL_NODE_RUNNING;
+            EXIT_CRITICAL(primask);
+
+            node->callback(node->context);
+
+            primask = ENTER_CRITICAL();
+            if (node->state == TIMER_WHEEL_NODE_RUNNING && node->period) {
+                node->state   = TIMER_WHEEL_NODE_QUEUED;
+                node->expiry += node->period;
+                Timer_Wheel_Insert(node);
+            } else {
+                Timer_Wheel_Free(node);
+            }
+            EXIT_CRITICAL(primask);
+        }
+    }
+}
+
+/**
+ * @brief  Posts a dispatch on Systick interrupts while timers are active
+ * @note   At most one dispatch is queued at a time, ticks that arrive before it runs are
+ *         caught up by its loop
+ */
+static void Timer_Wheel_Tick(void) {
+    if (wheel_active && !ATOMIC_EXCHANGE(&wheel_posted, 1U)) {
+        if (Deferred_Post(Timer_Wheel_Dispatch, 0) != SUCCESS) {
+            wheel_posted = 0;
+        }
+    }
+}
+
+
+/**********************************************************************************/
+/*                           Timer Wheel Core Functions                           */
+/**********************************************************************************/
+
+/**
+ * @brief  Initialises the timer pool and hooks the wheel onto Systick and the deferred queue
+ * @note   Assumes Systick has been configured as a time base via @ref Systick_Init, whose
+ *         period becomes the wheel tick. Claims the Systick callback, and dispatches expired
+ *         timers through @ref Deferred_Post
+ * @retval Status indicating success, or error if PendSV is owned by another module
+ */
+Status Timer_Wheel_Init(void) {
+    //timers are dispatched from PendSV at the lowest priority
+    if (Deferred_Init() != SUCCESS) {
+        return ERROR;
+    }
+
+    //build the free list and empty the wheel
+    uint32_t primask = ENTER_CRITICAL();
+    wheel_free = 0;
+    for (uint32_t i = TIMER_WHEEL_POOL_SIZE; i > 0; i--) {
+        wheel_pool[i - 1U].state = TIMER_WHEEL_NODE_FREE;
+        wheel_pool[i - 1U].next  = wheel_free;
+        wheel_free = &wheel_pool[i - 1U];
+    }
+    for (uint32_t level = 0; level < TIMER_WHEEL_LEVELS; level++) {
+        for (uint32_t slot = 0; slot < TIMER_WHEEL_SLOTS; slot++) {
+            wheel_slots[level][slot] = 0;
+        }
+    }
+    wheel_time   = g_systick_time;
+    wheel_active = 0;
+    wheel_posted = 0;
+    EXIT_CRITICAL(primask);
+
+    return Systick_Register_Callback(Timer_Wheel_Tick);
+}
+
+/**
+ * @brief  Starts a one-shot or periodic software timer
+ * @note   O(1), and callable from any interrupt. The callback runs from PendSV
+ * @param  delay_ticks:  Ticks until the first expiry, a delay of 0 expires on the next tick
+ * @param  period_ticks: Ticks between later expiries, or 0 for a one-shot timer
+ * @param  callback:     Function called on expiry
+ * @param  context:      Argument passed to the callback
+ * @param  handle:       Pointer to store the handle used to cancel the timer, may be NULL
+ * @retval Status indicating success, invalid parameters, or error if the pool is empty
+ */
+Status Timer_Wheel_Start(uint32_t delay_ticks, uint32_t period_ticks, Timer_Wheel_Callback_t callback,
+                         void *context, Timer_Wheel_Handle_t *handle) {
+    //validate callback and times, which must stay within half the tick counter range
+    if (!callback || delay_ticks >= 0x80000000UL || period_ticks >= 0x80000000UL) {
+        return INVALID_PARAM;
+    }
+
+    uint32_t primask = ENTER_CRITICAL();
+    Timer_Wheel_Node_t *node = wheel_free;
+    if (!node) {
+        EXIT_CRITICAL(primask);
+        return ERROR;
+    }
+    wheel_free = node->next;
+
+    //an idle wheel has not followed Systick, bring it up to date
+    if (!wheel_active) {
+        wheel_time = g_systick_time;
+    }
+    wheel_active++;
+
+    node->state    = TIMER_WHEEL_NODE_QUEUED;
+    node->expiry   = (g_systick_time + (delay_ticks ? delay_ticks : 1UL));
+    node->period   = period_ticks;
+    node->callback = callback;
+    node->context  = context;
+    Timer_Wheel_Insert(node);
+
+    if (handle) {
+        *handle = ((((uint32_t) node->generation) << 16U) | ((uint32_t) (node - wheel_pool) + 1UL));
+    }
+    EXIT_CRITICAL(primask);
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Stops a timer and returns it to the pool
+ * @note   O(1), and callable from any interrupt or from the timer's own callback
+ * @param  handle: Handle from @ref Timer_Wheel_Start
+ * @retval Status indicating success, invalid parameters, or error if the timer has already
+ *         expired or been cancelled
+ */
+Status Timer_Wheel_Cancel(Timer_Wheel_Handle_t handle) {
+    //validate handle
+    uint32_t index = ((handle & 0xFFFFUL) - 1UL);
+    if (index >= TIMER_WHEEL_POOL_SIZE) {
+        return INVALID_PARAM;
+    }
+
+    Timer_Wheel_Node_t *node = &wheel_pool[index];
+    Status status = SUCCESS;
+
+    uint32_t primask = ENTER_CRITICAL();
+    if (node->generation != (uint16_t) (handle >> 16U)) {
+        status = ERROR;
+    } else if (node->state == TIMER_WHEEL_NODE_QUEUED) {
+        Timer_Wheel_Unlink(node);
+        Timer_Wheel_Free(node);
+    } else if (node->state == TIMER_WHEEL_NODE_RUNNING) {
+        node->state = TIMER_WHEEL_NODE_CANCELLED;
+    } else {
+        status = ERROR;
+    }
+    EXIT_CRITICAL(primask);
+
+    return status;
+}
+
+/**
+ * @brief  Reads the number of timers that can still be started
+ * @retval Number of free timer nodes
+ */
+uint32_t Timer_Wheel_Get_Free(void) {
+    return (TIMER_WHEEL_POOL_SIZE - wheel_active);
+}
+
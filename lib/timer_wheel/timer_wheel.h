@@ -0,0 +1,50 @@
+#ifndef __TIMER_WHEEL_H
+#define __TIMER_WHEEL_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../utils/utils.h"
+
+
+/**********************************************************************************/
+/*                                     Defines                                    */
+/**********************************************************************************/
+
+#ifndef TIMER_WHEEL_POOL_SIZE
+#define TIMER_WHEEL_POOL_SIZE       256U
+#endif
+
+#define TIMER_WHEEL_LEVELS          4U
+#define TIMER_WHEEL_SLOT_BITS       6U
+#define TIMER_WHEEL_SLOTS           (1UL << TIMER_WHEEL_SLOT_BITS)
+#define TIMER_WHEEL_SLOT_MASK       (TIMER_WHEEL_SLOTS - 1UL)
+#define TIMER_WHEEL_INVALID_HANDLE  0UL
+
+
+/**********************************************************************************/
+/*                                 Callback Types                                 */
+/**********************************************************************************/
+
+typedef void (*Timer_Wheel_Callback_t)(void *context);
+
+typedef uint32_t Timer_Wheel_Handle_t;
+
+
+/**********************************************************************************/
+/*                               Function Prototypes                              */
+/**********************************************************************************/
+
+Status   Timer_Wheel_Init            (void);
+Status   Timer_Wheel_Start           (uint32_t delay_ticks, uint32_t period_ticks, Timer_Wheel_Callback_t callback,
+                                      void *context, Timer_Wheel_Handle_t *handle);
+Status   Timer_Wheel_Cancel          (Timer_Wheel_Handle_t handle);
+uint32_t Timer_Wheel_Get_Free        (void);
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
\ No newline at end of file
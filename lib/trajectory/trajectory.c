@@ -0,0 +1,501 @@
+#include "trajectory.h"
+
+#if (TRAJECTORY_MAX_AXES > INTERPOLATION_MAX_AXES)
+#error "TRAJECTORY_MAX_AXES must not exceed INTERPOLATION_MAX_AXES"
+#endif
+
+/**********************************************************************************/
+/*                                 Static Variables                               */
+/**********************************************************************************/
+
+static Trajectory_Config_t  *trajectory_config;
+
+/* sample FIFO, filled from received frames and drained by playback */
+static Trajectory_Sample_t  trajectory_fifo[TRAJECTORY_DEPTH];
+static uint8_t              trajectory_head         = 0;
+static uint8_t              trajectory_tail         = 0;
+static volatile uint8_t     trajectory_count        = 0;
+static uint8_t              trajectory_end_received = 0;
+
+/* playback clock, advanced by whole PWM frames */
+static volatile uint32_t    trajectory_state        = TRAJECTORY_IDLE;
+static uint64_t             trajectory_time_us      = 0;
+static uint32_t             trajectory_last_frame   = 0;
+static volatile uint32_t    trajectory_underruns    = 0;
+
+/* spline segment between the two oldest samples, and the sample played before them */
+static Interpolation_t      trajectory_interpolation;
+static Trajectory_Sample_t  trajectory_previous;
+static uint8_t              trajectory_has_previous = 0;
+static uint8_t              trajectory_segment_set  = 0;
+static uint8_t              trajectory_segment_open = 0;
+
+/* flow control: the host may send samples up to, not including, the credit limit */
+static uint8_t              trajectory_expected     = 0;
+static uint8_t              trajectory_reported     = 0;
+static uint8_t              trajectory_rejected     = 0;
+static uint8_t              trajectory_resync       = 0;
+static uint8_t              trajectory_report_due   = 0;
+
+static uint8_t              trajectory_rx_ring[TRAJECTORY_RX_RING_SIZE];
+static uint8_t              trajectory_rx_frame[TRAJECTORY_FRAME_SIZE];
+static uint8_t              trajectory_rx_offset    = 0;
+static uint8_t              trajectory_report[TRAJECTORY_REPORT_SIZE];
+
+
+/**********************************************************************************/
+/*                                Static Functions                                */
+/**********************************************************************************/
+
+static uint16_t Trajectory_Checksum(const uint8_t *data, uint16_t length) {
+    uint16_t sum_1 = 0;
+    uint16_t sum_2 = 0;
+    for (uint16_t i = 0; i < length; i++) {
+        sum_1 = (uint16_t) ((sum_1 + data[i]) % 255U);
+        sum_2 = (uint16_t) ((sum_2 + sum_1) % 255U);
+    }
+
+    return (uint16_t) ((sum_2 << 8U) | sum_1);
+}
+
+static uint8_t Trajectory_Credit_Limit(void) {
+    uint8_t target = trajectory_config->target_fill;
+    uint8_t room   = (trajectory_count < target) ? (uint8_t) (target - trajectory_count) : 0;
+
+    return (uint8_t) (trajectory_expected + room);
+}
+
+/**
+ * @brief  Sends the flow control report, or marks it due if the transmitter is busy
+ * @note   The report carries the absolute credit limit rather than a credit count, so a lost
+ *         report or frame never leaks credits: the next report restores the host's window
+ */
+static void Trajectory_Send_Report(void) {
+    USART_t *instance = trajectory_config->usart->instance;
+    if (USART_Get_TX_Status(instance) != USART_IDLE) {
+        trajectory_report_due = 1U;
+        return;
+    }
+    trajectory_report_due = 0;
+
+    uint32_t underruns = trajectory_underruns;
+    uint32_t time_ms   = (uint32_t) (trajectory_time_us / 1000U);
+    trajectory_reported = Trajectory_Credit_Limit();
+
+    trajectory_report[0]  = TRAJECTORY_SYNC;
+    trajectory_report[1]  = TRAJECTORY_FRAME_REPORT;
+    trajectory_report[2]  = trajectory_reported;
+    trajectory_report[3]  = (uint8_t) trajectory_state;
+    trajectory_report[4]  = trajectory_expected;
+    trajectory_report[5]  = trajectory_rejected;
+    trajectory_report[6]  = (uint8_t) ((underruns > 0xFFFFU) ? 0xFFU : (underruns & 0xFFU));
+    trajectory_report[7]  = (uint8_t) ((underruns > 0xFFFFU) ? 0xFFU : ((underruns >> 8U) & 0xFFU));
+    trajectory_report[8]  = (uint8_t) (time_ms & 0xFFU);
+    trajectory_report[9]  = (uint8_t) ((time_ms >> 8U) & 0xFFU);
+    trajectory_report[10] = (uint8_t) ((time_ms >> 16U) & 0xFFU);
+    trajectory_report[11] = (uint8_t) ((time_ms >> 24U) & 0xFFU);
+
+    uint16_t checksum = Trajectory_Checksum(trajectory_report, (TRAJECTORY_REPORT_SIZE - 2U));
+    trajectory_report[12] = (uint8_t) (checksum & 0xFFU);
+    trajectory_report[13] = (uint8_t) (checksum >> 8U);
+
+    if (USART_Transmit(trajectory_config->usart, trajectory_report, TRAJECTORY_REPORT_SIZE) != SUCCESS) {
+        trajectory_report_due = 1U;
+    }
+}
+
+static void Trajectory_Reset(void) {
+    trajectory_head         = 0;
+    trajectory_tail         = 0;
+    trajectory_count        = 0;
+    trajectory_end_received = 0;
+    trajectory_expected     = 0;
+    trajectory_resync       = 0;
+    trajectory_time_us      = 0;
+    trajectory_has_previous = 0;
+    trajectory_segment_set  = 0;
+    trajectory_segment_open = 0;
+    trajectory_state        = TRAJECTORY_IDLE;
+}
+
+static void Trajectory_Push(const uint8_t *frame, uint8_t last) {
+    Trajectory_Sample_t *sample = &trajectory_fifo[trajectory_head];
+    sample->time_ms = ((uint32_t) frame[4] | ((uint32_t) frame[5] << 8U)
+                       | ((uint32_t) frame[6] << 16U) | ((uint32_t) frame[7] << 24U));
+    for (uint8_t axis = 0; axis < trajectory_config->axis_count; axis++) {
+        sample->positions[axis] = (uint16_t) (frame[8U + (axis * 2U)] | (frame[9U + (axis * 2U)] << 8U));
+    }
+    sample->last = last;
+
+    trajectory_head = (uint8_t) ((trajectory_head + 1U) % TRAJECTORY_DEPTH);
+    trajectory_count++;
+}
+
+static void Trajectory_Handle_Sample(const uint8_t *frame) {
+    //go-back-N: after a gap everything is dropped until the expected sample is resent
+    if (frame[2] != trajectory_expected || trajectory_count >= TRAJECTORY_DEPTH) {
+        if (trajectory_rejected < 0xFFU) {
+            trajectory_rejected++;
+        }
+        if (!trajectory_resync) {
+            trajectory_resync = 1U;
+            Trajectory_Send_Report();
+        }
+        return;
+    }
+
+    //validate positions
+    for (uint8_t axis = 0; axis < trajectory_config->axis_count; axis++) {
+        if ((uint16_t) (frame[8U + (axis * 2U)] | (frame[9U + (axis * 2U)] << 8U)) > 18000U) {
+            if (trajectory_rejected < 0xFFU) {
+                trajectory_rejected++;
+            }
+            Trajectory_Send_Report();
+            return;
+        }
+    }
+
+    trajectory_resync = 0;
+    trajectory_expected++;
+    Trajectory_Push(frame, (frame[1] == TRAJECTORY_FRAME_SAMPLE_LAST));
+    if (frame[1] == TRAJECTORY_FRAME_SAMPLE_LAST) {
+        trajectory_end_received = 1U;
+    }
+
+    //resume a starved playback once it has a segment to interpolate
+    if (trajectory_state == TRAJECTORY_STARVED && (trajectory_count >= 2U || trajectory_end_received)) {
+        trajectory_state = TRAJECTORY_PLAYING;
+    }
+}
+
+static void Trajectory_Handle_Frame(const uint8_t *frame) {
+    switch (frame[1]) {
+        case TRAJECTORY_FRAME_SAMPLE:
+        case TRAJECTORY_FRAME_SAMPLE_LAST:
+            Trajectory_Handle_Sample(frame);
+            return;
+        case TRAJECTORY_FRAME_START:
+            if (trajectory_state == TRAJECTORY_IDLE) {
+                trajectory_time_us    = 0;
+                trajectory_last_frame = g_tim1_time;
+                trajectory_state      = trajectory_count ? TRAJECTORY_PLAYING : TRAJECTORY_STARVED;
+            }
+            break;
+        case TRAJECTORY_FRAME_STOP:
+            Trajectory_Reset();
+            break;
+        case TRAJECTORY_FRAME_PING:
+            break;
+        default:
+            if (trajectory_rejected < 0xFFU) {
+                trajectory_rejected++;
+            }
+            break;
+    }
+
+    Trajectory_Send_Report();
+}
+
+/**
+ * @brief  Assembles frames from received bytes, resynchronising on the next sync byte if one
+ *         is corrupt
+ * @note   A corrupt frame keeps its bytes from the next sync byte onwards, so a dropped byte
+ *         costs one frame. Frames may be split across calls
+ * @param  data:   Pointer to the received bytes
+ * @param  length: Number of bytes
+ */
+static void Trajectory_Parse(const uint8_t *data, uint16_t length) {
+    uint8_t *frame = trajectory_rx_frame;
+
+    for (uint16_t i = 0; i < length; i++) {
+        //skip to the start of a frame
+        if (!trajectory_rx_offset && data[i] != TRAJECTORY_SYNC) {
+            continue;
+        }
+        frame[trajectory_rx_offset++] = data[i];
+        if (trajectory_rx_offset < TRAJECTORY_FRAME_SIZE) {
+            continue;
+        }
+
+        uint16_t checksum = (uint16_t) (frame[TRAJECTORY_FRAME_SIZE - 2U] | (frame[TRAJECTORY_FRAME_SIZE - 1U] << 8U));
+        trajectory_rx_offset = 0;
+        if (checksum == Trajectory_Checksum(frame, (TRAJECTORY_FRAME_SIZE - 2U))) {
+            Trajectory_Handle_Frame(frame);
+            continue;
+        }
+
+        //keep everything from the next candidate sync byte
+        for (uint8_t j = 1U; j < TRAJECTORY_FRAME_SIZE; j++) {
+            if (frame[j] == TRAJECTORY_SYNC) {
+                uint8_t keep = (uint8_t) (TRAJECTORY_FRAME_SIZE - j);
+                for (uint8_t k = 0; k < keep; k++) {
+                    frame[k] = frame[j + k];
+                }
+                trajectory_rx_offset = keep;
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief  Parses every byte waiting in the receive ring
+ * @note   Runs from PendSV, posted when the ring stops being empty. The USART keeps receiving
+ *         into the ring meanwhile, so nothing arriving during parsing is lost
+ */
+static void Trajectory_RX_Done(uint32_t argument) {
+    (void) argument;
+    uint8_t  chunk[TRAJECTORY_FRAME_SIZE];
+    uint16_t length;
+
+    while ((length = USART_Read(trajectory_config->usart->instance, chunk, TRAJECTORY_FRAME_SIZE))) {
+        Trajectory_Parse(chunk, length);
+    }
+}
+
+static void Trajectory_TX_Done(uint32_t argument) {
+    (void) argument;
+    if (trajectory_report_due) {
+        Trajectory_Send_Report();
+    }
+}
+
+static void Trajectory_Pop(void) {
+    trajectory_previous     = trajectory_fifo[trajectory_tail];
+    trajectory_has_previous = 1U;
+    trajectory_segment_set  = 0;
+    trajectory_segment_open = 0;
+    trajectory_tail         = (uint8_t) ((trajectory_tail + 1U) % TRAJECTORY_DEPTH);
+    trajectory_count--;
+}
+
+/**
+ * @brief  Loads the spline segment between the two oldest samples, starting at now_us
+ * @note   Tangents are Catmull-Rom finite differences over the neighbouring samples, scaled by
+ *         their spacing in time, so uneven sample intervals still join with continuous
+ *         velocity. The stream starts and ends at rest, and while the sample after the segment
+ *         has not arrived the end tangent falls back to the chord
+ * @note   Reloading a segment already under way, once that sample arrives, keeps the current
+ *         position and velocity and reshapes only the rest of the segment to the new end
+ *         tangent, so the correction does not step the output
+ */
+static void Trajectory_Load_Segment(uint64_t now_us) {
+    const Trajectory_Sample_t *from = &trajectory_fifo[trajectory_tail];
+    const Trajectory_Sample_t *to   = &trajectory_fifo[(trajectory_tail + 1U) % TRAJECTORY_DEPTH];
+    const Trajectory_Sample_t *next = &trajectory_fifo[(trajectory_tail + 2U) % TRAJECTORY_DEPTH];
+    const Trajectory_Sample_t *prev = &trajectory_previous;
+    uint8_t has_prev = (trajectory_has_previous && to->time_ms > prev->time_ms);
+    uint8_t has_next = (!to->last && trajectory_count >= 3U && next->time_ms > from->time_ms);
+    float   duration = (float) (to->time_ms - from->time_ms);
+
+    float p0[TRAJECTORY_MAX_AXES], p1[TRAJECTORY_MAX_AXES];
+    float m0[TRAJECTORY_MAX_AXES], m1[TRAJECTORY_MAX_AXES];
+    for (uint8_t axis = 0; axis < trajectory_config->axis_count; axis++) {
+        p0[axis] = ((float) from->positions[axis] * 0.01f);
+        p1[axis] = ((float) to->positions[axis] * 0.01f);
+        m0[axis] = has_prev ? (((float) to->positions[axis] - (float) prev->positions[axis]) * 0.01f
+                               * duration / (float) (to->time_ms - prev->time_ms))
+                            : 0;
+        if (has_next) {
+            m1[axis] = (((float) next->positions[axis] - (float) from->positions[axis]) * 0.01f
+                        * duration / (float) (next->time_ms - from->time_ms));
+        } else {
+            m1[axis] = to->last ? 0 : (p1[axis] - p0[axis]);
+        }
+    }
+
+    //step once per PWM frame from the current playback time
+    float duration_us = (duration * 1000.0f);
+    float start       = ((float) (now_us - ((uint64_t) from->time_ms * 1000U)) / duration_us);
+    float step        = ((float) trajectory_config->frame_us / duration_us);
+
+    //continue from where the loaded segment is now, over what is left of it
+    if (trajectory_segment_set) {
+        float remaining = (1.0f - start);
+        Interpolation_Evaluate(&trajectory_interpolation, start, p0);
+        Interpolation_Evaluate_Tangent(&trajectory_interpolation, start, m0);
+        for (uint8_t axis = 0; axis < trajectory_config->axis_count; axis++) {
+            m0[axis] *= remaining;
+            m1[axis] *= remaining;
+        }
+        start = 0;
+        step /= remaining;
+    }
+
+    Interpolation_Set_Hermite(&trajectory_interpolation, p0, p1, m0, m1);
+    Interpolation_Start(&trajectory_interpolation, start, step);
+    trajectory_segment_set  = 1U;
+    trajectory_segment_open = (!to->last && trajectory_count < 3U);
+}
+
+static void Trajectory_Output(float *degrees) {
+    //spline overshoot is clipped to the servo range
+    for (uint8_t axis = 0; axis < trajectory_config->axis_count; axis++) {
+        if (degrees[axis] < 0) {
+            degrees[axis] = 0;
+        } else if (degrees[axis] > 180.0f) {
+            degrees[axis] = 180.0f;
+        }
+    }
+
+    Servo_Set_Positions(trajectory_config->axes, degrees, trajectory_config->axis_count);
+}
+
+/**
+ * @brief  Advances playback by the PWM frames elapsed since the last step
+ * @note   Runs from PendSV, posted by the TIM1 update interrupt, so the new positions are
+ *         latched by the following update. Elapsed frames are counted from g_tim1_time, so a
+ *         late or merged step does not slow the playback clock. While starved the clock
+ *         stops and the last sample is held, so the motion resumes where it paused
+ * @note   Within a segment each frame is one forward difference step, additions only; the
+ *         spline is only evaluated in full when a segment is loaded
+ */
+static void Trajectory_Step(uint32_t argument) {
+    (void) argument;
+    uint32_t frame   = g_tim1_time;
+    uint32_t elapsed = (frame - trajectory_last_frame);
+    trajectory_last_frame = frame;
+
+    if (trajectory_state != TRAJECTORY_PLAYING || !elapsed) {
+        return;
+    }
+    trajectory_time_us += ((uint64_t) elapsed * trajectory_config->frame_us);
+    uint64_t now_us = trajectory_time_us;
+
+    //drop samples whose segment has passed
+    while (trajectory_count >= 2U
+           && ((uint64_t) trajectory_fifo[(trajectory_tail + 1U) % TRAJECTORY_DEPTH].time_ms * 1000U) <= now_us) {
+        Trajectory_Pop();
+    }
+    if (!trajectory_count) {
+        trajectory_state = TRAJECTORY_STARVED;
+        trajectory_underruns++;
+        Trajectory_Send_Report();
+        return;
+    }
+
+    const Trajectory_Sample_t *from    = &trajectory_fifo[trajectory_tail];
+    uint64_t                  from_us = ((uint64_t) from->time_ms * 1000U);
+    float                     degrees[TRAJECTORY_MAX_AXES];
+    if (trajectory_count >= 2U && now_us > from_us) {
+        //a fresh segment starts at now, as does one whose end tangent can now be computed,
+        //otherwise catch up on merged frames
+        if (!trajectory_segment_set || (trajectory_segment_open && trajectory_count >= 3U)) {
+            Trajectory_Load_Segment(now_us);
+            elapsed = 1U;
+        }
+        for (; elapsed; elapsed--) {
+            Interpolation_Step(&trajectory_interpolation, degrees);
+        }
+    } else {
+        for (uint8_t axis = 0; axis < trajectory_config->axis_count; axis++) {
+            degrees[axis] = ((float) from->positions[axis] * 0.01f);
+        }
+    }
+    Trajectory_Output(degrees);
+
+    //a single sample left is either the end of the stream or the host falling behind
+    if (trajectory_count == 1U && now_us >= from_us) {
+        if (from->last) {
+            Trajectory_Pop();
+            trajectory_state = TRAJECTORY_FINISHED;
+        } else {
+            trajectory_state = TRAJECTORY_STARVED;
+            trajectory_underruns++;
+        }
+        Trajectory_Send_Report();
+        return;
+    }
+
+    if ((uint8_t) (Trajectory_Credit_Limit() - trajectory_reported) >= TRAJECTORY_CREDIT_BATCH) {
+        Trajectory_Send_Report();
+    }
+}
+
+static void Trajectory_Frame_Update(void) {
+    Deferred_Post(Trajectory_Step, 0);
+}
+
+
+/**********************************************************************************/
+/*                            Trajectory Core Functions                           */
+/**********************************************************************************/
+
+/**
+ * @brief  Initialises streamed trajectory playback over a USART
+ * @note   Assumes the USART has been initialised via @ref USART_Init, each axis registered
+ *         via @ref Servo_Register, and TIM1 configured for servo frames with its update
+ *         interrupt enabled. Takes the TIM1 update callback, so cannot run alongside PID,
+ *         and the USART receiver, which runs continuously via @ref USART_Receive_Continuous
+ * @note   Flow control is credit based: every report carries a credit limit, the sequence
+ *         number the host may send samples up to, set so that samples in flight and in the
+ *         FIFO never exceed target_fill. The host sends as fast as its window allows, which
+ *         keeps the FIFO near target_fill. After a corrupt or lost frame the report's expected
+ *         sequence tells the host where to resume
+ * @note   Samples are joined by a Catmull-Rom spline evaluated at each PWM frame, so motion
+ *         has continuous velocity through every sample. Playback starts on a START frame and
+ *         finishes after a SAMPLE_LAST frame, sample times are milliseconds from START and
+ *         must increase
+ * @param  config: Pointer to Trajectory_Config structure, which must stay valid while in use
+ * @retval Status indicating success, invalid parameters, or error if the USART is busy
+ */
+Status Trajectory_Init(Trajectory_Config_t *config) {
+    //validate config struct pointer, axes and fill target
+    if (!config || !config->usart || !config->axes || !config->axis_count
+        || config->axis_count > TRAJECTORY_MAX_AXES || config->target_fill > TRAJECTORY_DEPTH) {
+        return INVALID_PARAM;
+    }
+    for (uint8_t i = 0; i < config->axis_count; i++) {
+        if (config->axes[i] >= Servo_Get_Axis_Count()) {
+            return INVALID_PARAM;
+        }
+    }
+
+    config->target_fill = config->target_fill ? config->target_fill : TRAJECTORY_DEPTH;
+    config->frame_us    = config->frame_us ? config->frame_us : TIM1_SERVO_FRAME_US;
+    trajectory_config   = config;
+
+    Interpolation_Init(&trajectory_interpolation, config->axis_count);
+    Trajectory_Reset();
+    trajectory_underruns  = 0;
+    trajectory_rejected   = 0;
+    trajectory_report_due = 0;
+    trajectory_rx_offset  = 0;
+    trajectory_last_frame = g_tim1_time;
+
+    //frames and reports are handled from PendSV
+    if (USART_Register_Notify(config->usart->instance, Trajectory_TX_Done, Trajectory_RX_Done, 0) != SUCCESS
+        || USART_Receive_Continuous(config->usart, trajectory_rx_ring, TRAJECTORY_RX_RING_SIZE) != SUCCESS) {
+        return ERROR;
+    }
+    TIM1_Register_Update_Callback(Trajectory_Frame_Update);
+
+    //grant the host its first window
+    Trajectory_Send_Report();
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Reads the playback state
+ * @retval Trajectory_State of the playback
+ */
+Trajectory_State Trajectory_Get_State(void) {
+    return (Trajectory_State) trajectory_state;
+}
+
+/**
+ * @brief  Reads the number of samples waiting in the FIFO
+ * @retval Number of samples, including the one being played from
+ */
+uint8_t Trajectory_Get_Fill(void) {
+    return trajectory_count;
+}
+
+/**
+ * @brief  Reads the number of times playback ran out of samples
+ * @retval Underruns since @ref Trajectory_Init
+ */
+uint32_t Trajectory_Get_Underruns(void) {
+    return trajectory_underruns;
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+#ifndef __TRAJECTORY_H
+#define __TRAJECTORY_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../utils/utils.h"
+#include "../drivers/tim1/tim1.h"
+#include "../drivers/usart/usart.h"
+#include "../servo/servo.h"
+#include "../interpolation/interpolation.h"
+
+
+/**********************************************************************************/
+/*                                     Defines                                    */
+/**********************************************************************************/
+
+#ifndef TRAJECTORY_MAX_AXES
+#define TRAJECTORY_MAX_AXES         8U
+#endif
+
+/* samples held on the device, at most 128 so the 8 bit sequence window cannot alias */
+#ifndef TRAJECTORY_DEPTH
+#define TRAJECTORY_DEPTH            64U
+#endif
+
+/* freed slots are reported to the host in batches of at least this many */
+#ifndef TRAJECTORY_CREDIT_BATCH
+#define TRAJECTORY_CREDIT_BATCH     8U
+#endif
+
+/*
+ * host to device frame, little-endian:
+ *   sync, type, sequence, reserved, time_ms (4), position (2) per axis in 0.01 degrees,
+ *   Fletcher-16 of the preceding bytes (2)
+ */
+#define TRAJECTORY_SYNC             0xA5U
+#define TRAJECTORY_FRAME_SIZE       (8U + (2U * TRAJECTORY_MAX_AXES) + 2U)
+
+/*
+ * device to host report, little-endian:
+ *   sync, type, credit limit, state, expected sequence, rejected frames, underruns (2),
+ *   playback time_ms (4), Fletcher-16 of the preceding bytes (2)
+ */
+#define TRAJECTORY_REPORT_SIZE      14U
+
+/* received bytes wait here until PendSV parses them, so reception never pauses */
+#ifndef TRAJECTORY_RX_RING_SIZE
+#define TRAJECTORY_RX_RING_SIZE     (4U * TRAJECTORY_FRAME_SIZE)
+#endif
+
+
+/**********************************************************************************/
+/*                                      Enums                                     */
+/**********************************************************************************/
+
+typedef enum {
+    TRAJECTORY_FRAME_SAMPLE = 0x01U,
+    TRAJECTORY_FRAME_SAMPLE_LAST,
+    TRAJECTORY_FRAME_START,
+    TRAJECTORY_FRAME_STOP,
+    TRAJECTORY_FRAME_PING,
+    TRAJECTORY_FRAME_REPORT = 0x81U
+} Trajectory_Frame_Type;
+
+typedef enum {
+    TRAJECTORY_IDLE = 0,
+    TRAJECTORY_PLAYING,
+    TRAJECTORY_STARVED,
+    TRAJECTORY_FINISHED
+} Trajectory_State;
+
+
+/**********************************************************************************/
+/*                              Configuration Structs                             */
+/**********************************************************************************/
+
+typedef struct {
+/************************************ Required ************************************/
+    USART_Init_Config_t *usart;
+    const uint8_t       *axes;                  /* servo axes, in sample position order */
+    uint8_t             axis_count;
+/************************************ Optional ************************************/
+    uint8_t             target_fill;
+    uint32_t            frame_us;
+} Trajectory_Config_t;
+
+typedef struct {
+    uint32_t time_ms;
+    uint16_t positions[TRAJECTORY_MAX_AXES];
+    uint8_t  last;
+} Trajectory_Sample_t;
+
+
+/**********************************************************************************/
+/*                               Function Prototypes                              */
+/**********************************************************************************/
+
+Status           Trajectory_Init             (Trajectory_Config_t *config);
+Trajectory_State Trajectory_Get_State        (void);
+uint8_t          Trajectory_Get_Fill         (void);
+uint32_t         Trajectory_Get_Underruns    (void);
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,322 @@
+#include "usb_cdc.h"
+
+/**********************************************************************************/
+/*                                 Static Variables                               */
+/**********************************************************************************/
+
+static const uint8_t usb_cdc_device_descriptor[18] = {
+    18U, USB_DESCRIPTOR_DEVICE,
+    0x00U, 0x02U,                                           /* USB 2.0 */
+    0x02U, 0x00U, 0x00U,                                    /* communications device class */
+    USB_EP0_PACKET_SIZE,
+    (uint8_t) (USB_CDC_VENDOR_ID & 0xFFU), (uint8_t) (USB_CDC_VENDOR_ID >> 8U),
+    (uint8_t) (USB_CDC_PRODUCT_ID & 0xFFU), (uint8_t) (USB_CDC_PRODUCT_ID >> 8U),
+    0x00U, 0x01U,                                           /* device release 1.00 */
+    1U, 2U, 3U,                                             /* manufacturer, product, serial */
+    1U
+};
+
+/* communications interface with its notification endpoint, then the data interface */
+static const uint8_t usb_cdc_configuration_descriptor[67] = {
+    9U, USB_DESCRIPTOR_CONFIGURATION, 67U, 0x00U, 2U, 1U, 0U, 0x80U, 50U,
+    9U, USB_DESCRIPTOR_INTERFACE, 0U, 0U, 1U, 0x02U, 0x02U, 0x01U, 0U,
+    5U, 0x24U, 0x00U, 0x10U, 0x01U,                         /* header, CDC 1.10 */
+    5U, 0x24U, 0x01U, 0x00U, 1U,                            /* call management */
+    4U, 0x24U, 0x02U, 0x02U,                                /* ACM, line coding and control line state */
+    5U, 0x24U, 0x06U, 0U, 1U,                               /* union */
+    7U, USB_DESCRIPTOR_ENDPOINT, USB_CDC_NOTIFY_EP, USB_ENDPOINT_INTERRUPT, USB_CDC_NOTIFY_PACKET_SIZE, 0x00U, 16U,
+    9U, USB_DESCRIPTOR_INTERFACE, 1U, 0U, 2U, 0x0AU, 0x00U, 0x00U, 0U,
+    7U, USB_DESCRIPTOR_ENDPOINT, USB_CDC_DATA_OUT_EP, USB_ENDPOINT_BULK, USB_CDC_PACKET_SIZE, 0x00U, 0U,
+    7U, USB_DESCRIPTOR_ENDPOINT, USB_CDC_DATA_IN_EP, USB_ENDPOINT_BULK, USB_CDC_PACKET_SIZE, 0x00U, 0U
+};
+
+static const uint8_t usb_cdc_language_string[4] = {4U, USB_DESCRIPTOR_STRING, 0x09U, 0x04U};
+
+static const uint8_t usb_cdc_manufacturer_string[20] = {
+    20U, USB_DESCRIPTOR_STRING,
+    'p', 0, 'w', 0, 'm', 0, '_', 0, 's', 0, 'e', 0, 'r', 0, 'v', 0, 'o', 0
+};
+
+static const uint8_t usb_cdc_product_string[34] = {
+    34U, USB_DESCRIPTOR_STRING,
+    'S', 0, 'e', 0, 'r', 0, 'v', 0, 'o', 0, ' ', 0, 'C', 0, 'o', 0,
+    'n', 0, 't', 0, 'r', 0, 'o', 0, 'l', 0, 'l', 0, 'e', 0, 'r', 0
+};
+
+/* hex of the 96 bit unique ID, filled in by USB_CDC_Init */
+static uint8_t usb_cdc_serial_string[50];
+
+static const uint8_t *const usb_cdc_strings[4] = {
+    usb_cdc_language_string,
+    usb_cdc_manufacturer_string,
+    usb_cdc_product_string,
+    usb_cdc_serial_string
+};
+
+static USB_Init_Config_t     usb_cdc_usb_config;
+static USB_CDC_Config_t      *usb_cdc_config;
+static USB_CDC_Line_Coding_t usb_cdc_line_coding    = {115200U, 0, 0, 8U};
+static volatile uint32_t     usb_cdc_control_lines  = 0;
+static volatile uint32_t     usb_cdc_configured     = 0;
+
+/* received blocks are filled by the endpoint and read in place by the consumer */
+static uint8_t               usb_cdc_rx_blocks[USB_CDC_RX_BLOCKS][USB_CDC_RX_BLOCK_SIZE] __attribute__((aligned(4)));
+static uint16_t              usb_cdc_rx_lengths[USB_CDC_RX_BLOCKS];
+static uint8_t               usb_cdc_rx_head        = 0;
+static uint8_t               usb_cdc_rx_tail        = 0;
+static volatile uint32_t     usb_cdc_rx_count       = 0;
+static volatile uint32_t     usb_cdc_rx_armed       = 0;
+
+static volatile uint32_t     usb_cdc_tx_busy        = 0;
+static uint8_t               usb_cdc_tx_zlp         = 0;
+
+
+/**********************************************************************************/
+/*                                Static Functions                                */
+/**********************************************************************************/
+
+static void USB_CDC_Build_Serial(void) {
+    static const char hex[16] = "0123456789ABCDEF";
+    const volatile uint32_t *uid = (const volatile uint32_t *) UID_BASE;
+
+    usb_cdc_serial_string[0] = sizeof(usb_cdc_serial_string);
+    usb_cdc_serial_string[1] = USB_DESCRIPTOR_STRING;
+    for (uint8_t i = 0; i < 24U; i++) {
+        uint32_t word   = uid[i / 8U];
+        uint8_t  nibble = (uint8_t) ((word >> (28U - ((i % 8U) * 4U))) & 0x0FU);
+        usb_cdc_serial_string[2U + (i * 2U)]  = (uint8_t) hex[nibble];
+        usb_cdc_serial_string[3U + (i * 2U)]  = 0;
+    }
+}
+
+static Status USB_CDC_Setup(const struct USB_Setup *setup, uint8_t **data, uint16_t *length) {
+    if ((setup->bmRequestType & USB_REQUEST_TYPE_MASK) != USB_REQUEST_TYPE_CLASS) {
+        return ERROR;
+    }
+
+    switch (setup->bRequest) {
+        case USB_CDC_SET_LINE_CODING:
+        case USB_CDC_GET_LINE_CODING:
+            *data   = (uint8_t *) &usb_cdc_line_coding;
+            *length = sizeof(usb_cdc_line_coding);
+            return SUCCESS;
+        case USB_CDC_SET_CONTROL_LINE_STATE:
+            usb_cdc_control_lines = (setup->wValue & (USB_CDC_CONTROL_DTR | USB_CDC_CONTROL_RTS));
+            return SUCCESS;
+        case USB_CDC_SEND_BREAK:
+            return SUCCESS;
+        default:
+            return ERROR;
+    }
+}
+
+/** @brief  Opens the endpoints and starts receiving on configuration, drops state on reset */
+static void USB_CDC_Configured(uint8_t configuration) {
+    usb_cdc_tx_busy  = 0;
+    usb_cdc_tx_zlp   = 0;
+    usb_cdc_rx_armed = 0;
+
+    if (!configuration) {
+        usb_cdc_configured    = 0;
+        usb_cdc_control_lines = 0;
+        return;
+    }
+
+    USB_Endpoint_Open(USB_CDC_DATA_OUT_EP, USB_ENDPOINT_BULK, USB_CDC_PACKET_SIZE);
+    USB_Endpoint_Open(USB_CDC_DATA_IN_EP, USB_ENDPOINT_BULK, USB_CDC_PACKET_SIZE);
+    USB_Endpoint_Open(USB_CDC_NOTIFY_EP, USB_ENDPOINT_INTERRUPT, USB_CDC_NOTIFY_PACKET_SIZE);
+
+    usb_cdc_rx_head    = 0;
+    usb_cdc_rx_tail    = 0;
+    usb_cdc_rx_count   = 0;
+    usb_cdc_configured = 1U;
+    if (USB_Endpoint_Receive(USB_CDC_DATA_OUT_EP, usb_cdc_rx_blocks[0], USB_CDC_RX_BLOCK_SIZE) == SUCCESS) {
+        usb_cdc_rx_armed = 1U;
+    }
+}
+
+/**
+ * @brief  Publishes a filled block and moves the endpoint on to the next free one
+ * @note   With every block waiting for the consumer the endpoint is left unarmed, so the
+ *         host is NAKed until @ref USB_CDC_Release frees one
+ */
+static void USB_CDC_OUT_Complete(uint8_t endpoint, uint16_t length) {
+    if (endpoint != USB_CDC_DATA_OUT_EP) {
+        return;
+    }
+
+    //a zero length packet carries nothing, so the same block is reused
+    if (length) {
+        usb_cdc_rx_lengths[usb_cdc_rx_head] = length;
+        usb_cdc_rx_head = (uint8_t) ((usb_cdc_rx_head + 1U) % USB_CDC_RX_BLOCKS);
+        usb_cdc_rx_count++;
+        if (usb_cdc_config->rx_notify) {
+            Deferred_Post(usb_cdc_config->rx_notify, usb_cdc_config->notify_argument);
+        }
+    }
+
+    usb_cdc_rx_armed = 0;
+    if (usb_cdc_rx_count < USB_CDC_RX_BLOCKS
+        && USB_Endpoint_Receive(USB_CDC_DATA_OUT_EP, usb_cdc_rx_blocks[usb_cdc_rx_head],
+                                USB_CDC_RX_BLOCK_SIZE) == SUCCESS) {
+        usb_cdc_rx_armed = 1U;
+    }
+}
+
+static void USB_CDC_IN_Complete(uint8_t endpoint) {
+    if (endpoint != (USB_CDC_DATA_IN_EP & 0x0FU)) {
+        return;
+    }
+
+    //end a transfer that filled its last packet so the host does not wait for more
+    if (usb_cdc_tx_zlp) {
+        usb_cdc_tx_zlp = 0;
+        USB_Endpoint_Transmit(endpoint, 0, 0);
+        return;
+    }
+
+    usb_cdc_tx_busy = 0;
+    if (usb_cdc_config->tx_notify) {
+        Deferred_Post(usb_cdc_config->tx_notify, usb_cdc_config->notify_argument);
+    }
+}
+
+
+/**********************************************************************************/
+/*                             USB CDC Core Functions                             */
+/**********************************************************************************/
+
+/**
+ * @brief  Initialises a CDC-ACM virtual COM port on the USB OTG FS device
+ * @note   Requires the system clock to run from the PLL (see @ref USB_Init). The serial
+ *         number string is the device's unique ID, so each board enumerates as a distinct port
+ * @note   The notify callbacks are posted via @ref Deferred_Post, rx_notify when a block of
+ *         received data is ready and tx_notify when a transmit buffer may be reused
+ * @param  config: Pointer to USB_CDC_Config structure, which must stay valid while in use
+ * @retval Status indicating success, invalid parameters, or error if the USB device could not
+ *         be initialised
+ */
+Status USB_CDC_Init(USB_CDC_Config_t *config) {
+    //validate config struct pointer
+    if (!config) {
+        return INVALID_PARAM;
+    }
+
+    usb_cdc_config        = config;
+    usb_cdc_configured    = 0;
+    usb_cdc_control_lines = 0;
+    USB_CDC_Build_Serial();
+
+    usb_cdc_usb_config.device_descriptor        = usb_cdc_device_descriptor;
+    usb_cdc_usb_config.configuration_descriptor = usb_cdc_configuration_descriptor;
+    usb_cdc_usb_config.string_descriptors       = usb_cdc_strings;
+    usb_cdc_usb_config.string_count             = (uint8_t) (sizeof(usb_cdc_strings) / sizeof(usb_cdc_strings[0]));
+    usb_cdc_usb_config.configured               = USB_CDC_Configured;
+    usb_cdc_usb_config.out_complete             = USB_CDC_OUT_Complete;
+    usb_cdc_usb_config.in_complete              = USB_CDC_IN_Complete;
+    usb_cdc_usb_config.setup                    = USB_CDC_Setup;
+    usb_cdc_usb_config.interrupt_class          = config->interrupt_class;
+
+    return USB_Init(&usb_cdc_usb_config);
+}
+
+/**
+ * @brief  Gets the oldest block of received data without copying it
+ * @note   The data stays valid, and its block out of use by the endpoint, until
+ *         @ref USB_CDC_Release. A parser can therefore work on the packet memory directly.
+ *         Blocks end at a short packet from the host, so a host that writes each message
+ *         separately gets one message per block
+ * @param  data:   Pointer to store the start of the block
+ * @param  length: Pointer to store the number of bytes in the block
+ * @retval Status indicating success, invalid parameters, or error if nothing is waiting
+ */
+Status USB_CDC_Read(const uint8_t **data, uint16_t *length) {
+    //validate pointers
+    if (!data || !length) {
+        return INVALID_PARAM;
+    }
+    if (!usb_cdc_rx_count) {
+        return ERROR;
+    }
+
+    *data   = usb_cdc_rx_blocks[usb_cdc_rx_tail];
+    *length = usb_cdc_rx_lengths[usb_cdc_rx_tail];
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Returns the block from @ref USB_CDC_Read to the endpoint
+ * @note   If every block was waiting the endpoint is re-armed here, which ends the NAKs that
+ *         were holding the host back
+ * @retval Status indicating success, or error if no block was waiting
+ */
+Status USB_CDC_Release(void) {
+    if (!usb_cdc_rx_count) {
+        return ERROR;
+    }
+
+    usb_cdc_rx_tail = (uint8_t) ((usb_cdc_rx_tail + 1U) % USB_CDC_RX_BLOCKS);
+
+    uint32_t primask = ENTER_CRITICAL();
+    usb_cdc_rx_count--;
+    if (!usb_cdc_rx_armed && usb_cdc_configured
+        && USB_Endpoint_Receive(USB_CDC_DATA_OUT_EP, usb_cdc_rx_blocks[usb_cdc_rx_head],
+                                USB_CDC_RX_BLOCK_SIZE) == SUCCESS) {
+        usb_cdc_rx_armed = 1U;
+    }
+    EXIT_CRITICAL(primask);
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Starts sending a buffer to the host
+ * @note   The buffer is read in place and must stay valid until tx_notify is posted
+ * @param  data:   Data to send
+ * @param  length: Number of bytes
+ * @retval Status indicating success, invalid parameters, or error if not configured by the
+ *         host or the previous transmit is still in progress
+ */
+Status USB_CDC_Transmit(const uint8_t *data, uint16_t length) {
+    //validate data
+    if (!data || !length) {
+        return INVALID_PARAM;
+    }
+    if (!usb_cdc_configured || !ATOMIC_CAS(&usb_cdc_tx_busy, 0, 1U)) {
+        return ERROR;
+    }
+
+    usb_cdc_tx_zlp = !(length % USB_CDC_PACKET_SIZE);
+    if (USB_Endpoint_Transmit((USB_CDC_DATA_IN_EP & 0x0FU), data, length) != SUCCESS) {
+        usb_cdc_tx_busy = 0;
+        return ERROR;
+    }
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Reads whether a host application has the port open
+ * @retval 1 if configured with DTR asserted, otherwise 0
+ */
+uint8_t USB_CDC_Is_Connected(void) {
+    return (usb_cdc_configured && (usb_cdc_control_lines & USB_CDC_CONTROL_DTR)) ? 1U : 0;
+}
+
+/**
+ * @brief  Reads the line coding last set by the host
+ * @note   Has no effect on the data rate, which is always the USB bus rate
+ * @param  line_coding: Pointer to store the line coding
+ * @retval Status indicating success or invalid parameters
+ */
+Status USB_CDC_Get_Line_Coding(USB_CDC_Line_Coding_t *line_coding) {
+    //validate line coding pointer
+    if (!line_coding) {
+        return INVALID_PARAM;
+    }
+
+    *line_coding = usb_cdc_line_coding;
+
+    return SUCCESS;
+}
\ No newline at end of file
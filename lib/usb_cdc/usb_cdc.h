@@ -0,0 +1,83 @@
+#ifndef __USB_CDC_H
+#define __USB_CDC_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../utils/utils.h"
+#include "../drivers/usb/usb.h"
+
+
+/**********************************************************************************/
+/*                                     Defines                                    */
+/**********************************************************************************/
+
+#ifndef USB_CDC_VENDOR_ID
+#define USB_CDC_VENDOR_ID           0x0483U
+#endif
+#ifndef USB_CDC_PRODUCT_ID
+#define USB_CDC_PRODUCT_ID          0x5740U
+#endif
+
+#define USB_CDC_PACKET_SIZE         64U
+#define USB_CDC_NOTIFY_PACKET_SIZE  8U
+#define USB_CDC_DATA_OUT_EP         0x01U
+#define USB_CDC_DATA_IN_EP          0x81U
+#define USB_CDC_NOTIFY_EP           0x82U
+
+/* received data is handed over in blocks, each one transfer of up to RX_BLOCK_SIZE bytes */
+#ifndef USB_CDC_RX_BLOCK_SIZE
+#define USB_CDC_RX_BLOCK_SIZE       512U
+#endif
+#ifndef USB_CDC_RX_BLOCKS
+#define USB_CDC_RX_BLOCKS           4U
+#endif
+
+/* class requests */
+#define USB_CDC_SET_LINE_CODING         0x20U
+#define USB_CDC_GET_LINE_CODING         0x21U
+#define USB_CDC_SET_CONTROL_LINE_STATE  0x22U
+#define USB_CDC_SEND_BREAK              0x23U
+
+#define USB_CDC_CONTROL_DTR         0x01U
+#define USB_CDC_CONTROL_RTS         0x02U
+
+
+/**********************************************************************************/
+/*                              Configuration Structs                             */
+/**********************************************************************************/
+
+typedef struct {
+/************************************ Optional ************************************/
+    Deferred_Work_t    rx_notify;
+    Deferred_Work_t    tx_notify;
+    uint32_t           notify_argument;
+    NVIC_Latency_Class interrupt_class;
+} USB_CDC_Config_t;
+
+typedef struct __attribute__((packed)) {
+    uint32_t baud_rate;
+    uint8_t  stop_bits;
+    uint8_t  parity;
+    uint8_t  data_bits;
+} USB_CDC_Line_Coding_t;
+
+
+/**********************************************************************************/
+/*                               Function Prototypes                              */
+/**********************************************************************************/
+
+Status  USB_CDC_Init                (USB_CDC_Config_t *config);
+Status  USB_CDC_Read                (const uint8_t **data, uint16_t *length);
+Status  USB_CDC_Release             (void);
+Status  USB_CDC_Transmit            (const uint8_t *data, uint16_t length);
+uint8_t USB_CDC_Is_Connected        (void);
+Status  USB_CDC_Get_Line_Coding     (USB_CDC_Line_Coding_t *line_coding);
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
\ No newline at end of file
@@ -1,284 +1,932 @@
-/* This file contains functions common across STM32 Blackpill projects */
-
-#include "utils.h"
-
-/**********************************************************************************/
-/*                                  RCC Functions                                 */
-/**********************************************************************************/
-
-void Peripheral_Reset(void) {
-    RCC->AHB1RSTR = 0x00000000;
-    RCC->AHB2RSTR = 0x00000000;
-    RCC->APB1RSTR = 0x00000000;
-    RCC->APB2RSTR = 0x00000000;
-}
-
-Status System_Clock_Init(System_Clock_Source clock_source) {
-    switch(clock_source) {
-        case HSI_CLOCK: {
-            RCC->CR |= RCC_CR_HSION;
-            do {} while (!(RCC->CR & RCC_CR_HSIRDY));
-            RCC->CFGR &= ~(RCC_CFGR_SW);
-            g_sys_clk_source = HSI_CLOCK;
-            g_sys_clk_freq = HSI_FREQ_HZ;
-            return SUCCESS;
-        }
-        case HSE_CLOCK: {
-            RCC->CR |= RCC_CR_HSEON;
-            do {} while (!(RCC->CR & RCC_CR_HSERDY));
-            RCC->CFGR |= RCC_CFGR_SW_0;
-            g_sys_clk_source = HSE_CLOCK;
-            g_sys_clk_freq = HSE_FREQ_HZ;
-            return SUCCESS;
-        }
-        default: return INVALID_PARAM;
-    }
-
-    return ERROR;
-}
-
-
-/**********************************************************************************/
-/*                                 SYSTICK Functions                              */
-/**********************************************************************************/
-
-void Delay_Loop(uint32_t delay_ms) {
-    if (delay_ms <= 0) {
-        return;
-    }
-    uint32_t ticks_per_ms = (g_sys_clk_freq / SEC_TO_MILLI);
-    uint32_t systick_reload_val = ((ticks_per_ms * delay_ms)  - 1UL);
-    SYSTICK->CTRL &= ~(SYSTICK_CTRL_ENABLE);
-
-    while (systick_reload_val > 0) {
-        if (systick_reload_val <= SYSTICK_LOAD_RELOAD) {
-            if (delay_ms <= 1000) {
-                systick_reload_val = ((systick_reload_val * 55) / 100);
-            }
-            SYSTICK->LOAD = systick_reload_val;
-            SYSTICK->VAL = CLEAR_REGISTER;
-            SYSTICK->CTRL |= SYSTICK_CTRL_CLKSOURCE | SYSTICK_CTRL_ENABLE;
-            while (!(SYSTICK->CTRL & SYSTICK_CTRL_COUNTFLAG)) {
-                NOP();
-            }
-            systick_reload_val = 0;
-            return;
-        } else {
-            SYSTICK->LOAD = SYSTICK_LOAD_RELOAD;
-            SYSTICK->VAL = CLEAR_REGISTER;
-            SYSTICK->CTRL |= SYSTICK_CTRL_CLKSOURCE | SYSTICK_CTRL_ENABLE;
-            while (!(SYSTICK->CTRL & SYSTICK_CTRL_COUNTFLAG)) {
-                NOP();
-            }
-            systick_reload_val -= SYSTICK_LOAD_RELOAD;
-        }
-        SYSTICK->CTRL &= ~(SYSTICK_CTRL_ENABLE);
-    }
-}
-
-/**
- * @brief  Initialises Systick as a time base
- * @param  unit: Unit of time for the time base. Limited to seconds, milliseconds and microseconds
- * @retval Status indicating success or invalid parameters
- */
-Status Systick_Init(Systick_Base_Unit unit) {
-    //initialise global systick time base
-    g_systick_time = 0;
-
-    //validate unit measure of systick time base
-    if (unit != SYSTICK_UNIT_SEC && unit != SYSTICK_UNIT_MILLI && unit != SYSTICK_UNIT_MICRO && unit) {
-        return INVALID_PARAM;
-    }
-
-    //calculate reload value
-    uint32_t ticks_per_unit;
-    switch (unit) {
-        case SYSTICK_UNIT_SEC:   ticks_per_unit = g_sys_clk_freq; break;
-        case SYSTICK_UNIT_MILLI: ticks_per_unit = (g_sys_clk_freq / SEC_TO_MILLI); break;
-        case SYSTICK_UNIT_MICRO: ticks_per_unit = (g_sys_clk_freq / SEC_TO_MICRO); break;
-        default: return INVALID_PARAM;
-    }
-    uint32_t reload_val = (ticks_per_unit - 1UL);
-
-    //validate reload value
-    if (reload_val > 0xFFFFFF) {
-        reload_val = 0xFFFFFF;
-    }
-
-    //configure systick
-    SYSTICK->CTRL &= ~(SYSTICK_CTRL_ENABLE);
-    SYSTICK->LOAD = reload_val;
-    SYSTICK->VAL = CLEAR_REGISTER;
-    SYSTICK->CTRL |= SYSTICK_CTRL_ENABLE | SYSTICK_CTRL_CLKSOURCE | SYSTICK_CTRL_TICKINT;
-
-    return SUCCESS;
-}
-
-/**
- * @brief  Delays program execution
- * @note   Assumes Systick has been configured as a time base unit via @ref Systick_Init
- * @param  time_delay: The desired time delay
- * @retval Status indicating success or invalid parameters
- */
-Status Systick_Delay(uint32_t time_delay) {
-    //validate time delay
-    if (time_delay <= 0) {
-        return INVALID_PARAM;
-    }
-
-    //wait for time delay to elapse
-    uint32_t previous_sys_time = g_systick_time;
-    while ((g_systick_time - previous_sys_time) < time_delay) {
-        NOP();
-    }
-
-    return SUCCESS;
-}
-
-
-/**********************************************************************************/
-/*                        Integer Size Validation Functions                       */
-/**********************************************************************************/
-
-Status Validate_uint8_t(int value) {
-    if (value < 0 || value > 0xFF) {
-        return INVALID_PARAM;
-    } else {
-        return SUCCESS;
-    }
-}
-
-Status Validate_uint16_t(int value) {
-    if (value < 0 || value > 0xFFFF) {
-        return INVALID_PARAM;
-    } else {
-        return SUCCESS;
-    }
-}
-
-/**********************************************************************************/
-/*                                  NVIC Functions                                */
-/**********************************************************************************/
-
-Status NVIC_Enable_IRQ(IRQn_t IRQn) {
-    if ((int32_t) IRQn >= 0) {
-        NVIC->ISER[((uint32_t) IRQn) >> DIV_BY_32] = ((uint32_t) (1UL << (((uint32_t) IRQn) & 0x1FUL)));
-        return SUCCESS;       
-    }
-    return ERROR;
-}
-
-Status NVIC_Disable_IRQ(IRQn_t IRQn) {
-    if ((int32_t) IRQn >= 0) {
-        NVIC->ICER[((uint32_t) IRQn) >> DIV_BY_32] = ((uint32_t) (1UL << (((uint32_t) IRQn) & 0x1FUL)));
-        return SUCCESS;
-    }
-    return ERROR;
-}
-
-uint32_t NVIC_Get_Enable_IRQ(IRQn_t IRQn) {
-    if ((int32_t) IRQn >= 0) {
-        uint32_t enable_status = (NVIC->ISER[((uint32_t) IRQn) >> DIV_BY_32]) & ((uint32_t) (1UL << (((uint32_t) IRQn) & 0x1FUL)));
-        if (enable_status == 0) {
-            return ((uint32_t) 0U);
-        } else {
-            return ((uint32_t) 1U);
-        }
-    } else {
-        return ((uint32_t) 0U);
-    }
-}
-
-Status NVIC_Set_Pending_IRQ(IRQn_t IRQn) {
-    if ((int32_t) IRQn >= 0) {
-        NVIC->ISPR[((uint32_t) IRQn) >> DIV_BY_32] = ((uint32_t) (1UL << (((uint32_t) IRQn) & 0x1FUL)));
-        return SUCCESS;
-    }
-    return ERROR;
-}
-
-Status NVIC_Clear_Pending_IRQ(IRQn_t IRQn) {
-    if ((int32_t) IRQn >= 0) {
-        NVIC->ICPR[((uint32_t) IRQn) >> DIV_BY_32] = ((uint32_t) (1UL << (((uint32_t) IRQn) & 0x1FUL)));
-        return SUCCESS;
-    }
-    return ERROR;
-}
-
-uint32_t NVIC_Get_Pending_IRQ(IRQn_t IRQn) {
-    if ((int32_t) IRQn >= 0) {
-        uint32_t pending_status = (NVIC->ISPR[((uint32_t) IRQn) >> DIV_BY_32]) & ((uint32_t) (1UL << (((uint32_t) IRQn) & 0x1FUL)));
-        if (pending_status == 0) {
-            return ((uint32_t) 0U);
-        } else {
-            return ((uint32_t) 1U);
-        }
-    } else {
-        return ((uint32_t) 0U);
-    }
-}
-
-uint32_t NVIC_Get_Active_IRQ(IRQn_t IRQn) {
-    if ((int32_t) IRQn >= 0) {
-        uint32_t active_status = (NVIC->IABR[((uint32_t) IRQn) >> DIV_BY_32]) & ((uint32_t) (1UL << (((uint32_t) IRQn) & 0x1FUL)));
-        if (active_status == 0) {
-            return ((uint32_t) 0U);
-        } else {
-            return ((uint32_t) 1U);
-        }
-    } else {
-        return ((uint32_t) 0U);
-    }
-}
-
-Status NVIC_Set_Priority(IRQn_t IRQn, uint32_t priority) {
-    if ((int32_t) IRQn >= 0) {
-        NVIC->IPR[(uint32_t) IRQn] = ((uint8_t) ((priority << NVIC_PRIORITY_BITS) & 0xFFUL));
-        return SUCCESS;
-    } else {
-        uint8_t shpr_array_position = ((uint8_t) IRQn) + ((uint8_t) 0xC);
-        if (shpr_array_position < 0) {
-            return ERROR;
-        } else {
-            SCB->SHPR[shpr_array_position] = ((uint8_t) ((priority << NVIC_PRIORITY_BITS) & 0xFFUL));
-            return SUCCESS;
-        }
-    }      
-}
-
-uint32_t NVIC_Get_Priority(IRQn_t IRQn) {
-    if ((int32_t) IRQn >= 0) {
-        uint32_t priority_status = (NVIC->IPR[(uint32_t) IRQn] >> NVIC_PRIORITY_BITS);
-        return priority_status;
-    } else {
-        uint8_t shpr_array_position = ((uint8_t) IRQn) + ((uint8_t) 0xC);
-        if (shpr_array_position < 0) {
-            return (uint32_t) ERROR;
-        } else {
-            uint32_t priority_status = (SCB->SHPR[shpr_array_position] >> NVIC_PRIORITY_BITS);
-            return priority_status;
-        }
-    }
-}
-
-Status Validate_Priority(uint32_t priority) {
-    if (priority < 0 || priority > 0xFF) {
-        return INVALID_PARAM;
-    } else {
-        return SUCCESS;
-    }
-}
-
-uint8_t priority_tracker[256];
-
-
-/**********************************************************************************/
-/*                               Interrupt Handlers                               */
-/**********************************************************************************/
-void SysTick_Handler(void) {
-    g_systick_time++;
-}
-
-
-
-
+/* This file contains functions common across STM32 Blackpill projects */
+
+#include "utils.h"
+
+/**********************************************************************************/
+/*                                  RCC Functions                                 */
+/**********************************************************************************/
+
+void Peripheral_Reset(void) {
+    RCC->AHB1RSTR = 0x00000000;
+    RCC->AHB2RSTR = 0x00000000;
+    RCC->APB1RSTR = 0x00000000;
+    RCC->APB2RSTR = 0x00000000;
+}
+
+static System_Clock_PLL_State pll_state       = PLL_STATE_IDLE;
+static uint32_t               pll_start_cycles = 0;
+static uint8_t                hse_failed       = 0;
+
+/**
+ * @brief  Converts the clock ready timeout to core cycles at the current system clock
+ * @note   Enables the cycle counter without clearing it, so boot timestamps survive
+ * @retval Timeout in core clock cycles
+ */
+static uint32_t System_Clock_Timeout_Cycles(void) {
+    if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA)) {
+        Cycle_Counter_Init();
+    }
+    uint32_t core_freq = g_sys_clk_freq ? g_sys_clk_freq : HSI_FREQ_HZ;
+
+    return ((core_freq / SEC_TO_MICRO) * CLOCK_TIMEOUT_US);
+}
+
+/**
+ * @brief  Turns on an oscillator and waits for its ready flag
+ * @param  enable: RCC_CR enable bit of the oscillator
+ * @param  ready:  RCC_CR ready flag of the oscillator
+ * @retval Status indicating success, or error if the flag did not set within the timeout
+ */
+static Status System_Clock_Wait_Ready(uint32_t enable, uint32_t ready) {
+    RCC->CR |= enable;
+
+    uint32_t timeout = System_Clock_Timeout_Cycles();
+    uint32_t start   = Cycle_Counter_Get();
+    while (!(RCC->CR & ready)) {
+        if ((Cycle_Counter_Get() - start) > timeout) {
+            return ERROR;
+        }
+    }
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Configures the PLL for PLL_FREQ_HZ on the system clock and 48MHz for USB
+ * @note   The PLL input is divided down to 1MHz, then VCO = 192MHz, P = 2 and Q = 4
+ * @param  source: HSE_CLOCK or HSI_CLOCK as the PLL input
+ */
+static void System_Clock_PLL_Configure(System_Clock_Source source) {
+    uint32_t pllm   = (source == HSE_CLOCK) ? (HSE_FREQ_HZ / SEC_TO_MICRO) : (HSI_FREQ_HZ / SEC_TO_MICRO);
+    uint32_t pllsrc = (source == HSE_CLOCK) ? RCC_PLLCFGR_PLLSRC_HSE : RCC_PLLCFGR_PLLSRC_HSI;
+
+    RCC->CR &= ~(RCC_CR_PLLON);
+
+    //96MHz needs regulator scale 1, which only takes effect once the PLL is on
+    RCC->APB1ENR |= RCC_APB1ENR_PWREN;
+    (void) RCC->APB1ENR;
+    PWR->CR = ((PWR->CR & ~(PWR_CR_VOS)) | PWR_CR_VOS_SCALE_1);
+
+    RCC->PLLCFGR = ((RCC->PLLCFGR & ~(RCC_PLLCFGR_PLLM | RCC_PLLCFGR_PLLN | RCC_PLLCFGR_PLLP
+                                      | RCC_PLLCFGR_PLLSRC | RCC_PLLCFGR_PLLQ))
+                    | (pllm << RCC_PLLCFGR_PLLM_Pos) | (192UL << RCC_PLLCFGR_PLLN_Pos)
+                    | pllsrc | (4UL << RCC_PLLCFGR_PLLQ_Pos));
+    RCC->CR |= RCC_CR_PLLON;
+}
+
+/**
+ * @brief  Initialises the system clock from HSI, HSE or the PLL
+ * @note   Every ready flag is polled with a timeout of CLOCK_TIMEOUT_US. If HSE does not
+ *         start, HSE requests stay on HSI and return error, while PLL requests run the PLL from
+ *         HSI instead (see @ref System_Clock_HSE_Failed)
+ * @param  clock_source: Clock to run the core from
+ * @retval Status indicating success, invalid parameters, or error if the clock fell back to HSI
+ */
+Status System_Clock_Init(System_Clock_Source clock_source) {
+    //validate clock source
+    if (clock_source != HSI_CLOCK && clock_source != HSE_CLOCK && clock_source != PLL_CLOCK) {
+        return INVALID_PARAM;
+    }
+
+    //HSI is the reset clock and the fallback for every other source
+    if (System_Clock_Wait_Ready(RCC_CR_HSION, RCC_CR_HSIRDY) != SUCCESS) {
+        return ERROR;
+    }
+
+    switch(clock_source) {
+        case HSE_CLOCK: {
+            hse_failed = 0;
+            if (System_Clock_Wait_Ready(RCC_CR_HSEON, RCC_CR_HSERDY) != SUCCESS) {
+                RCC->CR &= ~(RCC_CR_HSEON);
+                hse_failed = 1U;
+                System_Clock_Switch(HSI_CLOCK);
+                return ERROR;
+            }
+            return System_Clock_Switch(HSE_CLOCK);
+        }
+        case PLL_CLOCK: {
+            System_Clock_PLL_State state;
+            if (System_Clock_PLL_Start() != SUCCESS) {
+                return (g_sys_clk_source == PLL_CLOCK) ? SUCCESS : ERROR;
+            }
+            do {
+                state = System_Clock_PLL_Poll();
+            } while (state != PLL_STATE_LOCKED && state != PLL_STATE_FAILED);
+            if (state == PLL_STATE_FAILED) {
+                System_Clock_Switch(HSI_CLOCK);
+                return ERROR;
+            }
+            return System_Clock_Switch(PLL_CLOCK);
+        }
+        default: return System_Clock_Switch(HSI_CLOCK);
+    }
+}
+
+/**
+ * @brief  Starts HSE and the PLL without waiting for either to become ready
+ * @note   Progress is made by calling @ref System_Clock_PLL_Poll, which lets the core keep
+ *         running from HSI while the PLL locks
+ * @retval Status indicating success, or error if the core is already running from the PLL
+ */
+Status System_Clock_PLL_Start(void) {
+    if ((RCC->CFGR & RCC_CFGR_SWS) == RCC_CFGR_SWS_PLL) {
+        return ERROR;
+    }
+
+    //the cycle counter times HSE and PLL start-up
+    if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA)) {
+        Cycle_Counter_Init();
+    }
+
+    hse_failed = 0;
+    RCC->CR |= RCC_CR_HSEON;
+    pll_start_cycles = Cycle_Counter_Get();
+    pll_state = PLL_STATE_HSE_STARTING;
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Advances the PLL start-up begun by @ref System_Clock_PLL_Start
+ * @note   Once HSE is ready the PLL is configured from it. If HSE times out the PLL is run
+ *         from HSI instead. The PLL counts as locked once the regulator has also reached
+ *         scale 1. The core clock is not switched, see @ref System_Clock_Switch
+ * @retval Current PLL state, PLL_STATE_LOCKED once the PLL can be selected
+ */
+System_Clock_PLL_State System_Clock_PLL_Poll(void) {
+    uint32_t elapsed = (Cycle_Counter_Get() - pll_start_cycles);
+
+    switch (pll_state) {
+        case PLL_STATE_HSE_STARTING: {
+            if (RCC->CR & RCC_CR_HSERDY) {
+                System_Clock_PLL_Configure(HSE_CLOCK);
+            } else if (elapsed > System_Clock_Timeout_Cycles()) {
+                RCC->CR &= ~(RCC_CR_HSEON);
+                hse_failed = 1U;
+                System_Clock_PLL_Configure(HSI_CLOCK);
+            } else {
+                break;
+            }
+            pll_start_cycles = Cycle_Counter_Get();
+            pll_state = PLL_STATE_LOCKING;
+            break;
+        }
+        case PLL_STATE_LOCKING: {
+            if ((RCC->CR & RCC_CR_PLLRDY) && (PWR->CSR & PWR_CSR_VOSRDY)) {
+                pll_state = PLL_STATE_LOCKED;
+            } else if (elapsed > System_Clock_Timeout_Cycles()) {
+                RCC->CR &= ~(RCC_CR_PLLON);
+                pll_state = PLL_STATE_FAILED;
+            }
+            break;
+        }
+        default: break;
+    }
+
+    return pll_state;
+}
+
+/**
+ * @brief  Selects an already running clock as the system clock
+ * @note   Flash wait states are raised before and lowered after the switch, and APB1 is
+ *         divided by 2 above 50MHz. Updates g_sys_clk_source, g_sys_clk_freq and
+ *         g_apb1_clk_freq. Peripherals clocked from the buses keep their register settings,
+ *         so timer prescalers and baud rates must be rescaled by the caller
+ * @param  clock_source: Clock to run the core from, which must already be ready
+ * @retval Status indicating success, invalid parameters, or error if the switch timed out
+ */
+Status System_Clock_Switch(System_Clock_Source clock_source) {
+    uint32_t freq, sw;
+    switch (clock_source) {
+        case HSI_CLOCK: freq = HSI_FREQ_HZ; sw = 0UL;            break;
+        case HSE_CLOCK: freq = HSE_FREQ_HZ; sw = RCC_CFGR_SW_0;  break;
+        case PLL_CLOCK: freq = PLL_FREQ_HZ; sw = RCC_CFGR_SW_1;  break;
+        default: return INVALID_PARAM;
+    }
+
+    //wait states for 2.7V - 3.6V supply
+    uint32_t latency = FLASH_ACR_LATENCY_0WS;
+    if (freq > 90000000UL) {
+        latency = FLASH_ACR_LATENCY_3WS;
+    } else if (freq > 64000000UL) {
+        latency = FLASH_ACR_LATENCY_2WS;
+    } else if (freq > 30000000UL) {
+        latency = FLASH_ACR_LATENCY_1WS;
+    }
+    uint32_t ppre1 = (freq > 50000000UL) ? RCC_CFGR_PPRE1_DIV2 : RCC_CFGR_PPRE1_DIV1;
+
+    //slow down flash and APB1 before speeding up the core
+    if (latency > (FLASH->ACR & FLASH_ACR_LATENCY)) {
+        FLASH->ACR = ((FLASH->ACR & ~(FLASH_ACR_LATENCY)) | latency | FLASH_ACR_PRFTEN | FLASH_ACR_ICEN
+                      | FLASH_ACR_DCEN);
+        do {} while ((FLASH->ACR & FLASH_ACR_LATENCY) != latency);
+    }
+    if (ppre1) {
+        RCC->CFGR = ((RCC->CFGR & ~(RCC_CFGR_PPRE1)) | ppre1);
+    }
+
+    //switch and wait for the switch status to follow
+    RCC->CFGR = ((RCC->CFGR & ~(RCC_CFGR_SW)) | sw);
+    uint32_t timeout = System_Clock_Timeout_Cycles();
+    uint32_t start   = Cycle_Counter_Get();
+    while ((RCC->CFGR & RCC_CFGR_SWS) != (sw << RCC_CFGR_SWS_Pos)) {
+        if ((Cycle_Counter_Get() - start) > timeout) {
+            return ERROR;
+        }
+    }
+
+    //relax flash and APB1 after slowing down the core
+    if (!ppre1) {
+        RCC->CFGR &= ~(RCC_CFGR_PPRE1);
+    }
+    if (latency < (FLASH->ACR & FLASH_ACR_LATENCY)) {
+        FLASH->ACR = ((FLASH->ACR & ~(FLASH_ACR_LATENCY)) | latency);
+    }
+
+    g_sys_clk_source = clock_source;
+    g_sys_clk_freq   = freq;
+    g_apb1_clk_freq  = ppre1 ? (freq / 2U) : freq;
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Reports whether HSE failed to start and a clock fell back to HSI
+ * @retval 1 if HSE timed out during the last clock initialisation, otherwise 0
+ */
+uint8_t System_Clock_HSE_Failed(void) {
+    return hse_failed;
+}
+
+
+/**********************************************************************************/
+/*                                 SYSTICK Functions                              */
+/**********************************************************************************/
+
+void Delay_Loop(uint32_t delay_ms) {
+    if (delay_ms <= 0) {
+        return;
+    }
+    uint32_t ticks_per_ms = (g_sys_clk_freq / SEC_TO_MILLI);
+    uint32_t systick_reload_val = ((ticks_per_ms * delay_ms)  - 1UL);
+    SYSTICK->CTRL &= ~(SYSTICK_CTRL_ENABLE);
+
+    while (systick_reload_val > 0) {
+        if (systick_reload_val <= SYSTICK_LOAD_RELOAD) {
+            if (delay_ms <= 1000) {
+                systick_reload_val = ((systick_reload_val * 55) / 100);
+            }
+            SYSTICK->LOAD = systick_reload_val;
+            SYSTICK->VAL = CLEAR_REGISTER;
+            SYSTICK->CTRL |= SYSTICK_CTRL_CLKSOURCE | SYSTICK_CTRL_ENABLE;
+            while (!(SYSTICK->CTRL & SYSTICK_CTRL_COUNTFLAG)) {
+                NOP();
+            }
+            systick_reload_val = 0;
+            return;
+        } else {
+            SYSTICK->LOAD = SYSTICK_LOAD_RELOAD;
+            SYSTICK->VAL = CLEAR_REGISTER;
+            SYSTICK->CTRL |= SYSTICK_CTRL_CLKSOURCE | SYSTICK_CTRL_ENABLE;
+            while (!(SYSTICK->CTRL & SYSTICK_CTRL_COUNTFLAG)) {
+                NOP();
+            }
+            systick_reload_val -= SYSTICK_LOAD_RELOAD;
+        }
+        SYSTICK->CTRL &= ~(SYSTICK_CTRL_ENABLE);
+    }
+}
+
+static ISR_Handler_t systick_callback;
+
+/**
+ * @brief  Initialises Systick as a time base
+ * @param  unit: Unit of time for the time base. Limited to seconds, milliseconds and microseconds
+ * @retval Status indicating success or invalid parameters
+ */
+Status Systick_Init(Systick_Base_Unit unit) {
+    //initialise global systick time base
+    g_systick_time = 0;
+
+    //validate unit measure of systick time base
+    if (unit != SYSTICK_UNIT_SEC && unit != SYSTICK_UNIT_MILLI && unit != SYSTICK_UNIT_MICRO && unit) {
+        return INVALID_PARAM;
+    }
+
+    //calculate reload value
+    uint32_t ticks_per_unit;
+    switch (unit) {
+        case SYSTICK_UNIT_SEC:   ticks_per_unit = g_sys_clk_freq; break;
+        case SYSTICK_UNIT_MILLI: ticks_per_unit = (g_sys_clk_freq / SEC_TO_MILLI); break;
+        case SYSTICK_UNIT_MICRO: ticks_per_unit = (g_sys_clk_freq / SEC_TO_MICRO); break;
+        default: return INVALID_PARAM;
+    }
+    uint32_t reload_val = (ticks_per_unit - 1UL);
+
+    //validate reload value
+    if (reload_val > 0xFFFFFF) {
+        reload_val = 0xFFFFFF;
+    }
+
+    //configure systick
+    SYSTICK->CTRL &= ~(SYSTICK_CTRL_ENABLE);
+    SYSTICK->LOAD = reload_val;
+    SYSTICK->VAL = CLEAR_REGISTER;
+    SYSTICK->CTRL |= SYSTICK_CTRL_ENABLE | SYSTICK_CTRL_CLKSOURCE | SYSTICK_CTRL_TICKINT;
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Delays program execution
+ * @note   Assumes Systick has been configured as a time base unit via @ref Systick_Init
+ * @param  time_delay: The desired time delay
+ * @retval Status indicating success or invalid parameters
+ */
+Status Systick_Delay(uint32_t time_delay) {
+    //validate time delay
+    if (time_delay <= 0) {
+        return INVALID_PARAM;
+    }
+
+    //sleep between systick interrupts until the delay has elapsed
+    uint32_t previous_sys_time = g_systick_time;
+    while ((g_systick_time - previous_sys_time) < time_delay) {
+        WFI();
+    }
+
+    return SUCCESS;
+}
+
+
+/**
+ * @brief  Registers a function to run from the Systick interrupt
+ * @note   The callback runs once per Systick period, after g_systick_time is incremented
+ * @param  callback: Function to be called, or NULL to remove the current callback
+ * @retval Status indicating success
+ */
+Status Systick_Register_Callback(ISR_Handler_t callback) {
+    systick_callback = callback;
+
+    return SUCCESS;
+}
+
+
+/**********************************************************************************/
+/*                            DWT Cycle Counter Functions                         */
+/**********************************************************************************/
+
+/**
+ * @brief  Enables the DWT cycle counter used for latency and profiling measurements
+ */
+void Cycle_Counter_Init(void) {
+    CORE_DEBUG->DEMCR |= CORE_DEBUG_DEMCR_TRCENA;
+    DWT->CYCCNT = CLEAR_REGISTER;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA;
+}
+
+/**
+ * @brief  Reads the DWT cycle counter
+ * @note   Assumes the cycle counter has been enabled via @ref Cycle_Counter_Init
+ * @retval Number of core clock cycles elapsed, wrapping at 32 bits
+ */
+uint32_t Cycle_Counter_Get(void) {
+    return DWT->CYCCNT;
+}
+
+/**
+ * @brief  Converts a cycle count to nanoseconds at the current system clock frequency
+ * @param  cycles: Number of core clock cycles
+ * @retval Duration in nanoseconds
+ */
+uint32_t Cycles_To_Nanoseconds(uint32_t cycles) {
+    if (g_sys_clk_freq == 0) {
+        return 0;
+    }
+    return ((uint32_t) ((((uint64_t) cycles) * SEC_TO_NANO) / g_sys_clk_freq));
+}
+
+
+/**********************************************************************************/
+/*                        Integer Size Validation Functions                       */
+/**********************************************************************************/
+
+Status Validate_uint8_t(int value) {
+    if (value < 0 || value > 0xFF) {
+        return INVALID_PARAM;
+    } else {
+        return SUCCESS;
+    }
+}
+
+Status Validate_uint16_t(int value) {
+    if (value < 0 || value > 0xFFFF) {
+        return INVALID_PARAM;
+    } else {
+        return SUCCESS;
+    }
+}
+
+/**********************************************************************************/
+/*                                  NVIC Functions                                */
+/**********************************************************************************/
+
+Status NVIC_Enable_IRQ(IRQn_t IRQn) {
+    if ((int32_t) IRQn >= 0) {
+        NVIC->ISER[((uint32_t) IRQn) >> DIV_BY_32] = ((uint32_t) (1UL << (((uint32_t) IRQn) & 0x1FUL)));
+        return SUCCESS;       
+    }
+    return ERROR;
+}
+
+Status NVIC_Disable_IRQ(IRQn_t IRQn) {
+    if ((int32_t) IRQn >= 0) {
+        NVIC->ICER[((uint32_t) IRQn) >> DIV_BY_32] = ((uint32_t) (1UL << (((uint32_t) IRQn) & 0x1FUL)));
+        return SUCCESS;
+    }
+    return ERROR;
+}
+
+uint32_t NVIC_Get_Enable_IRQ(IRQn_t IRQn) {
+    if ((int32_t) IRQn >= 0) {
+        uint32_t enable_status = (NVIC->ISER[((uint32_t) IRQn) >> DIV_BY_32]) & ((uint32_t) (1UL << (((uint32_t) IRQn) & 0x1FUL)));
+        if (enable_status == 0) {
+            return ((uint32_t) 0U);
+        } else {
+            return ((uint32_t) 1U);
+        }
+    } else {
+        return ((uint32_t) 0U);
+    }
+}
+
+Status NVIC_Set_Pending_IRQ(IRQn_t IRQn) {
+    if ((int32_t) IRQn >= 0) {
+        NVIC->ISPR[((uint32_t) IRQn) >> DIV_BY_32] = ((uint32_t) (1UL << (((uint32_t) IRQn) & 0x1FUL)));
+        return SUCCESS;
+    }
+    return ERROR;
+}
+
+Status NVIC_Clear_Pending_IRQ(IRQn_t IRQn) {
+    if ((int32_t) IRQn >= 0) {
+        NVIC->ICPR[((uint32_t) IRQn) >> DIV_BY_32] = ((uint32_t) (1UL << (((uint32_t) IRQn) & 0x1FUL)));
+        return SUCCESS;
+    }
+    return ERROR;
+}
+
+uint32_t NVIC_Get_Pending_IRQ(IRQn_t IRQn) {
+    if ((int32_t) IRQn >= 0) {
+        uint32_t pending_status = (NVIC->ISPR[((uint32_t) IRQn) >> DIV_BY_32]) & ((uint32_t) (1UL << (((uint32_t) IRQn) & 0x1FUL)));
+        if (pending_status == 0) {
+            return ((uint32_t) 0U);
+        } else {
+            return ((uint32_t) 1U);
+        }
+    } else {
+        return ((uint32_t) 0U);
+    }
+}
+
+uint32_t NVIC_Get_Active_IRQ(IRQn_t IRQn) {
+    if ((int32_t) IRQn >= 0) {
+        uint32_t active_status = (NVIC->IABR[((uint32_t) IRQn) >> DIV_BY_32]) & ((uint32_t) (1UL << (((uint32_t) IRQn) & 0x1FUL)));
+        if (active_status == 0) {
+            return ((uint32_t) 0U);
+        } else {
+            return ((uint32_t) 1U);
+        }
+    } else {
+        return ((uint32_t) 0U);
+    }
+}
+
+Status NVIC_Set_Priority(IRQn_t IRQn, uint32_t priority) {
+    if ((int32_t) IRQn >= 0) {
+        NVIC->IPR[(uint32_t) IRQn] = ((uint8_t) ((priority << NVIC_PRIORITY_BITS) & 0xFFUL));
+        return SUCCESS;
+    } else {
+        uint8_t shpr_array_position = ((uint8_t) IRQn) + ((uint8_t) 0xC);
+        if (shpr_array_position < 0) {
+            return ERROR;
+        } else {
+            SCB->SHPR[shpr_array_position] = ((uint8_t) ((priority << NVIC_PRIORITY_BITS) & 0xFFUL));
+            return SUCCESS;
+        }
+    }      
+}
+
+uint32_t NVIC_Get_Priority(IRQn_t IRQn) {
+    if ((int32_t) IRQn >= 0) {
+        uint32_t priority_status = (NVIC->IPR[(uint32_t) IRQn] >> NVIC_PRIORITY_BITS);
+        return priority_status;
+    } else {
+        uint8_t shpr_array_position = ((uint8_t) IRQn) + ((uint8_t) 0xC);
+        if (shpr_array_position < 0) {
+            return (uint32_t) ERROR;
+        } else {
+            uint32_t priority_status = (SCB->SHPR[shpr_array_position] >> NVIC_PRIORITY_BITS);
+            return priority_status;
+        }
+    }
+}
+
+Status Validate_Priority(uint32_t priority) {
+    if (priority > ((SET_ONE << NVIC_PRIORITY_BITS) - 1UL)) {
+        return INVALID_PARAM;
+    } else {
+        return SUCCESS;
+    }
+}
+
+
+/**********************************************************************************/
+/*                          NVIC Priority Resource Manager                        */
+/**********************************************************************************/
+
+/* preempt priority assigned to each latency class, indexed by NVIC_Latency_Class */
+static const uint8_t nvic_class_preempt[] = {
+    [NVIC_CLASS_DEFAULT]    = 0xFFU,
+    [NVIC_CLASS_SAFETY]     = 0U,
+    [NVIC_CLASS_SERVO]      = 1U,
+    [NVIC_CLASS_FEEDBACK]   = 2U,
+    [NVIC_CLASS_TIMEBASE]   = 3U,
+    [NVIC_CLASS_COMMS]      = 4U,
+    [NVIC_CLASS_BACKGROUND] = 6U,
+    [NVIC_CLASS_DEFERRED]   = 7U
+};
+
+/* owner of each interrupt, system exceptions occupy the first 16 entries */
+static const void *nvic_owners[16U + NVIC_IRQ_COUNT] = {0};
+static uint8_t     nvic_grouping_configured          = 0;
+
+/**
+ * @brief  Maps an interrupt number to its entry in the ownership table
+ * @param  IRQn: Interrupt number
+ * @retval Table index, or -1 if the interrupt number is out of range
+ */
+static int32_t NVIC_Owner_Index(IRQn_t IRQn) {
+    int32_t index = ((int32_t) IRQn) + 16;
+    if (index < 0 || index >= (int32_t) (16U + NVIC_IRQ_COUNT)) {
+        return -1;
+    }
+    return index;
+}
+
+/**
+ * @brief  Configures AIRCR PRIGROUP to split the priority bits into preempt and sub-priority
+ * @note   With 4 implemented bits, 3 preempt bits give 8 preemption levels with 2 sub-priorities
+ *         each. Called automatically by the first IRQ request
+ */
+void NVIC_Priority_Grouping_Init(void) {
+    uint32_t aircr = (SCB->AIRCR & ~(0xFFFF0000UL | SCB_AIRCR_PRIGROUP));
+    aircr |= (SCB_AIRCR_VECTKEY | ((7UL - NVIC_PREEMPT_BITS) << SCB_AIRCR_PRIGROUP_Pos));
+    SCB->AIRCR = aircr;
+    nvic_grouping_configured = 1U;
+}
+
+/**
+ * @brief  Encodes a preempt and sub-priority into a value for @ref NVIC_Set_Priority
+ * @param  preempt_priority: Preempt priority, lower values preempt higher values
+ * @param  sub_priority:     Sub-priority, orders pending interrupts of equal preempt priority
+ * @retval Encoded priority
+ */
+uint32_t NVIC_Encode_Priority(uint32_t preempt_priority, uint32_t sub_priority) {
+    return (((preempt_priority & ((SET_ONE << NVIC_PREEMPT_BITS) - 1UL)) << NVIC_SUB_BITS)
+            | (sub_priority & ((SET_ONE << NVIC_SUB_BITS) - 1UL)));
+}
+
+/**
+ * @brief  Claims an interrupt and sets its priority from a latency class
+ * @note   Classes are ordered so that servo-critical interrupts always preempt feedback,
+ *         time base and communication interrupts. An owner may request the same interrupt
+ *         again, e.g. for multiple channels sharing one vector
+ * @param  IRQn:          Interrupt number
+ * @param  latency_class: Latency class of the interrupt
+ * @param  owner:         Identifier of the requesting driver, typically its peripheral instance
+ * @retval Status indicating success, error if owned by another driver, or invalid parameters
+ */
+Status NVIC_Request_IRQ(IRQn_t IRQn, NVIC_Latency_Class latency_class, const void *owner) {
+    //validate latency class
+    if (latency_class <= NVIC_CLASS_DEFAULT || latency_class > NVIC_CLASS_DEFERRED) {
+        return INVALID_PARAM;
+    }
+
+    return NVIC_Reserve_Priority(IRQn, nvic_class_preempt[latency_class], 0, owner);
+}
+
+/**
+ * @brief  Claims an interrupt with an explicit preempt and sub-priority
+ * @param  IRQn:             Interrupt number
+ * @param  preempt_priority: Preempt priority (0 - 7)
+ * @param  sub_priority:     Sub-priority (0 - 1)
+ * @param  owner:            Identifier of the requesting driver
+ * @retval Status indicating success, error if owned by another driver, or invalid parameters
+ */
+Status NVIC_Reserve_Priority(IRQn_t IRQn, uint32_t preempt_priority, uint32_t sub_priority,
+                             const void *owner) {
+    //validate owner and priorities
+    int32_t index = NVIC_Owner_Index(IRQn);
+    if (!owner || index < 0 || preempt_priority >= (SET_ONE << NVIC_PREEMPT_BITS)
+        || sub_priority >= (SET_ONE << NVIC_SUB_BITS)) {
+        return INVALID_PARAM;
+    }
+
+    //validate ownership
+    if (nvic_owners[index] && nvic_owners[index] != owner) {
+        return ERROR;
+    }
+
+    if (!nvic_grouping_configured) {
+        NVIC_Priority_Grouping_Init();
+    }
+
+    nvic_owners[index] = owner;
+    return NVIC_Set_Priority(IRQn, NVIC_Encode_Priority(preempt_priority, sub_priority));
+}
+
+/**
+ * @brief  Disables and releases an interrupt claimed via @ref NVIC_Request_IRQ
+ * @param  IRQn:  Interrupt number
+ * @param  owner: Identifier of the driver that owns the interrupt
+ * @retval Status indicating success, error if not owned by the caller, or invalid parameters
+ */
+Status NVIC_Release_IRQ(IRQn_t IRQn, const void *owner) {
+    //validate interrupt number
+    int32_t index = NVIC_Owner_Index(IRQn);
+    if (index < 0) {
+        return INVALID_PARAM;
+    }
+
+    //validate ownership
+    if (nvic_owners[index] != owner) {
+        return ERROR;
+    }
+
+    NVIC_Disable_IRQ(IRQn);
+    nvic_owners[index] = 0;
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Converts a latency class to a BASEPRI value for @ref ENTER_CRITICAL_BASEPRI
+ * @note   The returned value masks the given class and every lower class. The safety class
+ *         has preempt priority 0, which BASEPRI cannot mask, so it maps to 0 (no masking);
+ *         use @ref ENTER_CRITICAL to exclude safety interrupts
+ * @param  latency_class: Highest latency class to be masked
+ * @retval BASEPRI register value
+ */
+uint32_t NVIC_Class_To_BASEPRI(NVIC_Latency_Class latency_class) {
+    if (latency_class <= NVIC_CLASS_DEFAULT || latency_class > NVIC_CLASS_DEFERRED) {
+        return 0;
+    }
+    return ((NVIC_Encode_Priority(nvic_class_preempt[latency_class], 0) << (8U - NVIC_PRIORITY_BITS)) & 0xFFUL);
+}
+
+/**
+ * @brief  Returns the owner of an interrupt
+ * @param  IRQn: Interrupt number
+ * @retval Owner identifier, or NULL if the interrupt is unclaimed
+ */
+const void *NVIC_Get_Owner(IRQn_t IRQn) {
+    int32_t index = NVIC_Owner_Index(IRQn);
+    if (index < 0) {
+        return 0;
+    }
+    return nvic_owners[index];
+}
+
+
+/**********************************************************************************/
+/*                           Vector Table Relocation Functions                    */
+/**********************************************************************************/
+
+/* SRAM copy of the vector table, VTOR requires alignment to the next power of two of its size */
+static ISR_Handler_t ram_vector_table[VECTOR_TABLE_SIZE] __attribute__((aligned(VECTOR_TABLE_ALIGNMENT)));
+static uint8_t       vector_table_relocated = 0;
+
+/**
+ * @brief  Copies the active vector table to SRAM and points VTOR at the copy
+ * @note   Handlers bound at link time remain in place until replaced via
+ *         @ref NVIC_Register_Handler. Calling this function more than once has no effect
+ * @retval Status indicating success
+ */
+Status Vector_Table_Relocate(void) {
+    if (vector_table_relocated) {
+        return SUCCESS;
+    }
+
+    //copy active vector table
+    const ISR_Handler_t *flash_vector_table = (const ISR_Handler_t *) (SCB->VTOR & SCB_VTOR_TBLOFF);
+    uint32_t primask = ENTER_CRITICAL();
+    for (uint32_t i = 0; i < VECTOR_TABLE_SIZE; i++) {
+        ram_vector_table[i] = flash_vector_table[i];
+    }
+
+    //point VTOR at the SRAM copy
+    DSB();
+    SCB->VTOR = (((uint32_t) (uintptr_t) ram_vector_table) & SCB_VTOR_TBLOFF);
+    DSB();
+    ISB();
+    vector_table_relocated = 1U;
+    EXIT_CRITICAL(primask);
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Reports whether the vector table has been relocated to SRAM
+ * @retval 1 if relocated via @ref Vector_Table_Relocate, otherwise 0
+ */
+uint8_t Vector_Table_Is_Relocated(void) {
+    return vector_table_relocated;
+}
+
+/**
+ * @brief  Installs an interrupt handler at runtime
+ * @note   Assumes the vector table has been relocated via @ref Vector_Table_Relocate
+ * @param  IRQn:    Interrupt number
+ * @param  handler: Handler to be installed
+ * @retval Status indicating success, error if not relocated, or invalid parameters
+ */
+Status NVIC_Register_Handler(IRQn_t IRQn, ISR_Handler_t handler) {
+    //validate interrupt number and handler
+    int32_t index = ((int32_t) IRQn) + 16;
+    if (!handler || index < 2 || index >= (int32_t) VECTOR_TABLE_SIZE) {
+        return INVALID_PARAM;
+    }
+
+    //validate relocation
+    if (!vector_table_relocated) {
+        return ERROR;
+    }
+
+    ram_vector_table[index] = handler;
+    DSB();
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Returns the handler currently installed for an interrupt
+ * @param  IRQn: Interrupt number
+ * @retval Installed handler, or NULL if the interrupt number is out of range
+ */
+ISR_Handler_t NVIC_Get_Handler(IRQn_t IRQn) {
+    int32_t index = ((int32_t) IRQn) + 16;
+    if (index < 2 || index >= (int32_t) VECTOR_TABLE_SIZE) {
+        return 0;
+    }
+
+    const ISR_Handler_t *vector_table = (const ISR_Handler_t *) (SCB->VTOR & SCB_VTOR_TBLOFF);
+    return vector_table[index];
+}
+
+
+/**********************************************************************************/
+/*                           Deferred Interrupt Work Functions                    */
+/**********************************************************************************/
+
+#if (DEFERRED_QUEUE_SIZE & DEFERRED_QUEUE_MASK) || (DEFERRED_QUEUE_SIZE < 2U)
+#error "DEFERRED_QUEUE_SIZE must be a power of two"
+#endif
+
+typedef struct {
+    volatile uint32_t sequence;
+    Deferred_Work_t   work;
+    uint32_t          argument;
+} Deferred_Item_t;
+
+static Deferred_Item_t   deferred_queue[DEFERRED_QUEUE_SIZE];
+static volatile uint32_t deferred_head        = 0;
+static uint32_t          deferred_tail        = 0;
+static volatile uint32_t deferred_dropped     = 0;
+static uint8_t           deferred_initialised = 0;
+
+/**
+ * @brief  Claims PendSV for draining the deferred work queue
+ * @note   Work posted via @ref Deferred_Post runs in PendSV at NVIC_CLASS_DEFERRED, below
+ *         every other interrupt. Safe to call from each module that posts work
+ * @retval Status indicating success, or error if PendSV is owned by another module
+ */
+Status Deferred_Init(void) {
+    //claim PendSV at the lowest priority
+    if (NVIC_Request_IRQ(PendSV_IRQn, NVIC_CLASS_DEFERRED, deferred_queue) != SUCCESS) {
+        return ERROR;
+    }
+
+    if (deferred_initialised) {
+        return SUCCESS;
+    }
+
+    //each slot's sequence equals the head position that may reserve it next
+    for (uint32_t i = 0; i < DEFERRED_QUEUE_SIZE; i++) {
+        deferred_queue[i].sequence = i;
+    }
+    deferred_head        = 0;
+    deferred_tail        = 0;
+    deferred_dropped     = 0;
+    deferred_initialised = 1;
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Queues a function to run from PendSV and pends PendSV
+ * @note   Lock-free and callable from any interrupt or thread mode. Producers reserve a slot
+ *         by advancing the head with LDREX/STREX and publish it by writing its sequence, so a
+ *         nested interrupt that posts between the two is never blocked. Items run in the order
+ *         their slots were reserved
+ * @param  work:     Function to run at NVIC_CLASS_DEFERRED
+ * @param  argument: Value passed to the function
+ * @retval Status indicating success, invalid parameters, or error if the queue is full
+ */
+Status Deferred_Post(Deferred_Work_t work, uint32_t argument) {
+    //validate work function
+    if (!work) {
+        return INVALID_PARAM;
+    }
+
+    //reserve the slot at the head, a nested post may take it first
+    uint32_t position;
+    Deferred_Item_t *item;
+    while (1) {
+        position = deferred_head;
+        item     = &deferred_queue[position & DEFERRED_QUEUE_MASK];
+        int32_t lap = (int32_t) (item->sequence - position);
+        if (lap < 0) {
+            ATOMIC_ADD(&deferred_dropped, 1U);
+            return ERROR;
+        }
+        if (lap == 0 && ATOMIC_CAS(&deferred_head, position, (position + 1U))) {
+            break;
+        }
+    }
+
+    //fill the slot, then publish it to PendSV
+    item->work     = work;
+    item->argument = argument;
+    DMB();
+    item->sequence = (position + 1U);
+
+    SCB->ICSR = SCB_ICSR_PENDSVSET;
+    return SUCCESS;
+}
+
+/**
+ * @brief  Runs the deferred work queued so far, in posting order
+ * @note   Called from PendSV only. Stops at a slot that has been reserved but not yet
+ *         published. The producer that reserved it was preempted by PendSV, and pends PendSV
+ *         again once it publishes
+ */
+void Deferred_Run(void) {
+    while (1) {
+        Deferred_Item_t *item = &deferred_queue[deferred_tail & DEFERRED_QUEUE_MASK];
+        if (item->sequence != (deferred_tail + 1U)) {
+            return;
+        }
+
+        //copy the item out and release the slot before running it, so the work may post again
+        Deferred_Work_t work     = item->work;
+        uint32_t        argument = item->argument;
+        DMB();
+        item->sequence = (deferred_tail + DEFERRED_QUEUE_SIZE);
+        deferred_tail++;
+
+        work(argument);
+    }
+}
+
+/**
+ * @brief  Reads the number of posts rejected because the queue was full
+ * @retval Number of dropped work items since @ref Deferred_Init
+ */
+uint32_t Deferred_Get_Dropped(void) {
+    return deferred_dropped;
+}
+
+
+/**********************************************************************************/
+/*                               Interrupt Handlers                               */
+/**********************************************************************************/
+void SysTick_Handler(void) {
+    g_systick_time++;
+    if (systick_callback) {
+        systick_callback();
+    }
+}
+
+/**
+ * @brief  Runs deferred work posted via @ref Deferred_Post
+ * @note   Weak so that a scheduler can take over PendSV, calling @ref Deferred_Run before
+ *         switching context
+ */
+__attribute__((weak)) void PendSV_Handler(void) {
+    Deferred_Run();
+}
+
+
+
+
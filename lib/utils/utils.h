@@ -1,171 +1,337 @@
-/* This header file contains prototypes of functions and macros common across all STM32 Blackpill projects */
-
-#ifndef __UTILS_H
-#define __UTILS_H
-
-#ifdef __cplusplus
-    extern "C" {
-#endif
-
-#include "../../include/ext_periph_layer.h"
-#include "../../include/int_periph_layer.h"
-#include <stdint.h>
-#include <math.h>
-
-
-/**********************************************************************************/
-/*                                      Enums                                     */
-/**********************************************************************************/
-
-typedef enum {
-    SUCCESS = 0,
-    ERROR,
-    INVALID_PARAM
-} Status;
-
-typedef enum {
-    BIT_SET = 0,
-    BIT_RESET,
-    BIT_ERROR,
-    BIT_INVALID_PARAM
-} Bit_State;
-
-typedef enum {
-    HSI_CLOCK = 1,
-    HSE_CLOCK = 2,
-    PLL_CLOCK = 3
-} System_Clock_Source;
-
-typedef enum {
-    SYSTICK_UNIT_SEC = 0,
-    SYSTICK_UNIT_MILLI,
-    SYSTICK_UNIT_MICRO
-} Systick_Base_Unit;
-
-
-/**********************************************************************************/
-/*                                Global Constants                                */
-/**********************************************************************************/
-
-/********************************** System Clock **********************************/
-static const uint32_t HSI_FREQ_HZ      = 16000000U;
-static const uint32_t HSE_FREQ_HZ      = 25000000U;
-static const uint32_t LSI_FREQ_HZ      = 32000U;
-static const uint32_t LSE_FREQ_HZ      = 32768U;
-
-/*********************************** System Time **********************************/
-static const uint32_t SEC_TO_MILLI     = 1000U;
-static const uint32_t SEC_TO_MICRO     = 1000000U;
-static const uint32_t SEC_TO_NANO      = 1000000000U;
-
-/************************************* Timers *************************************/
-static const uint32_t TIM1_CNT_VAL_MAX = (0xFFFFUL);
-
-/*************************** Standard Bit Shift Divisors **************************/
-static const uint32_t DIV_BY_2         = 1U;
-static const uint32_t DIV_BY_4         = 2U;
-static const uint32_t DIV_BY_8         = 3U;
-static const uint32_t DIV_BY_16        = 4U;
-static const uint32_t DIV_BY_32        = 8U;
-
-
-/**********************************************************************************/
-/*                                 Constant Macros                                */
-/**********************************************************************************/
-
-/******************************* Standard Bit Masks *******************************/
-#define SET_ONE                     (0x01UL)
-#define SET_TWO                     (0x03UL)
-#define SET_THREE                   (0x07UL)
-#define SET_FOUR                    (0x0FUL)
-#define SET_FIVE                    (0x1FUL)
-#define SET_SIX                     (0x2FUL)
-#define SET_SEVEN                   (0x3FUL)
-#define SET_EIGHT                   (0x4FUL)
-
-
-/**********************************************************************************/
-/*                         Uninitialised Global Variables                         */
-/**********************************************************************************/
-
-/********************************** System Clock **********************************/
-System_Clock_Source                 g_sys_clk_source;
-uint32_t                            g_sys_clk_freq;
-volatile uint32_t                   g_systick_time;
-
-/************************************** TIM1 **************************************/
-volatile uint32_t                   g_tim1_time;
-volatile uint32_t                   g_tim1_subtime;
-volatile uint32_t                   g_tim1_subticks_per_tick;
-volatile float                      g_tim1_tick_time;
-volatile uint32_t                   g_curr_cc1;
-volatile uint32_t                   g_prev_cc1;
-volatile float                      g_pwm_input_pulse_width;
-volatile float                      g_pwm_input_period;
-volatile float                      g_pwm_input_duty_cycle;
-
-
-#define NVIC_PRIORITY_BITS          4U
-#define CLEAR_REGISTER              0UL
-
-uint8_t priority_tracker[256];
-
-
-/**********************************************************************************/
-/*                               Function Prototypes                              */
-/**********************************************************************************/
-
-/***************************** Reset and Clock Control ****************************/
-void   Peripheral_Reset    (void);
-Status System_Clock_Init   (System_Clock_Source clock_source);
-Status Systick_Init        (Systick_Base_Unit unit);
-Status Systick_Delay       (uint32_t time_delay);
-void   Delay_Loop          (uint32_t delay_duration_ms);
-
-/***************************** Integer Size Validation ****************************/
-Status Validate_uint8_t  (int value);
-Status Validate_uint16_t (int value);
-
-/********************** Nested Vectored Interrupt Controller **********************/
-Status   NVIC_Enable_IRQ        (IRQn_t IRQn);
-Status   NVIC_Disable_IRQ       (IRQn_t IRQn);
-uint32_t NVIC_Get_Enable_IRQ    (IRQn_t IRQn);
-Status   NVIC_Set_Pending_IRQ   (IRQn_t IRQn);
-Status   NVIC_Clear_Pending_IRQ (IRQn_t IRQn);
-uint32_t NVIC_Get_Pending_IRQ   (IRQn_t IRQn);
-uint32_t NVIC_Get_Active_IRQ    (IRQn_t IRQn);
-Status   NVIC_Set_Priority      (IRQn_t IRQn, uint32_t priority);
-uint32_t NVIC_Get_Priority      (IRQn_t IRQn);
-Status   Validate_Priority      (uint32_t priority);
-
-
-/**********************************************************************************/
-/*                          Inline Assembly Instructions                          */
-/**********************************************************************************/
-__attribute__((always_inline)) static inline void NOP(void) {
-    __asm__ volatile("nop");
-}
-
-__attribute__((always_inline)) static inline void WFI(void) {
-    __asm__ volatile("wfi");
-}
-
-__attribute__((always_inline)) static inline void DSB(void) {
-    __asm__ volatile("dsb":::"memory");
-}
-
-__attribute__((always_inline)) static inline void ENABLE_IRQ(void) {
-    __asm__ volatile("cpsie i":::"memory");
-}
-
-__attribute__((always_inline)) static inline void DISABLE_IRQ(void) {
-    __asm__ volatile("cpsid i":::"memory");
-}
-
-
-
-#ifdef __cplusplus
-    }
-#endif
-
+/* This header file contains prototypes of functions and macros common across all STM32 Blackpill projects */
+
+#ifndef __UTILS_H
+#define __UTILS_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../../include/ext_periph_layer.h"
+#include "../../include/int_periph_layer.h"
+#include <stdint.h>
+#include <math.h>
+
+
+/**********************************************************************************/
+/*                                      Enums                                     */
+/**********************************************************************************/
+
+typedef enum {
+    SUCCESS = 0,
+    ERROR,
+    INVALID_PARAM
+} Status;
+
+typedef enum {
+    BIT_SET = 0,
+    BIT_RESET,
+    BIT_ERROR,
+    BIT_INVALID_PARAM
+} Bit_State;
+
+typedef enum {
+    HSI_CLOCK = 1,
+    HSE_CLOCK = 2,
+    PLL_CLOCK = 3
+} System_Clock_Source;
+
+typedef enum {
+    PLL_STATE_IDLE = 0,
+    PLL_STATE_HSE_STARTING,
+    PLL_STATE_LOCKING,
+    PLL_STATE_LOCKED,
+    PLL_STATE_FAILED
+} System_Clock_PLL_State;
+
+typedef enum {
+    NVIC_CLASS_DEFAULT = 0,
+    NVIC_CLASS_SAFETY,
+    NVIC_CLASS_SERVO,
+    NVIC_CLASS_FEEDBACK,
+    NVIC_CLASS_TIMEBASE,
+    NVIC_CLASS_COMMS,
+    NVIC_CLASS_BACKGROUND,
+    NVIC_CLASS_DEFERRED
+} NVIC_Latency_Class;
+
+typedef void (*ISR_Handler_t)(void);
+
+typedef void (*Deferred_Work_t)(uint32_t argument);
+
+typedef enum {
+    SYSTICK_UNIT_SEC = 0,
+    SYSTICK_UNIT_MILLI,
+    SYSTICK_UNIT_MICRO
+} Systick_Base_Unit;
+
+
+/**********************************************************************************/
+/*                                Global Constants                                */
+/**********************************************************************************/
+
+/********************************** System Clock **********************************/
+static const uint32_t HSI_FREQ_HZ      = 16000000U;
+static const uint32_t HSE_FREQ_HZ      = 25000000U;
+static const uint32_t LSI_FREQ_HZ      = 32000U;
+static const uint32_t LSE_FREQ_HZ      = 32768U;
+static const uint32_t PLL_FREQ_HZ      = 96000000U;
+static const uint32_t CLOCK_TIMEOUT_US = 5000U;
+
+/*********************************** System Time **********************************/
+static const uint32_t SEC_TO_MILLI     = 1000U;
+static const uint32_t SEC_TO_MICRO     = 1000000U;
+static const uint32_t SEC_TO_NANO      = 1000000000U;
+
+/************************************* Timers *************************************/
+static const uint32_t TIM1_CNT_VAL_MAX = (0xFFFFUL);
+
+/*************************** Standard Bit Shift Divisors **************************/
+static const uint32_t DIV_BY_2         = 1U;
+static const uint32_t DIV_BY_4         = 2U;
+static const uint32_t DIV_BY_8         = 3U;
+static const uint32_t DIV_BY_16        = 4U;
+static const uint32_t DIV_BY_32        = 8U;
+
+
+/**********************************************************************************/
+/*                                 Constant Macros                                */
+/**********************************************************************************/
+
+/******************************* Standard Bit Masks *******************************/
+#define SET_ONE                     (0x01UL)
+#define SET_TWO                     (0x03UL)
+#define SET_THREE                   (0x07UL)
+#define SET_FOUR                    (0x0FUL)
+#define SET_FIVE                    (0x1FUL)
+#define SET_SIX                     (0x2FUL)
+#define SET_SEVEN                   (0x3FUL)
+#define SET_EIGHT                   (0x4FUL)
+
+
+/**********************************************************************************/
+/*                         Uninitialised Global Variables                         */
+/**********************************************************************************/
+
+/********************************** System Clock **********************************/
+System_Clock_Source                 g_sys_clk_source;
+uint32_t                            g_sys_clk_freq;
+uint32_t                            g_apb1_clk_freq;
+volatile uint32_t                   g_systick_time;
+
+/************************************** TIM1 **************************************/
+volatile uint32_t                   g_tim1_time;
+volatile uint32_t                   g_tim1_subtime;
+volatile uint32_t                   g_tim1_subticks_per_tick;
+volatile float                      g_tim1_tick_time;
+volatile uint32_t                   g_curr_cc1;
+volatile uint32_t                   g_prev_cc1;
+volatile float                      g_pwm_input_pulse_width;
+volatile float                      g_pwm_input_period;
+volatile float                      g_pwm_input_duty_cycle;
+volatile uint32_t                   g_pwm_input_sequence;
+
+
+#define NVIC_PRIORITY_BITS          4U
+#define NVIC_PREEMPT_BITS           3U
+#define NVIC_SUB_BITS               (NVIC_PRIORITY_BITS - NVIC_PREEMPT_BITS)
+#define NVIC_IRQ_COUNT              86U
+#define VECTOR_TABLE_SIZE           (16U + NVIC_IRQ_COUNT)
+#define VECTOR_TABLE_ALIGNMENT      512U
+#define CLEAR_REGISTER              0UL
+
+#ifndef DEFERRED_QUEUE_SIZE
+#define DEFERRED_QUEUE_SIZE         32U
+#endif
+#define DEFERRED_QUEUE_MASK         (DEFERRED_QUEUE_SIZE - 1U)
+
+
+/**********************************************************************************/
+/*                               Function Prototypes                              */
+/**********************************************************************************/
+
+/***************************** Reset and Clock Control ****************************/
+void                   Peripheral_Reset          (void);
+Status                 System_Clock_Init         (System_Clock_Source clock_source);
+Status                 System_Clock_PLL_Start    (void);
+System_Clock_PLL_State System_Clock_PLL_Poll     (void);
+Status                 System_Clock_Switch       (System_Clock_Source clock_source);
+uint8_t                System_Clock_HSE_Failed   (void);
+Status                 Systick_Init              (Systick_Base_Unit unit);
+Status                 Systick_Delay             (uint32_t time_delay);
+Status                 Systick_Register_Callback (ISR_Handler_t callback);
+void                   Delay_Loop                (uint32_t delay_duration_ms);
+
+/******************************** DWT Cycle Counter *******************************/
+void     Cycle_Counter_Init    (void);
+uint32_t Cycle_Counter_Get     (void);
+uint32_t Cycles_To_Nanoseconds (uint32_t cycles);
+
+/***************************** Integer Size Validation ****************************/
+Status Validate_uint8_t  (int value);
+Status Validate_uint16_t (int value);
+
+/********************** Nested Vectored Interrupt Controller **********************/
+Status   NVIC_Enable_IRQ        (IRQn_t IRQn);
+Status   NVIC_Disable_IRQ       (IRQn_t IRQn);
+uint32_t NVIC_Get_Enable_IRQ    (IRQn_t IRQn);
+Status   NVIC_Set_Pending_IRQ   (IRQn_t IRQn);
+Status   NVIC_Clear_Pending_IRQ (IRQn_t IRQn);
+uint32_t NVIC_Get_Pending_IRQ   (IRQn_t IRQn);
+uint32_t NVIC_Get_Active_IRQ    (IRQn_t IRQn);
+Status   NVIC_Set_Priority      (IRQn_t IRQn, uint32_t priority);
+uint32_t NVIC_Get_Priority      (IRQn_t IRQn);
+Status   Validate_Priority      (uint32_t priority);
+
+/************************** NVIC Priority Resource Manager ************************/
+void        NVIC_Priority_Grouping_Init (void);
+uint32_t    NVIC_Encode_Priority        (uint32_t preempt_priority, uint32_t sub_priority);
+Status      NVIC_Request_IRQ            (IRQn_t IRQn, NVIC_Latency_Class latency_class, const void *owner);
+Status      NVIC_Reserve_Priority       (IRQn_t IRQn, uint32_t preempt_priority, uint32_t sub_priority,
+                                         const void *owner);
+Status      NVIC_Release_IRQ            (IRQn_t IRQn, const void *owner);
+const void *NVIC_Get_Owner              (IRQn_t IRQn);
+uint32_t    NVIC_Class_To_BASEPRI       (NVIC_Latency_Class latency_class);
+
+/****************************** Vector Table Relocation ***************************/
+Status        Vector_Table_Relocate     (void);
+uint8_t       Vector_Table_Is_Relocated (void);
+Status        NVIC_Register_Handler     (IRQn_t IRQn, ISR_Handler_t handler);
+ISR_Handler_t NVIC_Get_Handler          (IRQn_t IRQn);
+
+/****************************** Deferred Interrupt Work ***************************/
+Status   Deferred_Init          (void);
+Status   Deferred_Post          (Deferred_Work_t work, uint32_t argument);
+void     Deferred_Run           (void);
+uint32_t Deferred_Get_Dropped   (void);
+
+
+/**********************************************************************************/
+/*                          Inline Assembly Instructions                          */
+/**********************************************************************************/
+__attribute__((always_inline)) static inline void NOP(void) {
+    __asm__ volatile("nop");
+}
+
+__attribute__((always_inline)) static inline void WFI(void) {
+    __asm__ volatile("wfi");
+}
+
+__attribute__((always_inline)) static inline void DSB(void) {
+    __asm__ volatile("dsb":::"memory");
+}
+
+__attribute__((always_inline)) static inline void DMB(void) {
+    __asm__ volatile("dmb":::"memory");
+}
+
+__attribute__((always_inline)) static inline void ISB(void) {
+    __asm__ volatile("isb":::"memory");
+}
+
+__attribute__((always_inline)) static inline void ENABLE_IRQ(void) {
+    __asm__ volatile("cpsie i":::"memory");
+}
+
+__attribute__((always_inline)) static inline void DISABLE_IRQ(void) {
+    __asm__ volatile("cpsid i":::"memory");
+}
+
+__attribute__((always_inline)) static inline uint32_t CLZ(uint32_t value) {
+    uint32_t result;
+    __asm__ volatile("clz %0, %1" : "=r" (result) : "r" (value));
+    return result;
+}
+
+
+/**********************************************************************************/
+/*                                Critical Sections                               */
+/**********************************************************************************/
+
+/* masks all configurable interrupts and returns the previous PRIMASK for ENTER/EXIT nesting */
+__attribute__((always_inline)) static inline uint32_t ENTER_CRITICAL(void) {
+    uint32_t primask;
+    __asm__ volatile("mrs %0, primask\n\tcpsid i" : "=r" (primask) :: "memory");
+    return primask;
+}
+
+__attribute__((always_inline)) static inline void EXIT_CRITICAL(uint32_t primask) {
+    __asm__ volatile("msr primask, %0" :: "r" (primask) : "memory");
+}
+
+/* masks interrupts at or below the BASEPRI value from NVIC_Class_To_BASEPRI, higher classes still preempt */
+__attribute__((always_inline)) static inline uint32_t ENTER_CRITICAL_BASEPRI(uint32_t basepri) {
+    uint32_t previous;
+    __asm__ volatile("mrs %0, basepri\n\tmsr basepri_max, %1" : "=&r" (previous) : "r" (basepri) : "memory");
+    return previous;
+}
+
+__attribute__((always_inline)) static inline void EXIT_CRITICAL_BASEPRI(uint32_t previous) {
+    __asm__ volatile("msr basepri, %0" :: "r" (previous) : "memory");
+}
+
+
+/**********************************************************************************/
+/*                           Exclusive Access Atomics                             */
+/**********************************************************************************/
+
+__attribute__((always_inline)) static inline uint32_t LDREX(volatile uint32_t *address) {
+    uint32_t value;
+    __asm__ volatile("ldrex %0, [%1]" : "=r" (value) : "r" (address) : "memory");
+    return value;
+}
+
+/* returns 0 if the store succeeded, 1 if exclusivity was lost */
+__attribute__((always_inline)) static inline uint32_t STREX(uint32_t value, volatile uint32_t *address) {
+    uint32_t result;
+    __asm__ volatile("strex %0, %2, [%1]" : "=&r" (result) : "r" (address), "r" (value) : "memory");
+    return result;
+}
+
+__attribute__((always_inline)) static inline void CLREX(void) {
+    __asm__ volatile("clrex":::"memory");
+}
+
+__attribute__((always_inline)) static inline uint32_t ATOMIC_ADD(volatile uint32_t *address, uint32_t value) {
+    uint32_t result;
+    do {
+        result = LDREX(address) + value;
+    } while (STREX(result, address));
+    return result;
+}
+
+__attribute__((always_inline)) static inline uint32_t ATOMIC_EXCHANGE(volatile uint32_t *address, uint32_t value) {
+    uint32_t previous;
+    do {
+        previous = LDREX(address);
+    } while (STREX(value, address));
+    return previous;
+}
+
+/* returns 1 if *address held expected and was replaced by desired, otherwise 0 */
+__attribute__((always_inline)) static inline uint32_t ATOMIC_CAS(volatile uint32_t *address, uint32_t expected,
+                                                                 uint32_t desired) {
+    do {
+        if (LDREX(address) != expected) {
+            CLREX();
+            return 0;
+        }
+    } while (STREX(desired, address));
+    return 1U;
+}
+
+__attribute__((always_inline)) static inline void ATOMIC_SET_BITS(volatile uint32_t *address, uint32_t mask) {
+    do {} while (STREX(LDREX(address) | mask, address));
+}
+
+__attribute__((always_inline)) static inline void ATOMIC_CLEAR_BITS(volatile uint32_t *address, uint32_t mask) {
+    do {} while (STREX(LDREX(address) & ~(mask), address));
+}
+
+
+
+#ifdef __cplusplus
+    }
+#endif
+
 #endif
\ No newline at end of file
@@ -1,39 +1,73 @@
-/* This program uses PWM output to control a servo motor */
-
-/* Local .bin path --> ~/projects/pwm_servo/.pio/build/blackpill_f411ce/firmware.bin */
-
-#include "main.h"
-
-int main(void) {
-    Peripheral_Reset();
-
-    System_Clock_Init(HSI_CLOCK);
-
-    GPIO_Config_t gpio_settings = {
-        .port = GPIOA,
-        .pin = GPIO_PIN_8,
-        .mode = GPIO_MODE_AF,
-        .alt_function = GPIO_AF_1,
-        .output_type = GPIO_OUTPUT_PUSH_PULL,
-        .output_speed = GPIO_OUTPUT_SPEED_HIGH,
-    };
-
-    GPIO_Init(&gpio_settings);
-
-    TIM1_CNT_Config_t tim1_cnt_settings = {
-        .auto_reload = 1000UL,
-        .prescaler = 16UL      
-    };
-
-    TIM1_CNT_Init(&tim1_cnt_settings);
-    TIM1_Servo_Init(TIM1_CHANNEL_1);
-
-    while(1) {
-        TIM1_Servo_Set_Position(TIM1_CHANNEL_1, 30);
-        Delay_Loop(3000);
-        TIM1_Servo_Set_Position(TIM1_CHANNEL_1, 90);
-        Delay_Loop(3000);
-        TIM1_Servo_Set_Position(TIM1_CHANNEL_1, 120);
-        Delay_Loop(3000);
-    }
+/* This program uses PWM output to control a servo motor */
+
+/* Local .bin path --> ~/projects/pwm_servo/.pio/build/blackpill_f411ce/firmware.bin */
+
+#include "main.h"
+
+static const GPIO_Config_t board_pins[] = {
+    {
+        .port = GPIOA,
+        .pin = GPIO_PIN_8,
+        .mode = GPIO_MODE_AF,
+        .alt_function = GPIO_AF_1,
+        .output_type = GPIO_OUTPUT_PUSH_PULL,
+        .output_speed = GPIO_OUTPUT_SPEED_HIGH,
+    },
+};
+
+static TIM1_CNT_Config_t board_timer = {
+    .auto_reload = 1000UL,
+    .prescaler = 16UL,
+    .interrupt_enable = TIM1_INTERRUPT_ENABLED
+};
+
+static const TIM1_Channel board_servos[] = {TIM1_CHANNEL_1};
+
+static const Board_Config_t board = {
+    .pins = board_pins,
+    .pin_count = sizeof(board_pins) / sizeof(board_pins[0]),
+    .timer = &board_timer,
+    .servo_channels = board_servos,
+    .servo_channel_count = sizeof(board_servos) / sizeof(board_servos[0]),
+};
+
+static const Boot_Config_t boot = {
+    .board = &board,
+    .mode = BOOT_MODE_FAST_START,
+    .clock_source = PLL_CLOCK,
+};
+
+static void Idle_Frames(uint32_t frames) {
+    uint32_t start = g_tim1_time;
+    while ((g_tim1_time - start) < frames) {
+        Power_Idle();
+    }
+}
+
+static const Servo_Axis_Config_t board_axis = {
+    .backend = SERVO_BACKEND_TIM1,
+    .tim1_channel = TIM1_CHANNEL_1,
+};
+
+int main(void) {
+    //a board that failed to come up is left with its outputs off
+    if (Boot_Start(&boot) != SUCCESS) {
+        while (1) {}
+    }
+
+    while (Boot_Poll() == BOOT_STATE_PENDING) {}
+
+    Power_Init(0);
+
+    uint8_t axis;
+    Servo_Register(&board_axis, &axis);
+
+    while(1) {
+        Servo_Set_Position(axis, 30);
+        Idle_Frames(150);
+        Servo_Set_Position(axis, 90);
+        Idle_Frames(150);
+        Servo_Set_Position(axis, 120);
+        Idle_Frames(150);
+    }
 }
\ No newline at end of file
@@ -1,22 +1,26 @@
-/* start header guard */
-#ifndef __MAIN_H
-#define __MAIN_H
-
-/* start C linkage for C++ compiler */
-#ifdef __cplusplus
-    extern "C" {
-#endif
-
-
-#include "../lib/drivers/gpio/gpio.h"
-#include "../lib/drivers/tim1/tim1.h"
-
-
-/* end C linkage and return to C++ linkage */
-#ifdef __cplusplus
-    }
-#endif
-
-/* end header guard */
-#endif
-
+/* start header guard */
+#ifndef __MAIN_H
+#define __MAIN_H
+
+/* start C linkage for C++ compiler */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+
+#include "../lib/drivers/gpio/gpio.h"
+#include "../lib/drivers/tim1/tim1.h"
+#include "../lib/board/board.h"
+#include "../lib/boot/boot.h"
+#include "../lib/power/power.h"
+#include "../lib/servo/servo.h"
+
+
+/* end C linkage and return to C++ linkage */
+#ifdef __cplusplus
+    }
+#endif
+
+/* end header guard */
+#endif
+
@@ -0,0 +1,120 @@
+#include <stdio.h>
+#include <unity.h>
+
+#include "../../../lib/utils/utils.h"
+#include "../../../lib/interpolation/interpolation.h"
+
+/**********************************************************************************/
+/*                                 Static Variables                               */
+/**********************************************************************************/
+
+#define BENCH_STEPS                 50U
+
+static Interpolation_t bench_interpolation;
+static float           bench_output[INTERPOLATION_MAX_AXES];
+
+
+/**********************************************************************************/
+/*                                 Bench Helpers                                  */
+/**********************************************************************************/
+
+static void Bench_Load(uint8_t axis_count) {
+    float p0[INTERPOLATION_MAX_AXES], p1[INTERPOLATION_MAX_AXES];
+    float m0[INTERPOLATION_MAX_AXES], m1[INTERPOLATION_MAX_AXES];
+    for (uint8_t axis = 0; axis < INTERPOLATION_MAX_AXES; axis++) {
+        p0[axis] = (10.0f * axis);
+        p1[axis] = (180.0f - (7.0f * axis));
+        m0[axis] = (35.0f - (5.0f * axis));
+        m1[axis] = ((3.0f * axis) - 20.0f);
+    }
+
+    TEST_ASSERT_EQUAL(SUCCESS, Interpolation_Init(&bench_interpolation, axis_count));
+    TEST_ASSERT_EQUAL(SUCCESS, Interpolation_Set_Hermite(&bench_interpolation, p0, p1, m0, m1));
+}
+
+static void Bench_Report(const char *name, uint8_t axis_count, uint32_t cycles) {
+    char message[80];
+    snprintf(message, sizeof(message), "%s, %u axes: %lu cycles/frame, %lu ns/frame", name,
+             (unsigned) axis_count, (unsigned long) cycles, (unsigned long) Cycles_To_Nanoseconds(cycles));
+    TEST_MESSAGE(message);
+}
+
+/* cycles per frame of a segment stepped by forward differencing, including its start */
+static void Bench_Step(uint8_t axis_count) {
+    Bench_Load(axis_count);
+
+    uint32_t start = Cycle_Counter_Get();
+    Interpolation_Start(&bench_interpolation, 0, (1.0f / BENCH_STEPS));
+    for (uint32_t i = 0; i < BENCH_STEPS; i++) {
+        Interpolation_Step(&bench_interpolation, bench_output);
+    }
+    uint32_t cycles = (Cycle_Counter_Get() - start);
+
+    Bench_Report("step", axis_count, (cycles / BENCH_STEPS));
+}
+
+/* cycles per frame of the same segment evaluated in full at every frame */
+static void Bench_Evaluate(uint8_t axis_count) {
+    Bench_Load(axis_count);
+
+    uint32_t start = Cycle_Counter_Get();
+    for (uint32_t i = 0; i < BENCH_STEPS; i++) {
+        Interpolation_Evaluate(&bench_interpolation, ((float) i / BENCH_STEPS), bench_output);
+    }
+    uint32_t cycles = (Cycle_Counter_Get() - start);
+
+    Bench_Report("evaluate", axis_count, (cycles / BENCH_STEPS));
+}
+
+
+/**********************************************************************************/
+/*                                   Benchmarks                                   */
+/**********************************************************************************/
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+static void test_step_matches_evaluate_on_target(void) {
+    float exact[INTERPOLATION_MAX_AXES];
+    Bench_Load(INTERPOLATION_MAX_AXES);
+
+    //single precision FPU arithmetic stays within a thousandth of a degree over a segment
+    Interpolation_Start(&bench_interpolation, 0, (1.0f / BENCH_STEPS));
+    for (uint32_t i = 0; i < BENCH_STEPS; i++) {
+        Interpolation_Step(&bench_interpolation, bench_output);
+        Interpolation_Evaluate(&bench_interpolation, ((float) i / BENCH_STEPS), exact);
+        for (uint8_t axis = 0; axis < INTERPOLATION_MAX_AXES; axis++) {
+            TEST_ASSERT_FLOAT_WITHIN(1e-3f, exact[axis], bench_output[axis]);
+        }
+    }
+}
+
+static void test_bench_one_axis(void) {
+    Bench_Step(1U);
+    Bench_Evaluate(1U);
+}
+
+static void test_bench_four_axes(void) {
+    Bench_Step(4U);
+    Bench_Evaluate(4U);
+}
+
+static void test_bench_all_axes(void) {
+    Bench_Step(INTERPOLATION_MAX_AXES);
+    Bench_Evaluate(INTERPOLATION_MAX_AXES);
+}
+
+int main(void) {
+    System_Clock_Init(PLL_CLOCK);
+    Cycle_Counter_Init();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_step_matches_evaluate_on_target);
+    RUN_TEST(test_bench_one_axis);
+    RUN_TEST(test_bench_four_axes);
+    RUN_TEST(test_bench_all_axes);
+    return UNITY_END();
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+#include "unity_config.h"
+#include "../../lib/drivers/gpio/gpio.h"
+#include "../../lib/drivers/usart/usart.h"
+
+/**********************************************************************************/
+/*                                 Static Variables                               */
+/**********************************************************************************/
+
+static USART_Init_Config_t unity_usart = {.instance = USART1};
+
+/* output is sent a line at a time */
+static uint8_t             unity_line[64];
+static uint16_t            unity_length = 0;
+
+
+/**********************************************************************************/
+/*                             Unity Output Functions                             */
+/**********************************************************************************/
+
+/**
+ * @brief  Starts USART1 on PA9 for test output
+ * @note   Assumes the system clock is set before UNITY_BEGIN, as the baud rate divider is
+ *         taken from it
+ */
+void unityOutputStart(unsigned long baudrate) {
+    GPIO_Config_t tx_gpio = {
+        .port         = GPIOA,
+        .pin          = GPIO_PIN_9,
+        .mode         = GPIO_MODE_AF,
+        .output_type  = GPIO_OUTPUT_PUSH_PULL,
+        .output_speed = GPIO_OUTPUT_SPEED_HIGH,
+        .alt_function = GPIO_AF_7
+    };
+    GPIO_Init(&tx_gpio);
+
+    unity_usart.baud_rate = (uint32_t) baudrate;
+    USART_Init(&unity_usart);
+    unity_length = 0;
+}
+
+void unityOutputChar(unsigned int c) {
+    unity_line[unity_length++] = (uint8_t) c;
+    if (c == '\n' || unity_length >= sizeof(unity_line)) {
+        unityOutputFlush();
+    }
+}
+
+/** @brief  Sends the buffered line and waits for it to leave, so the buffer can be reused */
+void unityOutputFlush(void) {
+    if (!unity_length) {
+        return;
+    }
+
+    while (USART_Transmit(&unity_usart, unity_line, unity_length) != SUCCESS);
+    while (USART_Get_TX_Status(USART1) != USART_IDLE);
+    unity_length = 0;
+}
+
+void unityOutputComplete(void) {
+    unityOutputFlush();
+}
\ No newline at end of file
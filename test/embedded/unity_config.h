@@ -0,0 +1,34 @@
+#ifndef __UNITY_CONFIG_H
+#define __UNITY_CONFIG_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+
+/**********************************************************************************/
+/*                                     Defines                                    */
+/**********************************************************************************/
+
+/* test output is sent on USART1 TX (PA9) at the test monitor speed */
+#define UNITY_OUTPUT_START()        unityOutputStart((unsigned long) 115200)
+#define UNITY_OUTPUT_CHAR(c)        unityOutputChar(c)
+#define UNITY_OUTPUT_FLUSH()        unityOutputFlush()
+#define UNITY_OUTPUT_COMPLETE()     unityOutputComplete()
+
+
+/**********************************************************************************/
+/*                               Function Prototypes                              */
+/**********************************************************************************/
+
+void unityOutputStart       (unsigned long baudrate);
+void unityOutputChar        (unsigned int c);
+void unityOutputFlush       (void);
+void unityOutputComplete    (void);
+
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,177 @@
+#include <stdio.h>
+#include <time.h>
+#include <unity.h>
+
+#include "../../../lib/interpolation/interpolation.c"
+
+/**********************************************************************************/
+/*                                 Static Variables                               */
+/**********************************************************************************/
+
+#define TEST_AXES                   INTERPOLATION_MAX_AXES
+#define TEST_STEPS                  50U
+#define TEST_BENCH_SEGMENTS         20000U
+
+static Interpolation_t test_interpolation;
+static float           test_p0[TEST_AXES];
+static float           test_p1[TEST_AXES];
+static float           test_m0[TEST_AXES];
+static float           test_m1[TEST_AXES];
+
+/* written by the benchmarks so the loops are not optimised away */
+static volatile float  test_sink;
+
+
+/**********************************************************************************/
+/*                                 Test Helpers                                   */
+/**********************************************************************************/
+
+static void Test_Load_Hermite(void) {
+    for (uint8_t axis = 0; axis < TEST_AXES; axis++) {
+        test_p0[axis] = (10.0f * axis);
+        test_p1[axis] = (180.0f - (7.0f * axis));
+        test_m0[axis] = (35.0f - (5.0f * axis));
+        test_m1[axis] = ((3.0f * axis) - 20.0f);
+    }
+    TEST_ASSERT_EQUAL(SUCCESS, Interpolation_Set_Hermite(&test_interpolation, test_p0, test_p1, test_m0, test_m1));
+}
+
+/* largest gap between forward differencing and direct evaluation over steps frames */
+static float Test_Step_Error(float start, uint32_t steps) {
+    float step  = ((1.0f - start) / (float) steps);
+    float error = 0;
+    float stepped[TEST_AXES];
+    float exact[TEST_AXES];
+
+    Interpolation_Start(&test_interpolation, start, step);
+    for (uint32_t i = 0; i < steps; i++) {
+        Interpolation_Step(&test_interpolation, stepped);
+        Interpolation_Evaluate(&test_interpolation, (start + (step * (float) i)), exact);
+        for (uint8_t axis = 0; axis < test_interpolation.axis_count; axis++) {
+            float difference = (stepped[axis] > exact[axis]) ? (stepped[axis] - exact[axis])
+                                                             : (exact[axis] - stepped[axis]);
+            error = (difference > error) ? difference : error;
+        }
+    }
+
+    return error;
+}
+
+static double Test_Seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((double) now.tv_sec + ((double) now.tv_nsec * 1e-9));
+}
+
+
+/**********************************************************************************/
+/*                                     Tests                                      */
+/**********************************************************************************/
+
+void setUp(void) {
+    TEST_ASSERT_EQUAL(SUCCESS, Interpolation_Init(&test_interpolation, TEST_AXES));
+}
+
+void tearDown(void) {
+}
+
+static void test_init_rejects_axis_count(void) {
+    TEST_ASSERT_EQUAL(INVALID_PARAM, Interpolation_Init(&test_interpolation, 0));
+    TEST_ASSERT_EQUAL(INVALID_PARAM, Interpolation_Init(&test_interpolation, (INTERPOLATION_MAX_AXES + 1U)));
+    TEST_ASSERT_EQUAL(INVALID_PARAM, Interpolation_Start(&test_interpolation, 0, 0));
+}
+
+static void test_hermite_meets_end_points_and_tangents(void) {
+    float output[TEST_AXES];
+    Test_Load_Hermite();
+
+    Interpolation_Evaluate(&test_interpolation, 0, output);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, test_p0[3], output[3]);
+    Interpolation_Evaluate(&test_interpolation, 1.0f, output);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, test_p1[3], output[3]);
+
+    Interpolation_Evaluate_Tangent(&test_interpolation, 0, output);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, test_m0[3], output[3]);
+    Interpolation_Evaluate_Tangent(&test_interpolation, 1.0f, output);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, test_m1[3], output[3]);
+}
+
+static void test_catmull_rom_and_bezier_pass_through_end_points(void) {
+    float p_prev[TEST_AXES], p0[TEST_AXES], p1[TEST_AXES], p_next[TEST_AXES], output[TEST_AXES];
+    for (uint8_t axis = 0; axis < TEST_AXES; axis++) {
+        p_prev[axis] = 0;
+        p0[axis]     = 30.0f;
+        p1[axis]     = 90.0f;
+        p_next[axis] = (100.0f + axis);
+    }
+
+    Interpolation_Set_Catmull_Rom(&test_interpolation, p_prev, p0, p1, p_next);
+    Interpolation_Evaluate(&test_interpolation, 1.0f, output);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 90.0f, output[5]);
+    Interpolation_Evaluate_Tangent(&test_interpolation, 1.0f, output);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, ((105.0f - 30.0f) * 0.5f), output[5]);
+
+    //control points at the thirds give a straight line at constant speed
+    float c0[TEST_AXES], c1[TEST_AXES];
+    for (uint8_t axis = 0; axis < TEST_AXES; axis++) {
+        c0[axis] = 50.0f;
+        c1[axis] = 70.0f;
+    }
+    Interpolation_Set_Bezier(&test_interpolation, p0, c0, c1, p1);
+    Interpolation_Evaluate(&test_interpolation, 0.25f, output);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 45.0f, output[0]);
+    Interpolation_Evaluate_Tangent(&test_interpolation, 0.75f, output);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 60.0f, output[0]);
+}
+
+static void test_step_tracks_evaluate(void) {
+    Test_Load_Hermite();
+
+    //a whole segment of frames, and one started part way through as the trajectory does
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 0, Test_Step_Error(0, TEST_STEPS));
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 0, Test_Step_Error(0.37f, TEST_STEPS));
+
+    //error grows with the step count, a thousand frames is still well inside a hundredth of a degree
+    TEST_ASSERT_FLOAT_WITHIN(1e-2f, 0, Test_Step_Error(0, 1000U));
+}
+
+static void test_benchmark_step_against_evaluate(void) {
+    char    message[128];
+    float   output[TEST_AXES];
+    Test_Load_Hermite();
+
+    //one segment of TEST_STEPS frames, stepped or evaluated in full at every frame
+    double start = Test_Seconds();
+    for (uint32_t segment = 0; segment < TEST_BENCH_SEGMENTS; segment++) {
+        Interpolation_Start(&test_interpolation, 0, (1.0f / TEST_STEPS));
+        for (uint32_t i = 0; i < TEST_STEPS; i++) {
+            Interpolation_Step(&test_interpolation, output);
+        }
+        test_sink = output[segment % TEST_AXES];
+    }
+    double step_s = (Test_Seconds() - start);
+
+    start = Test_Seconds();
+    for (uint32_t segment = 0; segment < TEST_BENCH_SEGMENTS; segment++) {
+        for (uint32_t i = 0; i < TEST_STEPS; i++) {
+            Interpolation_Evaluate(&test_interpolation, ((float) i / TEST_STEPS), output);
+        }
+        test_sink = output[segment % TEST_AXES];
+    }
+    double evaluate_s = (Test_Seconds() - start);
+
+    double frames = ((double) TEST_BENCH_SEGMENTS * TEST_STEPS);
+    snprintf(message, sizeof(message), "%u axes: step %.1f ns/frame, evaluate %.1f ns/frame",
+             (unsigned) TEST_AXES, ((step_s * 1e9) / frames), ((evaluate_s * 1e9) / frames));
+    TEST_MESSAGE(message);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_init_rejects_axis_count);
+    RUN_TEST(test_hermite_meets_end_points_and_tangents);
+    RUN_TEST(test_catmull_rom_and_bezier_pass_through_end_points);
+    RUN_TEST(test_step_tracks_evaluate);
+    RUN_TEST(test_benchmark_step_against_evaluate);
+    return UNITY_END();
+}
\ No newline at end of file
@@ -0,0 +1,209 @@
+#include <unity.h>
+
+#include "../../../lib/safety/safety.h"
+
+/**********************************************************************************/
+/*                               Simulated Peripheral                             */
+/**********************************************************************************/
+
+/* registers are plain memory, the test plays the timer's side of a break event */
+static TIM_t                  sim_tim1;
+static RCC_t                  sim_rcc;
+static DWT_t                  sim_dwt;
+static GPIO_t                 sim_gpioa;
+static GPIO_t                 sim_gpiob;
+static uint32_t               sim_cycles;
+
+/* PRIMASK, and how many times the break handler ran */
+static uint32_t               sim_primask;
+static uint32_t               sim_break_irqs;
+
+void TIM1_BRK_TIM9_IRQHandler(void);
+
+/* a pending break interrupt is taken as soon as it is unmasked */
+static void Sim_Break_Dispatch(void) {
+    if (!sim_primask && (sim_tim1.SR & TIM_SR_BIF) && (sim_tim1.DIER & TIM_DIER_BIE)) {
+        sim_break_irqs++;
+        TIM1_BRK_TIM9_IRQHandler();
+    }
+}
+
+/* the break event disables the outputs and sets BIF, then EGR reads back as zero */
+static void Sim_Break_Event(void) {
+    sim_tim1.BDTR &= ~(TIM_BDTR_MOE);
+    sim_tim1.SR   |= TIM_SR_BIF;
+    Sim_Break_Dispatch();
+}
+
+static uint32_t Sim_Enter_Critical(void) {
+    uint32_t primask = sim_primask;
+    sim_primask = 1U;
+    return primask;
+}
+
+static void Sim_Exit_Critical(uint32_t primask) {
+    sim_primask = primask;
+    Sim_Break_Dispatch();
+}
+
+#undef  TIM1
+#undef  RCC
+#undef  DWT
+#undef  GPIOA
+#undef  GPIOB
+#define TIM1                        (&sim_tim1)
+#define RCC                         (&sim_rcc)
+#define DWT                         (&sim_dwt)
+#define GPIOA                       (&sim_gpioa)
+#define GPIOB                       (&sim_gpiob)
+
+#define ENTER_CRITICAL()            Sim_Enter_Critical()
+#define EXIT_CRITICAL(primask)      Sim_Exit_Critical(primask)
+#define DSB()                       ((void) 0)
+
+#include "../../../lib/safety/safety.c"
+
+
+/**********************************************************************************/
+/*                                 Driver Stubs                                   */
+/**********************************************************************************/
+
+static EXTI_Callback_t test_exti_callback;
+
+uint32_t Cycle_Counter_Get(void) {
+    sim_cycles += 10U;
+    return sim_cycles;
+}
+
+void Cycle_Counter_Init(void) {
+    sim_dwt.CTRL |= DWT_CTRL_CYCCNTENA;
+}
+
+Status NVIC_Request_IRQ(IRQn_t IRQn, NVIC_Latency_Class latency_class, const void *owner) {
+    (void) IRQn; (void) latency_class; (void) owner;
+    return SUCCESS;
+}
+
+Status NVIC_Enable_IRQ(IRQn_t IRQn) {
+    (void) IRQn;
+    return SUCCESS;
+}
+
+Status GPIO_Init(GPIO_Config_t *gpio_config) {
+    (void) gpio_config;
+    return SUCCESS;
+}
+
+/* every input idles high and is active low */
+Bit_State GPIO_Read_Pin(GPIO_t *port, GPIO_Pin pin) {
+    (void) port; (void) pin;
+    return BIT_SET;
+}
+
+Status EXTI_Init(EXTI_Config_t *exti_config) {
+    test_exti_callback = exti_config->callback;
+    return SUCCESS;
+}
+
+uint32_t EXTI_Get_Entry_Cycles(void) {
+    return sim_cycles;
+}
+
+/* the lock follows the break generation in the trip, so the event lands here */
+Status TIM1_Set_Output_Lock(uint8_t locked) {
+    if (locked && (sim_tim1.EGR & TIM_EGR_BG)) {
+        sim_tim1.EGR = 0;
+        Sim_Break_Event();
+    }
+    return SUCCESS;
+}
+
+static Safety_Input_t  test_inputs[] = {
+    {.port = &sim_gpioa, .pin = GPIO_PIN_3, .type = SAFETY_INPUT_ESTOP, .active_level = SAFETY_ACTIVE_LOW}
+};
+static Safety_Config_t test_config   = {.inputs = test_inputs, .input_count = 1U};
+
+
+/**********************************************************************************/
+/*                                     Tests                                      */
+/**********************************************************************************/
+
+void setUp(void) {
+    sim_tim1       = (TIM_t) {0};
+    sim_primask    = 0;
+    sim_break_irqs = 0;
+    TEST_ASSERT_EQUAL(SUCCESS, Safety_Init(&test_config));
+    sim_tim1.BDTR |= TIM_BDTR_MOE;
+}
+
+void tearDown(void) {
+}
+
+static void test_software_trip_latches_caller_fault(void) {
+    Safety_Status_t status;
+    Safety_Trip(SAFETY_FAULT_LIMIT_SWITCH, GPIO_PIN_7);
+
+    //the break handler still runs once unmasked, but leaves the latched trip alone
+    TEST_ASSERT_EQUAL_UINT32(1U, sim_break_irqs);
+    TEST_ASSERT_EQUAL(SUCCESS, Safety_Get_Status(&status));
+    TEST_ASSERT_EQUAL(SAFETY_FAULT_LIMIT_SWITCH, status.fault);
+    TEST_ASSERT_EQUAL(GPIO_PIN_7, status.pin);
+    TEST_ASSERT_EQUAL_UINT32(1U, status.trip_count);
+    TEST_ASSERT_NOT_EQUAL(0, status.latency_cycles);
+    TEST_ASSERT_FALSE(sim_tim1.BDTR & TIM_BDTR_MOE);
+}
+
+static void test_later_trips_count_without_relatching(void) {
+    Safety_Status_t status;
+    Safety_Trip(SAFETY_FAULT_ESTOP, GPIO_PIN_1);
+    Safety_Trip(SAFETY_FAULT_LIMIT_SWITCH, GPIO_PIN_2);
+
+    Safety_Get_Status(&status);
+    TEST_ASSERT_EQUAL(SAFETY_FAULT_ESTOP, status.fault);
+    TEST_ASSERT_EQUAL(GPIO_PIN_1, status.pin);
+    TEST_ASSERT_EQUAL_UINT32(2U, status.trip_count);
+}
+
+static void test_break_input_latches_its_own_fault(void) {
+    Safety_Status_t status;
+    Sim_Break_Event();
+
+    Safety_Get_Status(&status);
+    TEST_ASSERT_EQUAL(SAFETY_FAULT_BREAK_INPUT, status.fault);
+    TEST_ASSERT_EQUAL_UINT32(1U, status.trip_count);
+    TEST_ASSERT_FALSE(sim_tim1.DIER & TIM_DIER_BIE);
+}
+
+static void test_exti_trip_latches_input_type(void) {
+    Safety_Status_t status;
+    test_exti_callback(GPIO_PIN_3);
+
+    Safety_Get_Status(&status);
+    TEST_ASSERT_EQUAL(SAFETY_FAULT_ESTOP, status.fault);
+    TEST_ASSERT_EQUAL(GPIO_PIN_3, status.pin);
+    TEST_ASSERT_EQUAL_UINT32(1U, status.trip_count);
+}
+
+static void test_clear_fault_rearms_trip(void) {
+    Safety_Status_t status;
+    Safety_Trip(SAFETY_FAULT_ESTOP, GPIO_PIN_1);
+
+    TEST_ASSERT_EQUAL(SUCCESS, Safety_Clear_Fault());
+    TEST_ASSERT_EQUAL(SAFETY_FAULT_NONE, Safety_Get_Fault());
+    TEST_ASSERT_TRUE(sim_tim1.DIER & TIM_DIER_BIE);
+
+    Safety_Trip(SAFETY_FAULT_LIMIT_SWITCH, GPIO_PIN_2);
+    Safety_Get_Status(&status);
+    TEST_ASSERT_EQUAL(SAFETY_FAULT_LIMIT_SWITCH, status.fault);
+    TEST_ASSERT_EQUAL_UINT32(2U, status.trip_count);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_software_trip_latches_caller_fault);
+    RUN_TEST(test_later_trips_count_without_relatching);
+    RUN_TEST(test_break_input_latches_its_own_fault);
+    RUN_TEST(test_exti_trip_latches_input_type);
+    RUN_TEST(test_clear_fault_rearms_trip);
+    return UNITY_END();
+}
\ No newline at end of file
@@ -0,0 +1,310 @@
+#include <string.h>
+#include <unity.h>
+
+#include "../../../lib/interpolation/interpolation.c"
+#include "../../../lib/trajectory/trajectory.c"
+
+/**********************************************************************************/
+/*                                 Static Variables                               */
+/**********************************************************************************/
+
+#define TEST_AXES                   2U
+#define TEST_TARGET_FILL            16U
+
+static USART_Init_Config_t test_usart = {.instance = USART1, .baud_rate = 115200U};
+static const uint8_t       test_axes[TEST_AXES] = {0, 1U};
+static Trajectory_Config_t test_config;
+
+/* bytes waiting to be read from the simulated receive ring */
+static uint8_t             test_rx[TRAJECTORY_DEPTH * TRAJECTORY_FRAME_SIZE];
+static uint16_t            test_rx_length;
+static uint16_t            test_rx_read;
+
+/* reports sent by the device, and whether the transmitter is reported busy */
+static uint8_t             test_report[TRAJECTORY_REPORT_SIZE];
+static uint32_t            test_reports;
+static USART_Status        test_tx_status;
+
+static Deferred_Work_t     test_posted;
+
+/* first axis of the last positions sent to the servos */
+static float               test_degrees;
+
+
+/**********************************************************************************/
+/*                                 Driver Stubs                                   */
+/**********************************************************************************/
+
+Status USART_Register_Notify(USART_t *instance, Deferred_Work_t tx_notify, Deferred_Work_t rx_notify,
+                             uint32_t argument) {
+    (void) instance; (void) tx_notify; (void) rx_notify; (void) argument;
+    return SUCCESS;
+}
+
+Status USART_Receive_Continuous(USART_Init_Config_t *init_config, uint8_t *ring, uint16_t ring_size) {
+    (void) init_config; (void) ring; (void) ring_size;
+    return SUCCESS;
+}
+
+uint16_t USART_Read(USART_t *instance, uint8_t *data, uint16_t length) {
+    (void) instance;
+    uint16_t count = 0;
+    while (test_rx_read < test_rx_length && count < length) {
+        data[count++] = test_rx[test_rx_read++];
+    }
+    return count;
+}
+
+USART_Status USART_Get_TX_Status(USART_t *instance) {
+    (void) instance;
+    return test_tx_status;
+}
+
+Status USART_Transmit(USART_Init_Config_t *init_config, uint8_t *tx_data, uint16_t tx_length) {
+    (void) init_config;
+    memcpy(test_report, tx_data, (tx_length < TRAJECTORY_REPORT_SIZE) ? tx_length : TRAJECTORY_REPORT_SIZE);
+    test_reports++;
+    return SUCCESS;
+}
+
+Status Servo_Set_Positions(const uint8_t *axes, const float *degrees, uint8_t count) {
+    (void) axes; (void) count;
+    test_degrees = degrees[0];
+    return SUCCESS;
+}
+
+uint8_t Servo_Get_Axis_Count(void) {
+    return TEST_AXES;
+}
+
+Status TIM1_Register_Update_Callback(void (*callback)(void)) {
+    (void) callback;
+    return SUCCESS;
+}
+
+Status Deferred_Post(Deferred_Work_t work, uint32_t argument) {
+    (void) argument;
+    test_posted = work;
+    return SUCCESS;
+}
+
+
+/**********************************************************************************/
+/*                                 Test Helpers                                   */
+/**********************************************************************************/
+
+static void Test_Queue_Frame(uint8_t type, uint8_t sequence, uint32_t time_ms, uint16_t position) {
+    uint8_t frame[TRAJECTORY_FRAME_SIZE] = {0};
+    frame[0] = TRAJECTORY_SYNC;
+    frame[1] = type;
+    frame[2] = sequence;
+    frame[4] = (uint8_t) (time_ms & 0xFFU);
+    frame[5] = (uint8_t) ((time_ms >> 8U) & 0xFFU);
+    frame[6] = (uint8_t) ((time_ms >> 16U) & 0xFFU);
+    frame[7] = (uint8_t) ((time_ms >> 24U) & 0xFFU);
+    for (uint8_t axis = 0; axis < TEST_AXES; axis++) {
+        frame[8U + (axis * 2U)] = (uint8_t) (position & 0xFFU);
+        frame[9U + (axis * 2U)] = (uint8_t) (position >> 8U);
+    }
+    uint16_t checksum = Trajectory_Checksum(frame, (TRAJECTORY_FRAME_SIZE - 2U));
+    frame[TRAJECTORY_FRAME_SIZE - 2U] = (uint8_t) (checksum & 0xFFU);
+    frame[TRAJECTORY_FRAME_SIZE - 1U] = (uint8_t) (checksum >> 8U);
+
+    TEST_ASSERT_TRUE((test_rx_length + TRAJECTORY_FRAME_SIZE) <= sizeof(test_rx));
+    memcpy(&test_rx[test_rx_length], frame, TRAJECTORY_FRAME_SIZE);
+    test_rx_length += TRAJECTORY_FRAME_SIZE;
+}
+
+static void Test_Queue_Sample(uint8_t sequence) {
+    Test_Queue_Frame(TRAJECTORY_FRAME_SAMPLE, sequence, (uint32_t) sequence * 20U, 9000U);
+}
+
+static void Test_Receive(void) {
+    Trajectory_RX_Done(0);
+}
+
+static void Test_Play_Frame(void) {
+    g_tim1_time++;
+    Trajectory_Step(0);
+}
+
+static uint8_t Test_Report_Credit(void) {
+    return test_report[2];
+}
+
+static uint8_t Test_Report_Expected(void) {
+    return test_report[4];
+}
+
+static uint8_t Test_Report_Rejected(void) {
+    return test_report[5];
+}
+
+
+/**********************************************************************************/
+/*                                     Tests                                      */
+/**********************************************************************************/
+
+void setUp(void) {
+    test_rx_length = 0;
+    test_rx_read   = 0;
+    test_reports   = 0;
+    test_tx_status = USART_IDLE;
+    test_posted    = 0;
+    test_degrees   = 0;
+    g_tim1_time    = 0;
+    memset(test_report, 0, sizeof(test_report));
+
+    test_config = (Trajectory_Config_t) {
+        .usart       = &test_usart,
+        .axes        = test_axes,
+        .axis_count  = TEST_AXES,
+        .target_fill = TEST_TARGET_FILL,
+        .frame_us    = 20000U
+    };
+    TEST_ASSERT_EQUAL(SUCCESS, Trajectory_Init(&test_config));
+}
+
+void tearDown(void) {
+}
+
+static void test_init_grants_target_fill(void) {
+    TEST_ASSERT_EQUAL_UINT32(1U, test_reports);
+    TEST_ASSERT_EQUAL_UINT8(TEST_TARGET_FILL, Test_Report_Credit());
+    TEST_ASSERT_EQUAL_UINT8(0, Test_Report_Expected());
+}
+
+static void test_accepted_samples_keep_the_credit_limit(void) {
+    for (uint8_t i = 0; i < 4U; i++) {
+        Test_Queue_Sample(i);
+    }
+    Test_Queue_Frame(TRAJECTORY_FRAME_PING, 0, 0, 0);
+    Test_Receive();
+
+    //samples in the FIFO use up the window, so the limit does not move until they play
+    TEST_ASSERT_EQUAL_UINT8(4U, Trajectory_Get_Fill());
+    TEST_ASSERT_EQUAL_UINT8(4U, Test_Report_Expected());
+    TEST_ASSERT_EQUAL_UINT8(TEST_TARGET_FILL, Test_Report_Credit());
+    TEST_ASSERT_EQUAL_UINT8(0, Test_Report_Rejected());
+}
+
+static void test_gap_requests_resend_once(void) {
+    Test_Queue_Sample(0);
+    Test_Queue_Sample(2U);
+    Test_Queue_Sample(3U);
+    Test_Queue_Sample(4U);
+    Test_Receive();
+
+    //one report names the missing sample, later out of order samples only count rejections
+    TEST_ASSERT_EQUAL_UINT32(2U, test_reports);
+    TEST_ASSERT_EQUAL_UINT8(1U, Test_Report_Expected());
+    TEST_ASSERT_EQUAL_UINT8(1U, Trajectory_Get_Fill());
+
+    //go-back-N: resending from the expected sample is accepted
+    for (uint8_t i = 1U; i <= 4U; i++) {
+        Test_Queue_Sample(i);
+    }
+    Test_Queue_Frame(TRAJECTORY_FRAME_PING, 0, 0, 0);
+    Test_Receive();
+    TEST_ASSERT_EQUAL_UINT8(5U, Trajectory_Get_Fill());
+    TEST_ASSERT_EQUAL_UINT8(5U, Test_Report_Expected());
+    TEST_ASSERT_EQUAL_UINT8(3U, Test_Report_Rejected());
+}
+
+static void test_corrupt_frame_is_skipped_and_resent(void) {
+    Test_Queue_Sample(0);
+    Test_Queue_Sample(1U);
+    test_rx[TRAJECTORY_FRAME_SIZE + 9U] ^= 0x40U;
+    Test_Queue_Sample(2U);
+    Test_Receive();
+
+    //the damaged sample is lost, the next one exposes the gap
+    TEST_ASSERT_EQUAL_UINT8(1U, Trajectory_Get_Fill());
+    TEST_ASSERT_EQUAL_UINT8(1U, Test_Report_Expected());
+
+    Test_Queue_Sample(1U);
+    Test_Queue_Sample(2U);
+    Test_Receive();
+    TEST_ASSERT_EQUAL_UINT8(3U, Trajectory_Get_Fill());
+}
+
+static void test_frames_split_across_reads(void) {
+    Test_Queue_Sample(0);
+    Test_Queue_Sample(1U);
+
+    //hand the parser a few bytes at a time, as PendSV would see them arrive
+    uint8_t chunk[5];
+    uint16_t length;
+    while ((length = USART_Read(USART1, chunk, sizeof(chunk)))) {
+        Trajectory_Parse(chunk, length);
+    }
+    TEST_ASSERT_EQUAL_UINT8(2U, Trajectory_Get_Fill());
+}
+
+static void test_busy_transmitter_defers_the_report(void) {
+    test_tx_status = USART_BUSY;
+    Test_Queue_Frame(TRAJECTORY_FRAME_PING, 0, 0, 0);
+    Test_Receive();
+    TEST_ASSERT_EQUAL_UINT32(1U, test_reports);
+
+    //the report goes out once the previous one has left
+    test_tx_status = USART_IDLE;
+    Trajectory_TX_Done(0);
+    TEST_ASSERT_EQUAL_UINT32(2U, test_reports);
+}
+
+static void test_playback_returns_credit_in_batches(void) {
+    for (uint8_t i = 0; i < TEST_TARGET_FILL; i++) {
+        Test_Queue_Sample(i);
+    }
+    Test_Queue_Frame(TRAJECTORY_FRAME_START, 0, 0, 0);
+    Test_Receive();
+    TEST_ASSERT_EQUAL(TRAJECTORY_PLAYING, Trajectory_Get_State());
+    uint32_t reports = test_reports;
+
+    //one sample every 20ms is played per 20ms frame, so credit returns one frame at a time
+    uint8_t frames = 0;
+    while (test_reports == reports && frames < TEST_TARGET_FILL) {
+        g_tim1_time++;
+        Trajectory_Step(0);
+        frames++;
+    }
+    TEST_ASSERT_EQUAL_UINT32(reports + 1U, test_reports);
+    TEST_ASSERT_EQUAL_UINT8(TRAJECTORY_CREDIT_BATCH, frames);
+    TEST_ASSERT_EQUAL_UINT8((uint8_t) (TEST_TARGET_FILL + TRAJECTORY_CREDIT_BATCH), Test_Report_Credit());
+}
+
+static void test_end_tangent_follows_late_sample(void) {
+    Test_Queue_Frame(TRAJECTORY_FRAME_SAMPLE, 0, 0, 0);
+    Test_Queue_Frame(TRAJECTORY_FRAME_SAMPLE, 1U, 100U, 9000U);
+    Test_Queue_Frame(TRAJECTORY_FRAME_START, 0, 0, 0);
+    Test_Receive();
+
+    //with no sample after the segment it heads for the chord, p(u) = 180u^2 - 90u^3
+    Test_Play_Frame();
+    Test_Play_Frame();
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 23.04f, test_degrees);
+
+    //a turn back to 0 flattens the end tangent, the segment carries on from where it was
+    Test_Queue_Frame(TRAJECTORY_FRAME_SAMPLE, 2U, 200U, 0);
+    Test_Receive();
+    Test_Play_Frame();
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 45.36f, test_degrees);
+    Test_Play_Frame();
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 73.62f, test_degrees);
+    Test_Play_Frame();
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 90.0f, test_degrees);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_init_grants_target_fill);
+    RUN_TEST(test_accepted_samples_keep_the_credit_limit);
+    RUN_TEST(test_gap_requests_resend_once);
+    RUN_TEST(test_corrupt_frame_is_skipped_and_resent);
+    RUN_TEST(test_frames_split_across_reads);
+    RUN_TEST(test_busy_transmitter_defers_the_report);
+    RUN_TEST(test_playback_returns_credit_in_batches);
+    RUN_TEST(test_end_tangent_follows_late_sample);
+    return UNITY_END();
+}
\ No newline at end of file
@@ -0,0 +1,397 @@
+#include <string.h>
+#include <unity.h>
+
+#include "../../../lib/usb_cdc/usb_cdc.h"
+
+/**********************************************************************************/
+/*                               Simulated Peripheral                             */
+/**********************************************************************************/
+
+/* registers are plain memory, the test plays the core's side of every handshake */
+static USB_OTG_Global_t       sim_global;
+static USB_OTG_Device_t       sim_device;
+static USB_OTG_IN_Endpoint_t  sim_in[USB_ENDPOINT_COUNT];
+static USB_OTG_OUT_Endpoint_t sim_out[USB_ENDPOINT_COUNT];
+static volatile uint32_t      sim_pcgcctl;
+static RCC_t                  sim_rcc;
+static DWT_t                  sim_dwt;
+static uint32_t               sim_uid[3];
+static uint32_t               sim_cycles;
+
+/* receive FIFO words queued by the test, transmit FIFO words pushed by the driver */
+static volatile uint32_t      sim_rx_fifo[32];
+static uint16_t               sim_rx_length;
+static uint16_t               sim_rx_read;
+static volatile uint32_t      sim_tx_fifo[USB_ENDPOINT_COUNT][64];
+static uint16_t               sim_tx_length[USB_ENDPOINT_COUNT];
+static volatile uint32_t      sim_discard;
+
+/*
+ * the FIFO macro is one access per word, so each use pops the next queued receive word or
+ * pushes a fresh transmit word, using up a word of space. FIFO 0 serves both, reads only
+ * happen while words are queued
+ */
+static volatile uint32_t *Sim_FIFO(uint8_t endpoint) {
+    if (!endpoint && sim_rx_read < sim_rx_length) {
+        return &sim_rx_fifo[sim_rx_read++];
+    }
+    if (sim_tx_length[endpoint] >= (sizeof(sim_tx_fifo[0]) / sizeof(sim_tx_fifo[0][0]))) {
+        return &sim_discard;
+    }
+    if (sim_in[endpoint].DTXFSTS) {
+        sim_in[endpoint].DTXFSTS--;
+    }
+    return &sim_tx_fifo[endpoint][sim_tx_length[endpoint]++];
+}
+
+static uint32_t Sim_CAS(volatile uint32_t *address, uint32_t expected, uint32_t desired) {
+    if (*address != expected) {
+        return 0;
+    }
+    *address = desired;
+    return 1U;
+}
+
+#undef  USB_OTG_FS
+#undef  USB_OTG_FS_DEVICE
+#undef  USB_OTG_FS_IN_EP
+#undef  USB_OTG_FS_OUT_EP
+#undef  USB_OTG_FS_PCGCCTL
+#undef  USB_OTG_FS_FIFO
+#undef  RCC
+#undef  DWT
+#undef  UID_BASE
+#define USB_OTG_FS                  (&sim_global)
+#define USB_OTG_FS_DEVICE           (&sim_device)
+#define USB_OTG_FS_IN_EP(n)         (&sim_in[(n)])
+#define USB_OTG_FS_OUT_EP(n)        (&sim_out[(n)])
+#define USB_OTG_FS_PCGCCTL          sim_pcgcctl
+#define USB_OTG_FS_FIFO(n)          (*Sim_FIFO((uint8_t) (n)))
+#define RCC                         (&sim_rcc)
+#define DWT                         (&sim_dwt)
+#define UID_BASE                    ((uintptr_t) sim_uid)
+
+#define ENTER_CRITICAL()            0U
+#define EXIT_CRITICAL(primask)      ((void) (primask))
+#define ATOMIC_CAS(a, e, d)         Sim_CAS((a), (e), (d))
+#define DSB()                       ((void) 0)
+
+#include "../../../lib/drivers/usb/usb.c"
+#include "../../../lib/usb_cdc/usb_cdc.c"
+
+
+/**********************************************************************************/
+/*                                 Driver Stubs                                   */
+/**********************************************************************************/
+
+static uint32_t test_rx_notified;
+static uint32_t test_tx_notified;
+
+/* the core finishes resets and flushes by the next time the counter is read */
+uint32_t Cycle_Counter_Get(void) {
+    sim_global.GRSTCTL &= ~(USB_OTG_GRSTCTL_CSRST | USB_OTG_GRSTCTL_TXFFLSH | USB_OTG_GRSTCTL_RXFFLSH);
+    sim_global.GRSTCTL |= USB_OTG_GRSTCTL_AHBIDL;
+    sim_cycles += 1000U;
+    return sim_cycles;
+}
+
+void Cycle_Counter_Init(void) {
+    sim_dwt.CTRL |= DWT_CTRL_CYCCNTENA;
+}
+
+Status NVIC_Request_IRQ(IRQn_t IRQn, NVIC_Latency_Class latency_class, const void *owner) {
+    (void) IRQn; (void) latency_class; (void) owner;
+    return SUCCESS;
+}
+
+Status NVIC_Enable_IRQ(IRQn_t IRQn) {
+    (void) IRQn;
+    return SUCCESS;
+}
+
+Status GPIO_Init(GPIO_Config_t *gpio_config) {
+    (void) gpio_config;
+    return SUCCESS;
+}
+
+/* deferred work runs straight away */
+Status Deferred_Post(Deferred_Work_t work, uint32_t argument) {
+    work(argument);
+    return SUCCESS;
+}
+
+static void Test_RX_Notify(uint32_t argument) {
+    (void) argument;
+    test_rx_notified++;
+}
+
+static void Test_TX_Notify(uint32_t argument) {
+    (void) argument;
+    test_tx_notified++;
+}
+
+static USB_CDC_Config_t test_config = {.rx_notify = Test_RX_Notify, .tx_notify = Test_TX_Notify};
+
+
+/**********************************************************************************/
+/*                                 Test Helpers                                   */
+/**********************************************************************************/
+
+static void Test_Queue_Words(const uint8_t *data, uint16_t length) {
+    sim_rx_length = 0;
+    sim_rx_read   = 0;
+    for (uint16_t i = 0; i < length; i += 4U) {
+        uint32_t word = 0;
+        for (uint16_t byte = 0; byte < 4U && (i + byte) < length; byte++) {
+            word |= ((uint32_t) data[i + byte] << (byte * 8U));
+        }
+        sim_rx_fifo[sim_rx_length++] = word;
+    }
+}
+
+/* receive FIFO entry followed by the endpoint interrupt the core raises for it */
+static void Test_Setup(uint8_t type, uint8_t request, uint16_t value, uint16_t index, uint16_t length) {
+    const uint8_t setup[8] = {type, request, (uint8_t) value, (uint8_t) (value >> 8U),
+                              (uint8_t) index, (uint8_t) (index >> 8U), (uint8_t) length, (uint8_t) (length >> 8U)};
+    Test_Queue_Words(setup, sizeof(setup));
+    sim_global.GRXSTSP = (USB_OTG_GRXSTSP_PKTSTS_SETUP_DATA | (8UL << USB_OTG_GRXSTSP_BCNT_Pos));
+    USB_Receive_Packet();
+
+    sim_out[0].DOEPINT = USB_OTG_DOEPINT_STUP;
+    sim_device.DAINT   = (SET_ONE << USB_OTG_DAINT_OEPINT_Pos);
+    USB_OUT_Interrupt();
+}
+
+static void Test_OUT_Packet(uint8_t endpoint, const uint8_t *data, uint16_t length) {
+    Test_Queue_Words(data, length);
+    sim_global.GRXSTSP = (USB_OTG_GRXSTSP_PKTSTS_OUT_DATA | ((uint32_t) length << USB_OTG_GRXSTSP_BCNT_Pos)
+                          | endpoint);
+    USB_Receive_Packet();
+}
+
+/* the core disables an endpoint when its transfer completes */
+static void Test_OUT_Complete(uint8_t endpoint) {
+    sim_out[endpoint].DOEPCTL &= ~(USB_OTG_DOEPCTL_EPENA);
+    sim_out[endpoint].DOEPINT  = USB_OTG_DOEPINT_XFRC;
+    sim_device.DAINT           = (SET_ONE << (USB_OTG_DAINT_OEPINT_Pos + endpoint));
+    USB_OUT_Interrupt();
+}
+
+static void Test_IN_Complete(uint8_t endpoint) {
+    sim_in[endpoint].DIEPCTL &= ~(USB_OTG_DIEPCTL_EPENA);
+    sim_in[endpoint].DIEPINT  = USB_OTG_DIEPINT_XFRC;
+    sim_device.DAINT          = (SET_ONE << endpoint);
+    USB_IN_Interrupt();
+}
+
+static void Test_TX_Empty(uint8_t endpoint, uint16_t space_words) {
+    sim_in[endpoint].DTXFSTS = space_words;
+    sim_in[endpoint].DIEPINT = USB_OTG_DIEPINT_TXFE;
+    sim_device.DAINT         = (SET_ONE << endpoint);
+    USB_IN_Interrupt();
+}
+
+static void Test_Configure(void) {
+    Test_Setup(0, USB_REQUEST_SET_CONFIGURATION, 1U, 0, 0);
+    Test_IN_Complete(0);
+    sim_tx_length[0] = 0;
+}
+
+static void Test_Assert_TX_Bytes(uint8_t endpoint, const uint8_t *expected, uint16_t length) {
+    TEST_ASSERT_EQUAL_UINT32(((length + 3U) / 4U), sim_tx_length[endpoint]);
+    for (uint16_t i = 0; i < length; i++) {
+        TEST_ASSERT_EQUAL_UINT8(expected[i], (uint8_t) (sim_tx_fifo[endpoint][i / 4U] >> ((i % 4U) * 8U)));
+    }
+}
+
+
+/**********************************************************************************/
+/*                                     Tests                                      */
+/**********************************************************************************/
+
+void setUp(void) {
+    memset((void *) &sim_global, 0, sizeof(sim_global));
+    memset((void *) &sim_device, 0, sizeof(sim_device));
+    memset((void *) sim_in, 0, sizeof(sim_in));
+    memset((void *) sim_out, 0, sizeof(sim_out));
+    memset((void *) &sim_rcc, 0, sizeof(sim_rcc));
+    memset((void *) &sim_dwt, 0, sizeof(sim_dwt));
+    memset((void *) sim_tx_fifo, 0, sizeof(sim_tx_fifo));
+    memset(sim_tx_length, 0, sizeof(sim_tx_length));
+    sim_rx_length    = 0;
+    sim_rx_read      = 0;
+    test_rx_notified = 0;
+    test_tx_notified = 0;
+
+    //96MHz system clock from the PLL
+    sim_rcc.CR     = RCC_CR_PLLRDY;
+    sim_rcc.CFGR   = RCC_CFGR_SWS_PLL;
+    g_sys_clk_freq = 96000000UL;
+    TEST_ASSERT_EQUAL(SUCCESS, USB_CDC_Init(&test_config));
+
+    //host resets the bus after the pull-up connects
+    USB_Bus_Reset();
+}
+
+void tearDown(void) {
+}
+
+static void test_init_requires_fast_pll_clock(void) {
+    sim_rcc.CFGR = RCC_CFGR_SWS_HSI;
+    TEST_ASSERT_EQUAL(ERROR, USB_Init(&usb_cdc_usb_config));
+
+    sim_rcc.CFGR = (RCC_CFGR_SWS_PLL | RCC_CFGR_HPRE_DIV2);
+    TEST_ASSERT_EQUAL(ERROR, USB_Init(&usb_cdc_usb_config));
+
+    sim_rcc.CFGR   = RCC_CFGR_SWS_PLL;
+    g_sys_clk_freq = 24000000UL;
+    TEST_ASSERT_EQUAL(ERROR, USB_Init(&usb_cdc_usb_config));
+
+    g_sys_clk_freq = USB_MIN_AHB_FREQ;
+    TEST_ASSERT_EQUAL(SUCCESS, USB_Init(&usb_cdc_usb_config));
+    TEST_ASSERT_EQUAL_UINT32((6UL << USB_OTG_GUSBCFG_TRDT_Pos),
+                             (sim_global.GUSBCFG & USB_OTG_GUSBCFG_TRDT_Msk));
+}
+
+static void test_device_descriptor_loads_on_fifo_empty(void) {
+    Test_Setup(USB_REQUEST_DIRECTION_IN, USB_REQUEST_GET_DESCRIPTOR, (USB_DESCRIPTOR_DEVICE << 8U), 0, 64U);
+
+    //armed as one short packet, but nothing is written until the FIFO reports space
+    TEST_ASSERT_EQUAL_UINT32(((SET_ONE << USB_OTG_DIEPTSIZ_PKTCNT_Pos) | 18U), sim_in[0].DIEPTSIZ);
+    TEST_ASSERT_EQUAL_UINT32(0, sim_tx_length[0]);
+    TEST_ASSERT_TRUE(sim_device.DIEPEMPMSK & SET_ONE);
+
+    Test_TX_Empty(0, 16U);
+    Test_Assert_TX_Bytes(0, usb_cdc_device_descriptor, 18U);
+    TEST_ASSERT_TRUE(!(sim_device.DIEPEMPMSK & SET_ONE));
+
+    Test_IN_Complete(0);
+    TEST_ASSERT_EQUAL(USB_EP0_STATUS_OUT, usb_ep0_stage);
+}
+
+static void test_configuration_descriptor_spans_packets(void) {
+    Test_Setup(USB_REQUEST_DIRECTION_IN, USB_REQUEST_GET_DESCRIPTOR, (USB_DESCRIPTOR_CONFIGURATION << 8U), 0,
+               255U);
+    Test_TX_Empty(0, 16U);
+    Test_Assert_TX_Bytes(0, usb_cdc_configuration_descriptor, 64U);
+
+    //the remaining 3 bytes go in a second, short packet, so no zero length packet follows
+    sim_tx_length[0] = 0;
+    Test_IN_Complete(0);
+    TEST_ASSERT_EQUAL_UINT32(((SET_ONE << USB_OTG_DIEPTSIZ_PKTCNT_Pos) | 3U), sim_in[0].DIEPTSIZ);
+    Test_TX_Empty(0, 16U);
+    Test_Assert_TX_Bytes(0, &usb_cdc_configuration_descriptor[64], 3U);
+    Test_IN_Complete(0);
+    TEST_ASSERT_EQUAL(USB_EP0_STATUS_OUT, usb_ep0_stage);
+}
+
+static void test_set_configuration_arms_bulk_out(void) {
+    Test_Configure();
+
+    TEST_ASSERT_EQUAL(USB_STATE_CONFIGURED, USB_Get_State());
+    TEST_ASSERT_TRUE(sim_in[1].DIEPCTL & USB_OTG_DIEPCTL_USBAEP);
+    TEST_ASSERT_TRUE(sim_in[2].DIEPCTL & USB_OTG_DIEPCTL_USBAEP);
+    TEST_ASSERT_TRUE(sim_out[1].DOEPCTL & USB_OTG_DOEPCTL_EPENA);
+    TEST_ASSERT_EQUAL_UINT32((((USB_CDC_RX_BLOCK_SIZE / USB_CDC_PACKET_SIZE) << USB_OTG_DOEPTSIZ_PKTCNT_Pos)
+                              | USB_CDC_RX_BLOCK_SIZE), sim_out[1].DOEPTSIZ);
+}
+
+static void test_bulk_out_packets_land_in_place(void) {
+    uint8_t data[74];
+    for (uint8_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t) (i * 3U);
+    }
+    Test_Configure();
+
+    //a full packet then a short one ends the transfer
+    Test_OUT_Packet(1U, data, 64U);
+    Test_OUT_Packet(1U, &data[64], 10U);
+    TEST_ASSERT_EQUAL_UINT32(sim_rx_length, sim_rx_read);
+    Test_OUT_Complete(1U);
+    TEST_ASSERT_EQUAL_UINT32(1U, test_rx_notified);
+
+    const uint8_t *block  = 0;
+    uint16_t      length  = 0;
+    TEST_ASSERT_EQUAL(SUCCESS, USB_CDC_Read(&block, &length));
+    TEST_ASSERT_EQUAL_UINT16(sizeof(data), length);
+    TEST_ASSERT_TRUE(block == usb_cdc_rx_blocks[0]);
+    TEST_ASSERT_EQUAL(0, memcmp(block, data, sizeof(data)));
+
+    //the endpoint moved on to the next block while this one is read
+    TEST_ASSERT_TRUE(usb_out[1].rx_buffer == usb_cdc_rx_blocks[1]);
+    TEST_ASSERT_TRUE(sim_out[1].DOEPCTL & USB_OTG_DOEPCTL_EPENA);
+    TEST_ASSERT_EQUAL(SUCCESS, USB_CDC_Release());
+    TEST_ASSERT_EQUAL(ERROR, USB_CDC_Read(&block, &length));
+}
+
+static void test_unaligned_read_drops_bytes_beyond_space(void) {
+    uint8_t       buffer[12];
+    const uint8_t data[7] = {1U, 2U, 3U, 4U, 5U, 6U, 7U};
+    memset(buffer, 0xEEU, sizeof(buffer));
+    Test_Queue_Words(data, sizeof(data));
+
+    USB_Read_FIFO(&buffer[1], sizeof(data), 5U);
+
+    //both words are popped so the next packet stays in step
+    TEST_ASSERT_EQUAL_UINT32(2U, sim_rx_read);
+    TEST_ASSERT_EQUAL_UINT8(0xEEU, buffer[0]);
+    TEST_ASSERT_EQUAL(0, memcmp(&buffer[1], data, 5U));
+    TEST_ASSERT_EQUAL_UINT8(0xEEU, buffer[6]);
+    TEST_ASSERT_EQUAL_UINT8(0xEEU, buffer[7]);
+}
+
+static void test_transmit_waits_for_fifo_space(void) {
+    static uint8_t data[130];
+    for (uint8_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t) (0xA0U + i);
+    }
+    Test_Configure();
+    TEST_ASSERT_EQUAL(SUCCESS, USB_CDC_Transmit(data, sizeof(data)));
+    TEST_ASSERT_EQUAL_UINT32(((3UL << USB_OTG_DIEPTSIZ_PKTCNT_Pos) | sizeof(data)), sim_in[1].DIEPTSIZ);
+
+    //room for one packet only, the empty interrupt stays enabled for the rest
+    Test_TX_Empty(1U, 20U);
+    TEST_ASSERT_EQUAL_UINT32(16U, sim_tx_length[1]);
+    TEST_ASSERT_TRUE(sim_device.DIEPEMPMSK & (SET_ONE << 1U));
+
+    Test_TX_Empty(1U, 128U);
+    Test_Assert_TX_Bytes(1U, data, sizeof(data));
+    TEST_ASSERT_TRUE(!(sim_device.DIEPEMPMSK & (SET_ONE << 1U)));
+
+    Test_IN_Complete(1U);
+    TEST_ASSERT_EQUAL_UINT32(1U, test_tx_notified);
+}
+
+static void test_full_packet_transmit_ends_with_zlp(void) {
+    static uint8_t data[USB_CDC_PACKET_SIZE];
+    for (uint8_t i = 0; i < sizeof(data); i++) {
+        data[i] = i;
+    }
+    Test_Configure();
+    TEST_ASSERT_EQUAL(SUCCESS, USB_CDC_Transmit(data, sizeof(data)));
+    Test_TX_Empty(1U, 128U);
+    Test_Assert_TX_Bytes(1U, data, sizeof(data));
+
+    //completion of the data starts a zero length packet, still busy until it is sent
+    Test_IN_Complete(1U);
+    TEST_ASSERT_EQUAL_UINT32((SET_ONE << USB_OTG_DIEPTSIZ_PKTCNT_Pos), sim_in[1].DIEPTSIZ);
+    TEST_ASSERT_EQUAL_UINT32(0, test_tx_notified);
+    TEST_ASSERT_EQUAL(ERROR, USB_CDC_Transmit(data, sizeof(data)));
+
+    Test_IN_Complete(1U);
+    TEST_ASSERT_EQUAL_UINT32(1U, test_tx_notified);
+    TEST_ASSERT_EQUAL(SUCCESS, USB_CDC_Transmit(data, 10U));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_init_requires_fast_pll_clock);
+    RUN_TEST(test_device_descriptor_loads_on_fifo_empty);
+    RUN_TEST(test_configuration_descriptor_spans_packets);
+    RUN_TEST(test_set_configuration_arms_bulk_out);
+    RUN_TEST(test_bulk_out_packets_land_in_place);
+    RUN_TEST(test_unaligned_read_drops_bytes_beyond_space);
+    RUN_TEST(test_transmit_waits_for_fifo_space);
+    RUN_TEST(test_full_packet_transmit_ends_with_zlp);
+    return UNITY_END();
+}
\ No newline at end of file